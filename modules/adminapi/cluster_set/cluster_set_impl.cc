@@ -2598,7 +2598,15 @@ void Cluster_set_impl::reconcile_view_change_gtids(
       replica->descr().c_str(), std::to_string(gtid_set.count()).c_str(),
       primary->descr().c_str(), gtid_set.str().c_str());
 
-  inject_gtid_set(*primary, gtid_set);
+  const auto injected = inject_gtid_set(
+      *primary, gtid_set, [&primary](uint64_t done, uint64_t total) {
+        log_debug("Injected %s of %s VCLE GTIDs at %s",
+                  std::to_string(done).c_str(), std::to_string(total).c_str(),
+                  primary->descr().c_str());
+      });
+
+  log_info("%s VCLE GTIDs were injected at %s",
+           std::to_string(injected).c_str(), primary->descr().c_str());
 }
 
 void Cluster_set_impl::check_clusters_available(
@@ -108,6 +108,253 @@ shcore::Dictionary_t ShellBaseResult::fetch_one_object() const {
   return {};
 }
 
+REGISTER_HELP_DETAIL_TEXT(RESULT_FETCHALLCOLUMNS_DETAIL, R"*(
+The returned dictionary contains the following keys:
+@li <b>length</b>: integer - number of fetched records.
+@li <b>columns</b>: list - a dictionary for each column of the result.
+
+Values are not converted to individual objects, each column holds binary
+buffers which use the memory layout of the Apache Arrow columnar format:
+@li <b>name</b>: string - name of the column.
+@li <b>type</b>: string - type of the column.
+@li <b>format</b>: string - format of the values, as defined by the Arrow C data
+interface: l - 64-bit signed integer, L - 64-bit unsigned integer, f - 32-bit
+float, g - 64-bit float, U - UTF-8 string, Z - binary data.
+@li <b>length</b>: integer - number of values.
+@li <b>nullCount</b>: integer - number of NULL values.
+@li <b>validity</b>: bytes - bitmap of non-NULL values, least significant bit
+first.
+@li <b>data</b>: bytes - numeric values stored in a contiguous array, using
+native byte order, or concatenated strings and binary data.
+@li <b>offsets</b>: bytes - only for strings and binary data, contiguous array
+of 64-bit integers, value <b>i</b> begins at offset <b>i</b> and ends at offset
+<b>i + 1</b>.
+
+Values of the DECIMAL, date and time types are returned as strings.
+
+If <<<fetchOne>>>() is called before this function, only the remaining records
+are returned.
+)*");
+
+namespace {
+
+/**
+ * Builds a single column of a result using the memory layout of the Apache
+ * Arrow columnar format:
+ *  - validity bitmap, least significant bit first, bit is set for non-NULL
+ *    values,
+ *  - fixed size values are stored in a contiguous buffer (native byte order),
+ *  - variable size values are stored in a contiguous buffer, with a buffer of
+ *    64-bit offsets (N + 1 values) pointing to the start of each value.
+ */
+class Column_builder final {
+ public:
+  Column_builder(const mysqlshdk::db::Column &column, uint32_t index)
+      : m_index(index), m_type(column.get_type()) {
+    using mysqlshdk::db::Type;
+
+    switch (m_type) {
+      case Type::Integer:
+        m_format = Format::INT64;
+        break;
+
+      case Type::UInteger:
+      case Type::Bit:
+        m_format = Format::UINT64;
+        break;
+
+      case Type::Float:
+        m_format = Format::FLOAT;
+        break;
+
+      case Type::Double:
+        m_format = Format::DOUBLE;
+        break;
+
+      case Type::Bytes:
+      case Type::Geometry:
+        m_format = Format::BINARY;
+        break;
+
+      default:
+        m_format = Format::STRING;
+        break;
+    }
+
+    if (is_variable_size()) {
+      append_offset();
+    }
+  }
+
+  void append(const mysqlshdk::db::IRow &row) {
+    const auto valid = !row.is_null(m_index);
+
+    if (0 == m_length % 8) {
+      m_validity.push_back('\0');
+    }
+
+    if (valid) {
+      m_validity.back() |= static_cast<char>(1 << (m_length % 8));
+    } else {
+      ++m_null_count;
+    }
+
+    ++m_length;
+
+    switch (m_format) {
+      case Format::INT64:
+        append_value<int64_t>(valid ? row.get_int(m_index) : 0);
+        break;
+
+      case Format::UINT64:
+        if (!valid) {
+          append_value<uint64_t>(0);
+        } else if (mysqlshdk::db::Type::Bit == m_type) {
+          append_value<uint64_t>(std::get<0>(row.get_bit(m_index)));
+        } else {
+          append_value<uint64_t>(row.get_uint(m_index));
+        }
+        break;
+
+      case Format::FLOAT:
+        append_value<float>(valid ? row.get_float(m_index) : 0.0f);
+        break;
+
+      case Format::DOUBLE:
+        append_value<double>(valid ? row.get_double(m_index) : 0.0);
+        break;
+
+      case Format::STRING:
+      case Format::BINARY:
+        if (valid) {
+          if (Format::BINARY == m_format ||
+              mysqlshdk::db::Type::String == m_type) {
+            const auto data = row.get_string_data(m_index);
+            m_data.append(data.first, data.second);
+          } else {
+            m_data.append(row.get_as_string(m_index));
+          }
+        }
+
+        append_offset();
+        break;
+    }
+  }
+
+  shcore::Dictionary_t build(const std::string &name) {
+    auto column = shcore::make_dict();
+
+    column->emplace("name", name);
+    column->emplace("type", mysqlshdk::db::to_string(m_type));
+    column->emplace("format", format());
+    column->emplace("length", m_length);
+    column->emplace("nullCount", m_null_count);
+    column->emplace("validity", shcore::Value(std::move(m_validity), true));
+    column->emplace("data", shcore::Value(std::move(m_data), true));
+
+    if (is_variable_size()) {
+      column->emplace("offsets", shcore::Value(std::move(m_offsets), true));
+    }
+
+    return column;
+  }
+
+ private:
+  enum class Format { INT64, UINT64, FLOAT, DOUBLE, STRING, BINARY };
+
+  bool is_variable_size() const {
+    return Format::STRING == m_format || Format::BINARY == m_format;
+  }
+
+  // format strings as defined by the Arrow C data interface
+  const char *format() const {
+    switch (m_format) {
+      case Format::INT64:
+        return "l";
+
+      case Format::UINT64:
+        return "L";
+
+      case Format::FLOAT:
+        return "f";
+
+      case Format::DOUBLE:
+        return "g";
+
+      case Format::STRING:
+        return "U";
+
+      case Format::BINARY:
+        return "Z";
+    }
+
+    throw std::logic_error("Unknown column format");
+  }
+
+  template <typename T>
+  static void append(std::string *buffer, T value) {
+    buffer->append(reinterpret_cast<const char *>(&value), sizeof(T));
+  }
+
+  template <typename T>
+  void append_value(T value) {
+    append(&m_data, value);
+  }
+
+  void append_offset() {
+    append(&m_offsets, static_cast<int64_t>(m_data.size()));
+  }
+
+  uint32_t m_index;
+  mysqlshdk::db::Type m_type;
+  Format m_format;
+  uint64_t m_length = 0;
+  uint64_t m_null_count = 0;
+  std::string m_validity;
+  std::string m_data;
+  std::string m_offsets;
+};
+
+}  // namespace
+
+shcore::Dictionary_t ShellBaseResult::fetch_all_as_columns() const {
+  const auto result = get_result();
+  const auto names = get_column_names();
+
+  std::vector<Column_builder> builders;
+  uint64_t length = 0;
+
+  if (result && names) {
+    const auto &metadata = get_metadata();
+    builders.reserve(metadata.size());
+
+    for (uint32_t i = 0, size = metadata.size(); i < size; ++i) {
+      builders.emplace_back(metadata[i], i);
+    }
+
+    while (const auto row = result->fetch_one()) {
+      for (auto &builder : builders) {
+        builder.append(*row);
+      }
+
+      ++length;
+    }
+  }
+
+  auto columns = shcore::make_array();
+
+  for (std::size_t i = 0, size = builders.size(); i < size; ++i) {
+    columns->emplace_back(builders[i].build((*names)[i]));
+  }
+
+  auto ret_val = shcore::make_dict();
+
+  ret_val->emplace("length", length);
+  ret_val->emplace("columns", std::move(columns));
+
+  return ret_val;
+}
+
 std::shared_ptr<std::vector<std::string>> ShellBaseResult::get_column_names()
     const {
   update_column_cache();
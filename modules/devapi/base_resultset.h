@@ -59,6 +59,11 @@ class ShellBaseResult : public shcore::Cpp_object_bridge {
 
   shcore::Dictionary_t fetch_one_object() const;
 
+  /**
+   * Fetches all the remaining rows, returns them in a columnar format.
+   */
+  shcore::Dictionary_t fetch_all_as_columns() const;
+
   void dump();
 
   virtual bool has_data() const = 0;
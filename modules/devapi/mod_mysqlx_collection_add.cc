@@ -242,12 +242,19 @@ REGISTER_HELP(COLLECTIONADD_EXECUTE_BRIEF,
               "Executes the add operation, the documents are added to the "
               "target collection.");
 REGISTER_HELP(COLLECTIONADD_EXECUTE_RETURNS, "@returns A Result object.");
+REGISTER_HELP(COLLECTIONADD_EXECUTE_DETAIL,
+              "If the operation is too big to be sent to the server in a single "
+              "message, it is split into multiple statements, which are not "
+              "executed atomically unless the operation is executed in a "
+              "transaction.");
 
 /**
  * $(COLLECTIONADD_EXECUTE_BRIEF)
  *
  * $(COLLECTIONADD_EXECUTE_RETURNS)
  *
+ * $(COLLECTIONADD_EXECUTE_DETAIL)
+ *
  * #### Method Chaining
  *
  * This function can be invoked once after:
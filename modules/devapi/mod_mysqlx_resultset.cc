@@ -548,6 +548,7 @@ RowResult::RowResult(std::shared_ptr<mysqlshdk::db::mysqlx::Result> result)
 
   expose("fetchOne", &RowResult::fetch_one);
   expose("fetchAll", &RowResult::fetch_all);
+  expose("fetchAllColumns", &RowResult::fetch_all_columns);
   expose("fetchOneObject", &RowResult::_fetch_one_object);
 }
 
@@ -733,6 +734,29 @@ shcore::Array_t RowResult::fetch_all() const {
   return array;
 }
 
+// Documentation of fetchAllColumns function
+REGISTER_HELP_FUNCTION(fetchAllColumns, RowResult);
+REGISTER_HELP_FUNCTION_TEXT(ROWRESULT_FETCHALLCOLUMNS, R"*(
+Returns all records left on the result, in a columnar format.
+
+@returns A dictionary containing the values of all columns.
+
+${RESULT_FETCHALLCOLUMNS_DETAIL}
+)*");
+/**
+ * $(ROWRESULT_FETCHALLCOLUMNS_BRIEF)
+ *
+ * $(ROWRESULT_FETCHALLCOLUMNS)
+ */
+#if DOXYGEN_JS
+Dictionary RowResult::fetchAllColumns() {}
+#elif DOXYGEN_PY
+dict RowResult::fetch_all_columns() {}
+#endif
+shcore::Dictionary_t RowResult::fetch_all_columns() const {
+  return fetch_all_as_columns();
+}
+
 void RowResult::append_json(shcore::JSON_dumper &dumper) const {
   bool create_object = (dumper.deep_level() == 0);
 
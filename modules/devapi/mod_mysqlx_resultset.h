@@ -191,6 +191,7 @@ class SHCORE_PUBLIC RowResult : public BaseResult {
 
   std::shared_ptr<mysqlsh::Row> fetch_one() const;
   shcore::Array_t fetch_all() const;
+  shcore::Dictionary_t fetch_all_columns() const;
   shcore::Dictionary_t _fetch_one_object();
   shcore::Value get_member(const std::string &prop) const override;
 
@@ -204,6 +205,7 @@ class SHCORE_PUBLIC RowResult : public BaseResult {
   Row fetchOne();
   Dictionary fetchOneObject();
   List fetchAll();
+  Dictionary fetchAllColumns();
 
   Integer columnCount;  //!< Same as getColumnCount()
   List columnNames;     //!< Same as getColumnNames()
@@ -216,6 +218,7 @@ class SHCORE_PUBLIC RowResult : public BaseResult {
   Row fetch_one();
   dict fetch_one_object();
   list fetch_all();
+  dict fetch_all_columns();
 
   int column_count;   //!< Same as get_column_count()
   list column_names;  //!< Same as get_column_names()
@@ -349,11 +349,18 @@ REGISTER_HELP(TABLEINSERT_EXECUTE_BRIEF, "Executes the insert operation.");
 REGISTER_HELP(TABLEINSERT_EXECUTE_RETURNS,
               "@returns A <b>Result</b> object that can be used to retrieve "
               "the results of the operation.");
+REGISTER_HELP(TABLEINSERT_EXECUTE_DETAIL,
+              "If the operation is too big to be sent to the server in a single "
+              "message, it is split into multiple statements, which are not "
+              "executed atomically unless the operation is executed in a "
+              "transaction.");
 /**
  * $(TABLEINSERT_EXECUTE_BRIEF)
  *
  * $(TABLEINSERT_EXECUTE_RETURNS)
  *
+ * $(TABLEINSERT_EXECUTE_DETAIL)
+ *
  * #### Method Chaining
  *
  * This function can be invoked after:
@@ -70,6 +70,7 @@ ClassicResult::ClassicResult(
   expose("fetchOne", &ClassicResult::fetch_one);
   expose("fetchOneObject", &ClassicResult::_fetch_one_object);
   expose("fetchAll", &ClassicResult::fetch_all);
+  expose("fetchAllColumns", &ClassicResult::fetch_all_columns);
   expose("nextDataSet", &ClassicResult::next_data_set);
   expose("nextResult", &ClassicResult::next_result);
   expose("hasData", &ClassicResult::has_data);
@@ -226,6 +227,29 @@ shcore::Array_t ClassicResult::fetch_all() const {
   return array;
 }
 
+// Documentation of the fetchAllColumns function
+REGISTER_HELP_FUNCTION(fetchAllColumns, ClassicResult);
+REGISTER_HELP_FUNCTION_TEXT(CLASSICRESULT_FETCHALLCOLUMNS, R"*(
+Returns all records left on the result, in a columnar format.
+
+@returns A dictionary containing the values of all columns.
+
+${RESULT_FETCHALLCOLUMNS_DETAIL}
+)*");
+/**
+ * $(CLASSICRESULT_FETCHALLCOLUMNS_BRIEF)
+ *
+ * $(CLASSICRESULT_FETCHALLCOLUMNS)
+ */
+#if DOXYGEN_JS
+Dictionary ClassicResult::fetchAllColumns() {}
+#elif DOXYGEN_PY
+dict ClassicResult::fetch_all_columns() {}
+#endif
+shcore::Dictionary_t ClassicResult::fetch_all_columns() const {
+  return fetch_all_as_columns();
+}
+
 // Documentation of getAffectedRowCount function
 REGISTER_HELP_PROPERTY(affectedRowCount, ClassicResult);
 REGISTER_HELP(CLASSICRESULT_AFFECTEDROWCOUNT_BRIEF,
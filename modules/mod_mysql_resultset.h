@@ -77,6 +77,7 @@ class SHCORE_PUBLIC ClassicResult : public ShellBaseResult {
   Row fetchOne();
   Dictionary fetchOneObject();
   List fetchAll();
+  Dictionary fetchAllColumns();
   Integer getAffectedItemsCount();
   Integer getAffectedRowCount();
   Integer getColumnCount();
@@ -121,6 +122,7 @@ class SHCORE_PUBLIC ClassicResult : public ShellBaseResult {
   Row fetch_one();
   dict fetch_one_object();
   list fetch_all();
+  dict fetch_all_columns();
   int get_affected_items_count();
   int get_affected_row_count();
   int get_column_count();
@@ -148,6 +150,7 @@ class SHCORE_PUBLIC ClassicResult : public ShellBaseResult {
   std::shared_ptr<Row> fetch_one() const;
   shcore::Dictionary_t _fetch_one_object();
   shcore::Array_t fetch_all() const;
+  shcore::Dictionary_t fetch_all_columns() const;
   bool next_data_set();
   bool next_result();
 
@@ -182,7 +182,7 @@ std::vector<mysqlshdk::db::Query_attribute> ClassicSession::query_attributes()
       [](const shcore::Value &att) -> std::unique_ptr<Classic_query_attribute> {
         switch (att.type) {
           case shcore::Value_type::String:
-            return std::make_unique<Classic_query_attribute>(*att.value.s);
+            return std::make_unique<Classic_query_attribute>(att.value.s);
           case shcore::Value_type::Bool:
             return std::make_unique<Classic_query_attribute>(att.as_int());
           case shcore::Value_type::Integer:
@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/common/dump/json_metadata.h"
+
+#include <rapidjson/error/en.h>
+
+#include <stdexcept>
+#include <utility>
+
+namespace mysqlsh {
+namespace dump {
+namespace common {
+
+namespace {
+
+std::string type_name(const rapidjson::Value &value) {
+  switch (value.GetType()) {
+    case rapidjson::kNullType:
+      return "null";
+    case rapidjson::kFalseType:
+    case rapidjson::kTrueType:
+      return "bool";
+    case rapidjson::kObjectType:
+      return "object";
+    case rapidjson::kArrayType:
+      return "array";
+    case rapidjson::kStringType:
+      return "string";
+    case rapidjson::kNumberType:
+      return "number";
+  }
+
+  return "unknown";
+}
+
+[[noreturn]] void throw_invalid_type(const rapidjson::Value &value,
+                                     const char *expected,
+                                     const char *name = nullptr) {
+  std::string msg = "Expected ";
+  msg += expected;
+
+  if (name) {
+    msg += " value of '";
+    msg += name;
+    msg += "'";
+  }
+
+  msg += ", got " + type_name(value);
+
+  throw std::invalid_argument(msg);
+}
+
+}  // namespace
+
+Json_file_writer::Output_stream::Output_stream(
+    mysqlshdk::storage::IFile *file)
+    : m_file(file) {
+  m_buffer.reserve(k_buffer_size);
+}
+
+void Json_file_writer::Output_stream::Flush() {
+  if (!m_buffer.empty()) {
+    m_file->write(m_buffer.data(), m_buffer.size());
+    m_buffer.clear();
+  }
+}
+
+Json_file_writer::Json_file_writer(
+    std::unique_ptr<mysqlshdk::storage::IFile> file)
+    : m_file(std::move(file)), m_stream(m_file.get()), m_writer(m_stream) {
+  m_file->open(mysqlshdk::storage::Mode::WRITE);
+}
+
+void Json_file_writer::close() {
+  m_stream.Flush();
+  m_file->close();
+}
+
+Json_metadata::Json_metadata(const std::string &data) {
+  m_doc.Parse(data.c_str(), data.length());
+
+  if (m_doc.HasParseError()) {
+    throw std::invalid_argument(
+        std::string{rapidjson::GetParseError_En(m_doc.GetParseError())} +
+        " at offset " + std::to_string(m_doc.GetErrorOffset()));
+  }
+
+  if (!m_doc.IsObject()) {
+    throw_invalid_type(m_doc, "object");
+  }
+}
+
+const rapidjson::Value *Json_metadata::get(const char *name) const {
+  const auto it = m_doc.FindMember(name);
+
+  if (m_doc.MemberEnd() == it || it->value.IsNull()) {
+    return nullptr;
+  }
+
+  return &it->value;
+}
+
+bool Json_metadata::has(const char *name) const {
+  return m_doc.MemberEnd() != m_doc.FindMember(name);
+}
+
+bool Json_metadata::get_bool(const char *name, bool default_value) const {
+  const auto value = get(name);
+
+  if (!value) {
+    return default_value;
+  }
+
+  if (!value->IsBool()) {
+    throw_invalid_type(*value, "bool", name);
+  }
+
+  return value->GetBool();
+}
+
+std::string Json_metadata::get_string(const char *name,
+                                      const std::string &default_value) const {
+  const auto value = get(name);
+
+  if (!value) {
+    return default_value;
+  }
+
+  if (!value->IsString()) {
+    throw_invalid_type(*value, "string", name);
+  }
+
+  return as_string(*value);
+}
+
+uint64_t Json_metadata::get_uint(const char *name) const {
+  const auto value = get(name);
+
+  if (!value) {
+    throw std::invalid_argument(std::string{"Missing value of '"} + name +
+                                "'");
+  }
+
+  if (!value->IsUint64()) {
+    throw_invalid_type(*value, "unsigned integer", name);
+  }
+
+  return value->GetUint64();
+}
+
+const rapidjson::Value *Json_metadata::get_object(const char *name) const {
+  const auto value = get(name);
+
+  if (value && !value->IsObject()) {
+    throw_invalid_type(*value, "object", name);
+  }
+
+  return value;
+}
+
+const rapidjson::Value *Json_metadata::get_array(const char *name) const {
+  const auto value = get(name);
+
+  if (value && !value->IsArray()) {
+    throw_invalid_type(*value, "array", name);
+  }
+
+  return value;
+}
+
+shcore::Dictionary_t Json_metadata::get_map(const char *name) const {
+  const auto value = get_object(name);
+  return value ? to_value(*value).as_map() : nullptr;
+}
+
+std::string Json_metadata::as_string(const rapidjson::Value &value) {
+  if (!value.IsString()) {
+    throw_invalid_type(value, "string");
+  }
+
+  return {value.GetString(), value.GetStringLength()};
+}
+
+uint64_t Json_metadata::as_uint(const rapidjson::Value &value) {
+  if (!value.IsUint64()) {
+    throw_invalid_type(value, "unsigned integer");
+  }
+
+  return value.GetUint64();
+}
+
+shcore::Value Json_metadata::to_value(const rapidjson::Value &value) {
+  switch (value.GetType()) {
+    case rapidjson::kNullType:
+      return shcore::Value::Null();
+
+    case rapidjson::kFalseType:
+    case rapidjson::kTrueType:
+      return shcore::Value(value.GetBool());
+
+    case rapidjson::kObjectType: {
+      auto map = shcore::make_dict();
+
+      for (const auto &member : value.GetObject()) {
+        map->emplace(as_string(member.name), to_value(member.value));
+      }
+
+      return shcore::Value(std::move(map));
+    }
+
+    case rapidjson::kArrayType: {
+      auto array = shcore::make_array();
+      array->reserve(value.Size());
+
+      for (const auto &item : value.GetArray()) {
+        array->emplace_back(to_value(item));
+      }
+
+      return shcore::Value(std::move(array));
+    }
+
+    case rapidjson::kStringType:
+      return shcore::Value(as_string(value));
+
+    case rapidjson::kNumberType:
+      if (value.IsInt64()) {
+        return shcore::Value(static_cast<int64_t>(value.GetInt64()));
+      } else if (value.IsUint64()) {
+        return shcore::Value(static_cast<uint64_t>(value.GetUint64()));
+      } else {
+        return shcore::Value(value.GetDouble());
+      }
+  }
+
+  return {};
+}
+
+}  // namespace common
+}  // namespace dump
+}  // namespace mysqlsh
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_COMMON_DUMP_JSON_METADATA_H_
+#define MODULES_UTIL_COMMON_DUMP_JSON_METADATA_H_
+
+#include <rapidjson/document.h>
+#include <rapidjson/prettywriter.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "mysqlshdk/include/scripting/types.h"
+#include "mysqlshdk/libs/storage/ifile.h"
+
+namespace mysqlsh {
+namespace dump {
+namespace common {
+
+/**
+ * Writes a JSON metadata file directly to the output file, without building
+ * the document in memory first. Produces the same output as a
+ * rapidjson::Document serialized using rapidjson::PrettyWriter.
+ */
+class Json_file_writer final {
+ private:
+  class Output_stream final {
+   public:
+    using Ch = char;
+
+    explicit Output_stream(mysqlshdk::storage::IFile *file);
+
+    void Put(Ch c) {
+      m_buffer.push_back(c);
+
+      if (m_buffer.size() >= k_buffer_size) {
+        Flush();
+      }
+    }
+
+    void Flush();
+
+   private:
+    static constexpr std::size_t k_buffer_size = 64 * 1024;
+
+    mysqlshdk::storage::IFile *m_file;
+    std::string m_buffer;
+  };
+
+ public:
+  using Writer = rapidjson::PrettyWriter<Output_stream>;
+
+  explicit Json_file_writer(std::unique_ptr<mysqlshdk::storage::IFile> file);
+
+  Json_file_writer(const Json_file_writer &) = delete;
+  Json_file_writer(Json_file_writer &&) = delete;
+
+  Json_file_writer &operator=(const Json_file_writer &) = delete;
+  Json_file_writer &operator=(Json_file_writer &&) = delete;
+
+  ~Json_file_writer() = default;
+
+  /**
+   * Flushes the buffered data and closes the file.
+   */
+  void close();
+
+  Writer &json() { return m_writer; }
+
+  void start_object() { m_writer.StartObject(); }
+
+  void end_object() { m_writer.EndObject(); }
+
+  void start_array() { m_writer.StartArray(); }
+
+  void end_array() { m_writer.EndArray(); }
+
+  void key(std::string_view name) {
+    m_writer.Key(name.data(), static_cast<rapidjson::SizeType>(name.length()));
+  }
+
+  void value(std::string_view v) {
+    m_writer.String(v.data(), static_cast<rapidjson::SizeType>(v.length()));
+  }
+
+  void value(const char *v) { value(std::string_view{v}); }
+
+  void value(const std::string &v) { value(std::string_view{v}); }
+
+  void value(bool v) { m_writer.Bool(v); }
+
+  void value(uint64_t v) { m_writer.Uint64(v); }
+
+  template <typename T>
+  void member(std::string_view name, T &&v) {
+    key(name);
+    value(std::forward<T>(v));
+  }
+
+  /**
+   * Writes an array, calling `f(this, item)` for each item in the container.
+   */
+  template <typename C, typename F>
+  void array(std::string_view name, const C &container, F &&f) {
+    key(name);
+    start_array();
+
+    for (const auto &item : container) {
+      f(this, item);
+    }
+
+    end_array();
+  }
+
+ private:
+  std::unique_ptr<mysqlshdk::storage::IFile> m_file;
+  Output_stream m_stream;
+  Writer m_writer;
+};
+
+/**
+ * Provides access to the contents of a JSON metadata file, values are read
+ * directly from the parsed document, without converting it to shcore::Value.
+ *
+ * All methods throw std::invalid_argument if the file cannot be parsed or a
+ * value has an unexpected type.
+ */
+class Json_metadata final {
+ public:
+  Json_metadata() = delete;
+
+  explicit Json_metadata(const std::string &data);
+
+  Json_metadata(const Json_metadata &) = delete;
+  Json_metadata(Json_metadata &&) = default;
+
+  Json_metadata &operator=(const Json_metadata &) = delete;
+  Json_metadata &operator=(Json_metadata &&) = default;
+
+  ~Json_metadata() = default;
+
+  bool has(const char *name) const;
+
+  bool get_bool(const char *name, bool default_value) const;
+
+  std::string get_string(const char *name,
+                         const std::string &default_value = {}) const;
+
+  uint64_t get_uint(const char *name) const;
+
+  /**
+   * Returns nullptr if value does not exist or is null.
+   */
+  const rapidjson::Value *get_object(const char *name) const;
+
+  /**
+   * Returns nullptr if value does not exist or is null.
+   */
+  const rapidjson::Value *get_array(const char *name) const;
+
+  /**
+   * Converts an object to a dictionary, returns nullptr if value does not
+   * exist or is null.
+   */
+  shcore::Dictionary_t get_map(const char *name) const;
+
+  static std::string as_string(const rapidjson::Value &value);
+
+  static uint64_t as_uint(const rapidjson::Value &value);
+
+  static shcore::Value to_value(const rapidjson::Value &value);
+
+ private:
+  const rapidjson::Value *get(const char *name) const;
+
+  rapidjson::Document m_doc;
+};
+
+}  // namespace common
+}  // namespace dump
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_COMMON_DUMP_JSON_METADATA_H_
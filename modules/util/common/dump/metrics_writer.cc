@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/common/dump/metrics_writer.h"
+
+#include <cmath>
+#include <cstdio>
+#include <stdexcept>
+
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
+
+namespace mysqlsh {
+namespace dump {
+namespace common {
+
+namespace {
+
+const char *to_string(Metrics_writer::Type type) {
+  switch (type) {
+    case Metrics_writer::Type::COUNTER:
+      return "counter";
+
+    case Metrics_writer::Type::GAUGE:
+      return "gauge";
+  }
+
+  throw std::logic_error("Unknown metric type");
+}
+
+std::string escape(const std::string &s, bool quote) {
+  std::string result;
+  result.reserve(s.length());
+
+  for (const auto c : s) {
+    switch (c) {
+      case '\\':
+        result += "\\\\";
+        break;
+
+      case '\n':
+        result += "\\n";
+        break;
+
+      case '"':
+        if (quote) {
+          result += "\\\"";
+        } else {
+          result += c;
+        }
+        break;
+
+      default:
+        result += c;
+        break;
+    }
+  }
+
+  return result;
+}
+
+std::string format_value(double value) {
+  if (std::isnan(value)) {
+    return "NaN";
+  }
+
+  if (std::isinf(value)) {
+    return value > 0 ? "+Inf" : "-Inf";
+  }
+
+  char buffer[32];
+  snprintf(buffer, sizeof(buffer), "%.15g", value);
+
+  return buffer;
+}
+
+}  // namespace
+
+Metrics_writer::Metrics_writer(std::string path,
+                               std::chrono::milliseconds interval)
+    : m_path(std::move(path)), m_interval(interval) {}
+
+Metrics_writer::~Metrics_writer() {
+  try {
+    stop();
+  } catch (const std::exception &e) {
+    log_error("Failed to stop the metrics writer: %s", e.what());
+  }
+}
+
+void Metrics_writer::add(Type type, std::string name, std::string help,
+                         std::function<double()> value) {
+  m_metrics.emplace_back(Metric{
+      type, std::move(name), std::move(help), {}, [value = std::move(value)]() {
+        return std::vector<Sample>{{{}, value()}};
+      }});
+}
+
+void Metrics_writer::add(Type type, std::string name, std::string help,
+                         std::string label,
+                         std::function<std::vector<Sample>()> samples) {
+  m_metrics.emplace_back(Metric{type, std::move(name), std::move(help),
+                                std::move(label), std::move(samples)});
+}
+
+void Metrics_writer::start() {
+  if (m_thread.joinable()) {
+    throw std::logic_error("Metrics writer is already running");
+  }
+
+  m_stop = false;
+  m_thread = mysqlsh::spawn_scoped_thread([this]() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (!m_cv.wait_for(lock, m_interval, [this]() { return m_stop; })) {
+      write();
+    }
+  });
+}
+
+void Metrics_writer::stop() {
+  if (!m_thread.joinable()) {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+
+  m_cv.notify_one();
+  m_thread.join();
+
+  // final values
+  write();
+}
+
+std::string Metrics_writer::format() const {
+  std::string result;
+
+  for (const auto &metric : m_metrics) {
+    result += "# HELP ";
+    result += metric.name;
+    result += ' ';
+    result += escape(metric.help, false);
+    result += "\n# TYPE ";
+    result += metric.name;
+    result += ' ';
+    result += to_string(metric.type);
+    result += '\n';
+
+    for (const auto &sample : metric.samples()) {
+      result += metric.name;
+
+      if (!metric.label.empty()) {
+        result += '{';
+        result += metric.label;
+        result += "=\"";
+        result += escape(sample.label_value, true);
+        result += "\"}";
+      }
+
+      result += ' ';
+      result += format_value(sample.value);
+      result += '\n';
+    }
+  }
+
+  return result;
+}
+
+void Metrics_writer::write() const {
+  // write to a temporary file and then replace the output file, so that the
+  // readers never see a partial file
+  const auto tmp_path = m_path + ".tmp";
+
+  try {
+    if (!shcore::create_file(tmp_path, format(), true)) {
+      throw std::runtime_error("Could not write to '" + tmp_path +
+                               "': " + shcore::get_last_error());
+    }
+
+    shcore::rename_file(tmp_path, m_path);
+    m_write_failed = false;
+  } catch (const std::exception &e) {
+    // report the error once, operation continues
+    if (!m_write_failed) {
+      log_warning("Failed to write metrics file: %s", e.what());
+      m_write_failed = true;
+    }
+  }
+}
+
+}  // namespace common
+}  // namespace dump
+}  // namespace mysqlsh
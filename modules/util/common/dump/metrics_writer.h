@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_COMMON_DUMP_METRICS_WRITER_H_
+#define MODULES_UTIL_COMMON_DUMP_METRICS_WRITER_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace mysqlsh {
+namespace dump {
+namespace common {
+
+/**
+ * Periodically writes metrics of a long-running operation to a local file,
+ * using the Prometheus text-based exposition format. File is replaced
+ * atomically, readers never see a partially written file.
+ */
+class Metrics_writer final {
+ public:
+  enum class Type { COUNTER, GAUGE };
+
+  /**
+   * Single value of a metric, with an optional label.
+   */
+  struct Sample {
+    std::string label_value;
+    double value;
+  };
+
+  /**
+   * Creates the writer.
+   *
+   * @param path Path to the output file.
+   * @param interval How often the file is updated.
+   */
+  explicit Metrics_writer(
+      std::string path,
+      std::chrono::milliseconds interval = std::chrono::seconds{1});
+
+  Metrics_writer(const Metrics_writer &) = delete;
+  Metrics_writer(Metrics_writer &&) = delete;
+
+  Metrics_writer &operator=(const Metrics_writer &) = delete;
+  Metrics_writer &operator=(Metrics_writer &&) = delete;
+
+  ~Metrics_writer();
+
+  /**
+   * Registers a metric which has a single value.
+   *
+   * @param type Type of the metric.
+   * @param name Name of the metric.
+   * @param help Description of the metric.
+   * @param value Provides the current value, called from the writer thread.
+   */
+  void add(Type type, std::string name, std::string help,
+           std::function<double()> value);
+
+  /**
+   * Registers a metric which has multiple values, each one identified by the
+   * given label.
+   *
+   * @param type Type of the metric.
+   * @param name Name of the metric.
+   * @param help Description of the metric.
+   * @param label Name of the label.
+   * @param samples Provides the current values, called from the writer thread.
+   */
+  void add(Type type, std::string name, std::string help, std::string label,
+           std::function<std::vector<Sample>()> samples);
+
+  /**
+   * Starts the thread which periodically writes the metrics. All metrics need
+   * to be registered before this call.
+   */
+  void start();
+
+  /**
+   * Stops the writer thread and writes the final values of all metrics.
+   */
+  void stop();
+
+  /**
+   * Provides current values of all metrics, formatted.
+   */
+  std::string format() const;
+
+ private:
+  struct Metric {
+    Type type;
+    std::string name;
+    std::string help;
+    std::string label;
+    std::function<std::vector<Sample>()> samples;
+  };
+
+  void write() const;
+
+  std::string m_path;
+  std::chrono::milliseconds m_interval;
+  std::vector<Metric> m_metrics;
+
+  std::thread m_thread;
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  bool m_stop = false;
+  mutable bool m_write_failed = false;
+};
+
+}  // namespace common
+}  // namespace dump
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_COMMON_DUMP_METRICS_WRITER_H_
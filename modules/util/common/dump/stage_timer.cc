@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/common/dump/stage_timer.h"
+
+#include <cassert>
+#include <utility>
+
+#include "mysqlshdk/include/shellcore/console.h"
+#include "mysqlshdk/libs/storage/idirectory.h"
+#include "mysqlshdk/libs/utils/strformat.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+namespace mysqlsh {
+namespace dump {
+namespace common {
+
+namespace {
+
+thread_local Stage_timer *t_active_timer = nullptr;
+thread_local Stage_timer::Scope *t_current_scope = nullptr;
+
+/**
+ * Counts time spent in the IO operations towards the given stage.
+ */
+class Timed_file final : public mysqlshdk::storage::IFile {
+ public:
+  Timed_file(std::unique_ptr<mysqlshdk::storage::IFile> file, Stage stage)
+      : m_file(std::move(file)), m_stage(stage) {}
+
+  Timed_file(const Timed_file &other) = delete;
+  Timed_file(Timed_file &&other) = default;
+
+  Timed_file &operator=(const Timed_file &other) = delete;
+  Timed_file &operator=(Timed_file &&other) = default;
+
+  ~Timed_file() override = default;
+
+  void open(mysqlshdk::storage::Mode m) override {
+    Stage_timer::Scope scope{m_stage};
+    m_file->open(m);
+  }
+
+  bool is_open() const override { return m_file->is_open(); }
+
+  int error() const override { return m_file->error(); }
+
+  void close() override {
+    Stage_timer::Scope scope{m_stage};
+    m_file->close();
+  }
+
+  size_t file_size() const override { return m_file->file_size(); }
+
+  mysqlshdk::Masked_string full_path() const override {
+    return m_file->full_path();
+  }
+
+  std::string filename() const override { return m_file->filename(); }
+
+  bool exists() const override { return m_file->exists(); }
+
+  std::unique_ptr<mysqlshdk::storage::IDirectory> parent() const override {
+    return m_file->parent();
+  }
+
+  off64_t seek(off64_t offset) override {
+    Stage_timer::Scope scope{m_stage};
+    return m_file->seek(offset);
+  }
+
+  off64_t tell() const override { return m_file->tell(); }
+
+  ssize_t read(void *buffer, size_t length) override {
+    Stage_timer::Scope scope{m_stage};
+    return m_file->read(buffer, length);
+  }
+
+  ssize_t write(const void *buffer, size_t length) override {
+    Stage_timer::Scope scope{m_stage};
+    return m_file->write(buffer, length);
+  }
+
+  bool flush() override {
+    Stage_timer::Scope scope{m_stage};
+    return m_file->flush();
+  }
+
+  bool is_compressed() const override { return m_file->is_compressed(); }
+
+  bool is_local() const override { return m_file->is_local(); }
+
+  void rename(const std::string &new_name) override {
+    Stage_timer::Scope scope{m_stage};
+    m_file->rename(new_name);
+  }
+
+  void remove() override {
+    Stage_timer::Scope scope{m_stage};
+    m_file->remove();
+  }
+
+ private:
+  std::unique_ptr<mysqlshdk::storage::IFile> m_file;
+  Stage m_stage;
+};
+
+}  // namespace
+
+Stage_timer::Activate::Activate(Stage_timer *timer)
+    : m_previous(t_active_timer), m_previous_scope(t_current_scope) {
+  t_active_timer = timer;
+  t_current_scope = nullptr;
+}
+
+Stage_timer::Activate::~Activate() {
+  t_active_timer = m_previous;
+  t_current_scope = m_previous_scope;
+}
+
+Stage_timer::Scope::Scope(Stage stage, bool enabled)
+    : m_timer(enabled ? t_active_timer : nullptr), m_stage(stage) {
+  start();
+}
+
+Stage_timer::Scope::Scope(Stage stage, Sampler *sampler)
+    : m_timer(nullptr),
+      m_stage(stage),
+      m_weight(sampler ? sampler->next() : 0) {
+  if (m_weight) {
+    m_timer = t_active_timer;
+  }
+
+  start();
+}
+
+void Stage_timer::Scope::start() {
+  if (m_timer) {
+    m_parent = t_current_scope;
+    t_current_scope = this;
+    m_start = std::chrono::steady_clock::now();
+  }
+}
+
+Stage_timer::Scope::~Scope() {
+  if (m_timer) {
+    const uint64_t elapsed =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - m_start)
+            .count();
+
+    assert(this == t_current_scope);
+    t_current_scope = m_parent;
+
+    // nested scopes have already counted their own time
+    const auto own = (elapsed > m_nested_ns ? elapsed - m_nested_ns : 0) *
+                     m_weight;
+
+    if (m_parent) {
+      m_parent->m_nested_ns += own + m_nested_ns;
+    }
+
+    m_timer->add(m_stage, own);
+  }
+}
+
+void print_stage_summary(const Stage_timer *timers, std::size_t count,
+                         const std::vector<Stage_description> &stages) {
+  if (!timers || !count || stages.empty()) {
+    return;
+  }
+
+  std::vector<double> seconds;
+  seconds.reserve(stages.size());
+  double total = 0.0;
+
+  for (const auto &stage : stages) {
+    double s = 0.0;
+
+    for (std::size_t i = 0; i < count; ++i) {
+      s += timers[i].seconds(stage.stage);
+    }
+
+    seconds.emplace_back(s);
+    total += s;
+  }
+
+  if (total <= 0.0) {
+    return;
+  }
+
+  std::string breakdown;
+  std::size_t bottleneck = 0;
+
+  for (std::size_t i = 0; i < stages.size(); ++i) {
+    if (!breakdown.empty()) {
+      breakdown += ", ";
+    }
+
+    breakdown += shcore::str_format(
+        "%s %.1f%% (%s)", stages[i].name, 100.0 * seconds[i] / total,
+        mysqlshdk::utils::format_seconds(seconds[i], false).c_str());
+
+    if (seconds[i] > seconds[bottleneck]) {
+      bottleneck = i;
+    }
+  }
+
+  const auto console = current_console();
+
+  console->print_status("Worker time breakdown: " + breakdown);
+  console->print_status(shcore::str_format("Bottleneck: %s - %s",
+                                           stages[bottleneck].name,
+                                           stages[bottleneck].hint));
+}
+
+std::unique_ptr<mysqlshdk::storage::IFile> make_timed_file(
+    std::unique_ptr<mysqlshdk::storage::IFile> file, Stage stage) {
+  return std::make_unique<Timed_file>(std::move(file), stage);
+}
+
+}  // namespace common
+}  // namespace dump
+}  // namespace mysqlsh
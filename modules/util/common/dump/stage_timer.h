@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_COMMON_DUMP_STAGE_TIMER_H_
+#define MODULES_UTIL_COMMON_DUMP_STAGE_TIMER_H_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "mysqlshdk/libs/storage/compressed_file.h"
+#include "mysqlshdk/libs/storage/ifile.h"
+
+namespace mysqlsh {
+namespace dump {
+namespace common {
+
+/**
+ * Stages of the dump and load pipelines.
+ */
+enum class Stage {
+  SERVER,       // dump: fetching rows, load: executing LOAD DATA
+  ENCODING,     // dump: encoding rows
+  COMPRESSION,  // dump: compression, load: decompression
+  STORAGE,      // dump: writing/uploading, load: reading/downloading
+  INDEXES,      // load: recreating indexes
+  WAITING,      // load: waiting for the data read ahead, not reported
+};
+
+constexpr std::size_t k_stage_count =
+    static_cast<std::size_t>(Stage::WAITING) + 1;
+
+/**
+ * Operations executed for each row are measured once in this many rows.
+ */
+constexpr uint64_t k_row_sample_every = 64;
+
+/**
+ * Accumulates the time spent by a single worker in each of the stages. Time
+ * spent in a nested stage is not counted towards the enclosing one.
+ *
+ * Values can be read by any thread, they are updated by all the threads which
+ * activated this timer, i.e. the worker thread and its background threads.
+ */
+class Stage_timer final {
+ public:
+  class Scope;
+
+  Stage_timer() = default;
+
+  Stage_timer(const Stage_timer &) = delete;
+  Stage_timer(Stage_timer &&) = delete;
+
+  Stage_timer &operator=(const Stage_timer &) = delete;
+  Stage_timer &operator=(Stage_timer &&) = delete;
+
+  ~Stage_timer() = default;
+
+  uint64_t nanoseconds(Stage stage) const {
+    return m_ns[static_cast<std::size_t>(stage)].load(
+        std::memory_order_relaxed);
+  }
+
+  double seconds(Stage stage) const { return nanoseconds(stage) / 1e9; }
+
+  /**
+   * Makes the given timer active in the current thread, for the lifetime of
+   * this object.
+   */
+  class Activate final {
+   public:
+    explicit Activate(Stage_timer *timer);
+
+    Activate(const Activate &) = delete;
+    Activate(Activate &&) = delete;
+
+    Activate &operator=(const Activate &) = delete;
+    Activate &operator=(Activate &&) = delete;
+
+    ~Activate();
+
+   private:
+    Stage_timer *m_previous;
+    Scope *m_previous_scope;
+  };
+
+  /**
+   * Selects the executions of a frequent operation which are measured, so
+   * that the clock is not read each time it's executed. The first execution
+   * is always measured, then one in every given number of executions, with
+   * its time multiplied by that number.
+   */
+  class Sampler final {
+   public:
+    explicit Sampler(uint64_t every) : m_every(every ? every : 1) {}
+
+    /**
+     * Provides the weight of the next execution, 0 if it's not measured.
+     */
+    uint64_t next() {
+      const auto count = m_count++;
+
+      if (0 == count) {
+        return 1;
+      }
+
+      return 0 == count % m_every ? m_every : 0;
+    }
+
+   private:
+    uint64_t m_every;
+    uint64_t m_count = 0;
+  };
+
+  /**
+   * Measures the time spent in the given stage, for the lifetime of this
+   * object. Does nothing if it's not enabled or if there's no timer active in
+   * the current thread.
+   */
+  class Scope final {
+   public:
+    explicit Scope(Stage stage, bool enabled = true);
+
+    /**
+     * Measures the time only if the sampler is given and it selects this
+     * execution.
+     */
+    Scope(Stage stage, Sampler *sampler);
+
+    Scope(const Scope &) = delete;
+    Scope(Scope &&) = delete;
+
+    Scope &operator=(const Scope &) = delete;
+    Scope &operator=(Scope &&) = delete;
+
+    ~Scope();
+
+   private:
+    void start();
+
+    Stage_timer *m_timer;
+    Stage m_stage;
+    uint64_t m_weight = 1;
+    Scope *m_parent = nullptr;
+    std::chrono::steady_clock::time_point m_start;
+    uint64_t m_nested_ns = 0;
+  };
+
+ private:
+  void add(Stage stage, uint64_t ns) {
+    m_ns[static_cast<std::size_t>(stage)].fetch_add(ns,
+                                                   std::memory_order_relaxed);
+  }
+
+  std::array<std::atomic<uint64_t>, k_stage_count> m_ns{};
+};
+
+/**
+ * Describes a stage of a specific operation.
+ */
+struct Stage_description {
+  Stage stage;
+  const char *name;
+  // i.e. "fetching rows from the server"
+  const char *description;
+  // advice given when this stage is the bottleneck
+  const char *hint;
+};
+
+/**
+ * Prints the time spent by all the workers in each of the given stages, and
+ * the stage which took the most time.
+ *
+ * @param timers Timers of all the workers.
+ * @param count Number of workers.
+ * @param stages Stages to be reported.
+ */
+void print_stage_summary(const Stage_timer *timers, std::size_t count,
+                         const std::vector<Stage_description> &stages);
+
+/**
+ * Wraps the given file, so that time spent in its operations is counted
+ * towards the given stage.
+ *
+ * NOTE: The wrapped file is hidden from the code which checks the type of a
+ * file, i.e. compressed local files would no longer use memory-mapped IO.
+ *
+ * @param file File to be wrapped.
+ * @param stage Stage to be measured.
+ *
+ * @returns Wrapped file.
+ */
+std::unique_ptr<mysqlshdk::storage::IFile> make_timed_file(
+    std::unique_ptr<mysqlshdk::storage::IFile> file,
+    Stage stage = Stage::STORAGE);
+
+}  // namespace common
+}  // namespace dump
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_COMMON_DUMP_STAGE_TIMER_H_
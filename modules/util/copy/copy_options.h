@@ -106,6 +106,8 @@ class Copy_options {
 
     // always disable load progress, to make output more readable
     m_load_options.set_show_progress(false);
+    // metrics are reported by the dumper, both sides would write the same file
+    m_load_options.set_metrics_file({});
 
     // make sure we don't use too many background threads
     m_load_options.set_background_threads_count(m_load_options.threads_count());
@@ -23,6 +23,7 @@
 
 #include "modules/util/dump/compatibility.h"
 
+#include <algorithm>
 #include <regex>
 #include <unordered_map>
 #include <utility>
@@ -113,26 +114,13 @@ std::string replace_at_offsets(const std::string &s, const Offsets &offsets,
   return out;
 }
 
-std::string comment_out_offsets(const std::string &s, const Coffsets &offsets) {
-  if (offsets.empty()) return s;
-
-  std::size_t pos = 0;
-  std::string out;
-  for (const auto &o : offsets) {
-    out += s.substr(pos, o.offset.first - pos);
-    if (o.inside_hint) {
-      auto ol = shcore::str_rstrip(shcore::str_replace(
-          s.substr(o.offset.first, o.offset.second - o.offset.first), "\n",
-          " "));
-      out += "-- " + ol + "\n";
-    } else {
-      out += "/* " +
-             s.substr(o.offset.first, o.offset.second - o.offset.first) + "*/ ";
-    }
-    pos = o.offset.second;
+std::string comment_out(std::string_view s, bool inside_hint) {
+  if (inside_hint) {
+    return "-- " + shcore::str_rstrip(shcore::str_replace(s, "\n", " ")) +
+           "\n";
+  } else {
+    return "/* " + std::string{s} + "*/ ";
   }
-  out += s.substr(pos);
-  return out;
 }
 
 std::size_t eat_string_val(const std::string &s, std::size_t i) {
@@ -142,7 +130,8 @@ std::size_t eat_string_val(const std::string &s, std::size_t i) {
   return std::string::npos;
 }
 
-void skip_columns_definition(SQL_iterator *it) {
+template <class Iterator>
+void skip_columns_definition(Iterator *it) {
   if (!shcore::str_caseeq(it->next_token(), "CREATE") ||
       !shcore::str_caseeq(it->next_token(), "TABLE"))
     throw std::runtime_error("Malformed create table statement");
@@ -155,12 +144,133 @@ void skip_columns_definition(SQL_iterator *it) {
         "Malformed create table statement - columns definition not found");
 }
 
-bool comment_out_option_with_string(
-    const std::string &s, std::string *rewritten,
-    std::function<bool(std::string_view *token, SQL_iterator *it)>
-        skip_condition) {
+inline bool is_quote(char c) { return '\'' == c || '"' == c || '`' == c; }
+
+void unquote_string(std::string *s) {
+  if (!s->empty() && is_quote((*s)[0])) {
+    *s = shcore::unquote_string(*s, (*s)[0]);
+  }
+}
+
+std::string get_account(SQL_iterator *it) {
+  auto user = it->next_token();  // IF or user
+
+  if (shcore::str_caseeq(user, "IF")) {
+    it->next_token();         // NOT
+    it->next_token();         // EXISTS
+    user = it->next_token();  // user
+  }
+
+  assert(!user.empty());
+  const size_t pos = it->position();
+
+  // The host part can be omitted for the role name (defaults to '%')
+  if (it->next_token() != "@") {
+    it->set_position(pos);
+    return std::string{user};
+  }
+
+  const auto host = it->next_token();
+  assert(!host.empty());
+  return std::string{user} + "@" + std::string{host};
+}
+
+/**
+ * Expects iterator to CREATE USER statement, will stop after account is found.
+ *
+ * @returns account parsed from the CREATE USER statement
+ */
+std::string create_user_parse_account(SQL_iterator *it) {
+  if (!shcore::str_caseeq(it->next_token(), "CREATE") ||
+      !shcore::str_caseeq(it->next_token(), "USER")) {
+    throw std::runtime_error(
+        "This check can be only performed on CREATE USER statements");
+  }
+
+  return get_account(it);
+}
+
+}  // namespace
+
+/**
+ * Iterates over the tokens of a Create_table_statement, provides the subset of
+ * SQL_iterator's interface used by the checks.
+ */
+class Create_table_statement::Iterator final {
+ public:
+  explicit Iterator(const Create_table_statement &statement,
+                    std::size_t offset = 0, bool skip_quoted = true)
+      : m_statement(statement.m_statement),
+        m_tokens(statement.m_tokens),
+        m_skip_quoted(skip_quoted) {
+    set_position(offset);
+  }
+
+  std::size_t position() const { return m_position; }
+
+  void set_position(std::size_t position) {
+    m_position = position;
+    m_next = std::lower_bound(m_tokens.begin(), m_tokens.end(), position,
+                              [](const Token &t, std::size_t p) {
+                                return t.begin < p;
+                              }) -
+             m_tokens.begin();
+  }
+
+  bool valid() const { return m_position < m_statement.length(); }
+
+  bool inside_hint() const { return m_inside_hint; }
+
+  std::string_view next_token() {
+    while (m_next < m_tokens.size()) {
+      const auto &token = m_tokens[m_next++];
+
+      if (m_skip_quoted && is_quote(m_statement[token.begin])) {
+        continue;
+      }
+
+      m_position = token.position;
+      m_inside_hint = token.inside_hint;
+
+      return m_statement.substr(token.begin, token.length);
+    }
+
+    m_position = m_statement.length();
+
+    return {};
+  }
+
+ private:
+  std::string_view m_statement;
+  const std::vector<Token> &m_tokens;
+  bool m_skip_quoted;
+  std::size_t m_next = 0;
+  std::size_t m_position = 0;
+  bool m_inside_hint = false;
+};
+
+Create_table_statement::Create_table_statement(std::string statement)
+    : m_statement(std::move(statement)) {
+  // quoted strings and identifiers are also stored, checks which are not
+  // interested in them skip these tokens
+  SQL_iterator it(m_statement, 0, false);
+
+  while (true) {
+    const auto [token, begin] = it.next_token_and_offset();
+
+    if (token.empty()) break;
+
+    m_tokens.emplace_back(
+        Token{begin, token.length(), it.position(), it.inside_hint()});
+  }
+}
+
+bool Create_table_statement::comment_out_option_with_string(
+    bool fix, const std::function<bool(std::string_view *token, Iterator *it)>
+                  &skip_condition) {
+  const auto &s = m_statement;
   Coffsets offsets;
-  SQL_iterator it(s, 12);
+  Iterator it(*this, 12);
   std::size_t prev_pos = 0, end = 0;
   auto token = it.next_token();
   bool prev_added = false;
@@ -193,57 +303,225 @@ bool comment_out_option_with_string(
     prev_added = true;
   }
 
-  if (rewritten) *rewritten = comment_out_offsets(s, offsets);
+  if (fix) {
+    for (const auto &o : offsets) {
+      m_edits.emplace_back(Edit{o.offset.first, o.offset.second,
+                                o.inside_hint
+                                    ? Edit::Type::COMMENT_OUT_INSIDE_HINT
+                                    : Edit::Type::COMMENT_OUT,
+                                {}});
+    }
+  }
+
   return !offsets.empty();
 }
 
-inline bool is_quote(char c) { return '\'' == c || '"' == c || '`' == c; }
+bool Create_table_statement::check_data_index_dir_option(bool fix) {
+  return comment_out_option_with_string(
+      fix, [](std::string_view *token, Iterator *it) {
+        if (!shcore::str_caseeq(*token, "DATA", "INDEX")) return true;
+        *token = it->next_token();
+        return !shcore::str_caseeq(*token, "DIRECTORY");
+      });
+}
 
-void unquote_string(std::string *s) {
-  if (!s->empty() && is_quote((*s)[0])) {
-    *s = shcore::unquote_string(*s, (*s)[0]);
+bool Create_table_statement::check_encryption_option(bool fix) {
+  return comment_out_option_with_string(
+      fix, [](std::string_view *token, Iterator *it) {
+        if (shcore::str_caseeq(*token, "DEFAULT")) *token = it->next_token();
+        return !shcore::str_caseeq(*token, "ENCRYPTION");
+      });
+}
+
+std::string Create_table_statement::check_engine_option(
+    const std::string &target, bool fix) {
+  std::string res;
+  Iterator it(*this);
+  skip_columns_definition(&it);
+  std::string_view token;
+  while (!(token = it.next_token()).empty()) {
+    if (!shcore::str_caseeq(token, "ENGINE")) continue;
+    auto name = it.next_token();
+    if (name == "=") name = it.next_token();
+    if (shcore::str_caseeq(name, target)) continue;
+    if (fix) {
+      m_edits.emplace_back(Edit{it.position() - name.length(), it.position(),
+                                Edit::Type::REPLACE, target});
+    }
+    res = name;
   }
+
+  return res;
 }
 
-std::string get_account(SQL_iterator *it) {
-  auto user = it->next_token();  // IF or user
+bool Create_table_statement::check_tablespace_option(
+    const std::vector<std::string> &whitelist, bool fix) {
+  const auto &create_table = m_statement;
+  Offsets offsets;
+  Iterator it(*this, 0, false);
+  skip_columns_definition(&it);
+  std::size_t prev_pos = 0;
+  std::string_view token;
+  while (!(token = it.next_token()).empty()) {
+    if (!shcore::str_caseeq(token, "TABLESPACE")) {
+      prev_pos = it.position() - token.size();
+      continue;
+    }
+    auto start = it.position() - token.size();
+    auto name = it.next_token();
+    if (name == "=") name = it.next_token();
 
-  if (shcore::str_caseeq(user, "IF")) {
-    it->next_token();         // NOT
-    it->next_token();         // EXISTS
-    user = it->next_token();  // user
-  }
+    // Leave whitelisted tablespaces
+    size_t iw = 0;
+    std::string_view n = name;
 
-  assert(!user.empty());
-  const size_t pos = it->position();
+    if (n[0] == '`') {
+      n.remove_prefix(1);
+    }
 
-  // The host part can be omitted for the role name (defaults to '%')
-  if (it->next_token() != "@") {
-    it->set_position(pos);
-    return std::string{user};
+    for (; iw < whitelist.size(); ++iw) {
+      if (shcore::str_ibeginswith(n, whitelist[iw])) {
+        break;
+      }
+    }
+    if (iw < whitelist.size()) continue;
+
+    // Find if option encompassed by comment hint '/*!50100 '
+    if (it.inside_hint() && create_table.compare(start - 9, 3, "/*!") == 0) {
+      start -= 9;
+      auto end = mysqlshdk::utils::span_cstyle_sql_comment(create_table, start);
+      offsets.emplace_back(create_table[prev_pos] == ',' ? prev_pos : start,
+                           end);
+      it.set_position(end);
+      continue;
+    }
+
+    auto end = it.position();
+    if (shcore::str_caseeq("STORAGE", it.next_token())) {
+      // either DISK or MEMORY
+      it.next_token();
+      end = it.position();
+    }
+    offsets.emplace_back(create_table[prev_pos] == ',' ? prev_pos : start, end);
   }
 
-  const auto host = it->next_token();
-  assert(!host.empty());
-  return std::string{user} + "@" + std::string{host};
+  if (fix) {
+    for (const auto &o : offsets) {
+      m_edits.emplace_back(Edit{o.first, o.second, Edit::Type::REPLACE, {}});
+    }
+  }
+
+  return !offsets.empty();
 }
 
-/**
- * Expects iterator to CREATE USER statement, will stop after account is found.
- *
- * @returns account parsed from the CREATE USER statement
- */
-std::string create_user_parse_account(SQL_iterator *it) {
-  if (!shcore::str_caseeq(it->next_token(), "CREATE") ||
-      !shcore::str_caseeq(it->next_token(), "USER")) {
-    throw std::runtime_error(
-        "This check can be only performed on CREATE USER statements");
+bool Create_table_statement::check_fixed_row_format(bool fix) {
+  Offsets offsets;
+  Iterator it(*this);
+
+  skip_columns_definition(&it);
+
+  while (it.valid()) {
+    auto token = it.next_token();
+
+    if (shcore::str_caseeq(token, "ROW_FORMAT")) {
+      Offset offset;
+
+      offset.first = it.position() - token.length();
+
+      token = it.next_token();
+
+      if (shcore::str_caseeq(token, "=")) {
+        token = it.next_token();
+      }
+
+      if (shcore::str_caseeq(token, "FIXED")) {
+        offset.second = it.position();
+
+        // consume comma, if it's there
+        if (shcore::str_caseeq(it.next_token(), ",")) {
+          offset.second = it.position();
+        }
+
+        offsets.emplace_back(std::move(offset));
+      }
+
+      // no need to parse the rest
+      break;
+    }
   }
 
-  return get_account(it);
+  if (fix) {
+    for (const auto &o : offsets) {
+      m_edits.emplace_back(Edit{o.first, o.second, Edit::Type::REPLACE, {}});
+    }
+
+    // if new statement ends with comma, strip it as well
+    m_strip_trailing_comma = true;
+  }
+
+  return !offsets.empty();
 }
 
-}  // namespace
+std::string Create_table_statement::rewrite() const {
+  if (!modified()) return m_statement;
+
+  std::vector<const Edit *> edits;
+  edits.reserve(m_edits.size());
+
+  for (const auto &edit : m_edits) {
+    edits.emplace_back(&edit);
+  }
+
+  std::stable_sort(
+      edits.begin(), edits.end(),
+      [](const Edit *l, const Edit *r) { return l->begin < r->begin; });
+
+  std::string out;
+  out.reserve(m_statement.size());
+
+  std::size_t pos = 0;
+
+  for (const auto edit : edits) {
+    auto begin = edit->begin;
+
+    if (begin < pos) {
+      // changes recorded by different checks can overlap, i.e. when both of
+      // them include the same comma, the overlapping part is changed once
+      if (edit->end <= pos) continue;
+
+      begin = pos;
+    }
+
+    out.append(m_statement, pos, begin - pos);
+
+    const auto text =
+        std::string_view{m_statement}.substr(begin, edit->end - begin);
+
+    switch (edit->type) {
+      case Edit::Type::REPLACE:
+        out += edit->replacement;
+        break;
+
+      case Edit::Type::COMMENT_OUT:
+        out += comment_out(text, false);
+        break;
+
+      case Edit::Type::COMMENT_OUT_INSIDE_HINT:
+        out += comment_out(text, true);
+        break;
+    }
+
+    pos = edit->end;
+  }
+
+  out.append(m_statement, pos);
+
+  if (m_strip_trailing_comma) {
+    out = shcore::str_strip(out, " \r\n\t,");
+  }
+
+  return out;
+}
 
 std::vector<std::string> check_privileges(
     const std::string &grant, std::string *out_rewritten_grant,
@@ -499,162 +777,46 @@ std::string_view is_grant_on_object_from_mysql_schema(
 
 bool check_create_table_for_data_index_dir_option(
     const std::string &create_table, std::string *rewritten) {
-  /*
-        First, comment out DATA|INDEX DIRECTORY = '...', but note:
-         - Optional preceding and trailing commas.
-         - Optional assignment operator.
-         - Path enclosed in single quotes.
-         - Use of ungreedy patterns to get correct grouping.
-     */
-  //  std::regex directory_option(
-  //      "\\s*,?\\s*(DATA|INDEX)\\s+DIRECTORY\\s*?=?\\s*?[\"'][^\"']+?[\"']\\s*,"
-  //      "?"
-  //      "\\s*",
-  //      std::regex::icase | std::regex::nosubs);
-  //  auto q = std::regex_replace(create_table, directory_option, " /*$&*/ ");
-  //  bool res = q != create_table;
-  //  if (rewritten) *rewritten = q;
-  //  return res;
-
-  return comment_out_option_with_string(
-      create_table, rewritten, [](std::string_view *token, SQL_iterator *it) {
-        if (!shcore::str_caseeq(*token, "DATA", "INDEX")) return true;
-        *token = it->next_token();
-        return !shcore::str_caseeq(*token, "DIRECTORY");
-      });
+  Create_table_statement statement{create_table};
+  const auto result =
+      statement.check_data_index_dir_option(nullptr != rewritten);
+  if (rewritten) *rewritten = statement.rewrite();
+  return result;
 }
 
 bool check_create_table_for_encryption_option(const std::string &create_table,
                                               std::string *rewritten) {
-  // Comment out ENCRYPTION option.
-
-  return comment_out_option_with_string(
-      create_table, rewritten, [](std::string_view *token, SQL_iterator *it) {
-        if (shcore::str_caseeq(*token, "DEFAULT")) *token = it->next_token();
-        return !shcore::str_caseeq(*token, "ENCRYPTION");
-      });
+  Create_table_statement statement{create_table};
+  const auto result = statement.check_encryption_option(nullptr != rewritten);
+  if (rewritten) *rewritten = statement.rewrite();
+  return result;
 }
 
 std::string check_create_table_for_engine_option(
     const std::string &create_table, std::string *rewritten,
     const std::string &target) {
-  std::string res;
-  Offsets offsets;
-  SQL_iterator it(create_table);
-  skip_columns_definition(&it);
-  std::string token;
-  while (!(token = it.next_token()).empty()) {
-    if (!shcore::str_caseeq(token, "ENGINE")) continue;
-    auto name = it.next_token();
-    if (name == "=") name = it.next_token();
-    if (shcore::str_caseeq(name, target)) continue;
-    offsets.emplace_back(it.position() - name.length(), it.position());
-    res = name;
-  }
-
-  if (rewritten) *rewritten = replace_at_offsets(create_table, offsets, target);
-  return res;
+  Create_table_statement statement{create_table};
+  auto result = statement.check_engine_option(target, nullptr != rewritten);
+  if (rewritten) *rewritten = statement.rewrite();
+  return result;
 }
 
 bool check_create_table_for_tablespace_option(
     const std::string &create_table, std::string *rewritten,
     const std::vector<std::string> &whitelist) {
-  Offsets offsets;
-  SQL_iterator it(create_table, 0, false);
-  skip_columns_definition(&it);
-  std::size_t prev_pos = 0;
-  std::string token;
-  while (!(token = it.next_token()).empty()) {
-    if (!shcore::str_caseeq(token, "TABLESPACE")) {
-      prev_pos = it.position() - token.size();
-      continue;
-    }
-    auto start = it.position() - token.size();
-    auto name = it.next_token();
-    if (name == "=") name = it.next_token();
-
-    // Leave whitelisted tablespaces
-    size_t iw = 0;
-    std::string_view n = name;
-
-    if (n[0] == '`') {
-      n.remove_prefix(1);
-    }
-
-    for (; iw < whitelist.size(); ++iw) {
-      if (shcore::str_ibeginswith(n, whitelist[iw])) {
-        break;
-      }
-    }
-    if (iw < whitelist.size()) continue;
-
-    // Find if option encompassed by comment hint '/*!50100 '
-    if (it.inside_hint() && create_table.compare(start - 9, 3, "/*!") == 0) {
-      start -= 9;
-      auto end = mysqlshdk::utils::span_cstyle_sql_comment(create_table, start);
-      offsets.emplace_back(create_table[prev_pos] == ',' ? prev_pos : start,
-                           end);
-      it.set_position(end);
-      continue;
-    }
-
-    auto end = it.position();
-    if (shcore::str_caseeq("STORAGE", it.next_token())) {
-      // either DISK or MEMORY
-      it.next_token();
-      end = it.position();
-    }
-    offsets.emplace_back(create_table[prev_pos] == ',' ? prev_pos : start, end);
-  }
-
-  if (rewritten) *rewritten = replace_at_offsets(create_table, offsets, "");
-
-  return !offsets.empty();
+  Create_table_statement statement{create_table};
+  const auto result =
+      statement.check_tablespace_option(whitelist, nullptr != rewritten);
+  if (rewritten) *rewritten = statement.rewrite();
+  return result;
 }
 
 bool check_create_table_for_fixed_row_format(const std::string &create_table,
                                              std::string *rewritten) {
-  Offsets offsets;
-  SQL_iterator it(create_table);
-
-  skip_columns_definition(&it);
-
-  while (it.valid()) {
-    auto token = it.next_token();
-
-    if (shcore::str_caseeq(token, "ROW_FORMAT")) {
-      Offset offset;
-
-      offset.first = it.position() - token.length();
-
-      token = it.next_token();
-
-      if (shcore::str_caseeq(token, "=")) {
-        token = it.next_token();
-      }
-
-      if (shcore::str_caseeq(token, "FIXED")) {
-        offset.second = it.position();
-
-        // consume comma, if it's there
-        if (shcore::str_caseeq(it.next_token(), ",")) {
-          offset.second = it.position();
-        }
-
-        offsets.emplace_back(std::move(offset));
-      }
-
-      // no need to parse the rest
-      break;
-    }
-  }
-
-  // if new statement ends with comma, strip it as well
-  if (rewritten)
-    *rewritten = shcore::str_strip(
-        replace_at_offsets(create_table, offsets, ""), " \r\n\t,");
-
-  return !offsets.empty();
+  Create_table_statement statement{create_table};
+  const auto result = statement.check_fixed_row_format(nullptr != rewritten);
+  if (rewritten) *rewritten = statement.rewrite();
+  return result;
 }
 
 std::vector<std::string> check_statement_for_charset_option(
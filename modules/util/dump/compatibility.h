@@ -71,6 +71,95 @@ struct Deferred_statements {
   bool empty() const { return !has_alters() && secondary_engine.empty(); }
 };
 
+/**
+ * CREATE TABLE statement which is tokenized once and then checked for several
+ * compatibility issues. Checks only record the changes to be made, statement
+ * is rewritten in a single pass, once all the checks are done.
+ *
+ * The check_create_table_for_*() functions are using this class, results of
+ * all checks called on a single instance are the same as results of calling
+ * these functions one after another, except for the whitespace surrounding
+ * adjacent changes.
+ */
+class Create_table_statement final {
+ public:
+  explicit Create_table_statement(std::string statement);
+
+  const std::string &statement() const { return m_statement; }
+
+  /**
+   * Checks for DATA|INDEX DIRECTORY options, comments them out if fix is set.
+   */
+  bool check_data_index_dir_option(bool fix);
+
+  /**
+   * Checks for ENCRYPTION option, comments it out if fix is set.
+   */
+  bool check_encryption_option(bool fix);
+
+  /**
+   * Checks for ENGINE options which do not use the target engine, replaces
+   * them if fix is set.
+   *
+   * @returns name of the unsupported engine or an empty string
+   */
+  std::string check_engine_option(const std::string &target, bool fix);
+
+  /**
+   * Checks for TABLESPACE options which do not use one of the whitelisted
+   * tablespace prefixes, removes them if fix is set.
+   */
+  bool check_tablespace_option(const std::vector<std::string> &whitelist,
+                               bool fix);
+
+  /**
+   * Checks for ROW_FORMAT=FIXED option, removes it if fix is set.
+   */
+  bool check_fixed_row_format(bool fix);
+
+  /**
+   * Whether any of the checks requested a change.
+   */
+  bool modified() const {
+    return !m_edits.empty() || m_strip_trailing_comma;
+  }
+
+  /**
+   * Applies all the recorded changes.
+   */
+  std::string rewrite() const;
+
+ private:
+  class Iterator;
+
+  struct Token {
+    std::size_t begin;
+    std::size_t length;
+    // position of the iterator after this token was read
+    std::size_t position;
+    bool inside_hint;
+  };
+
+  struct Edit {
+    enum class Type { REPLACE, COMMENT_OUT, COMMENT_OUT_INSIDE_HINT };
+
+    std::size_t begin;
+    std::size_t end;
+    Type type;
+    std::string replacement;
+  };
+
+  bool comment_out_option_with_string(
+      bool fix,
+      const std::function<bool(std::string_view *token, Iterator *it)>
+          &skip_condition);
+
+  std::string m_statement;
+  std::vector<Token> m_tokens;
+  std::vector<Edit> m_edits;
+  bool m_strip_trailing_comma = false;
+};
+
 /// Checks grant statement for presence of privileges, returns found ones.
 std::vector<std::string> check_privileges(
     const std::string &grant, std::string *out_rewritten_grant = nullptr,
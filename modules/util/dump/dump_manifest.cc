@@ -23,6 +23,7 @@
 
 #include "modules/util/dump/dump_manifest.h"
 
+#include <algorithm>
 #include <chrono>
 #include <ctime>
 #include <stdexcept>
@@ -45,6 +46,7 @@ static constexpr auto k_at_manifest_json = "@.manifest.json";
 static constexpr auto k_par_prefix = "shell-dump-";
 static constexpr auto k_dumping_suffix = ".dumping";
 static constexpr auto k_at_done_json = "@.done.json";
+static constexpr auto k_manifest_segment_format = "@.manifest.%zu.json";
 
 namespace mysqlsh {
 namespace dump {
@@ -61,6 +63,30 @@ using mysqlshdk::storage::Mode;
 
 namespace {
 
+// number of PARs written to a single manifest segment
+constexpr std::size_t k_manifest_segment_size = 1000;
+
+// number of threads creating the PARs
+constexpr std::size_t k_par_threads = 8;
+
+// manifest is flushed at most every five seconds, this interval is increased
+// if flushing takes a long time, so that it does not dominate the execution
+constexpr std::chrono::milliseconds k_min_flush_interval{5000};
+constexpr int k_flush_interval_factor = 10;
+
+void append_par(const mysqlshdk::oci::PAR &par, shcore::JSON_dumper *json) {
+  json->start_object();
+  json->append_string("parId");
+  json->append_string(par.id);
+  json->append_string("parUrl");
+  json->append_string(par.access_uri);
+  json->append_string("objectName");
+  json->append_string(par.object_name);
+  json->append_string("objectSize");
+  json->append_int(static_cast<int>(par.size));
+  json->end_object();
+}
+
 class Dump_manifest_object
     : public mysqlshdk::storage::backend::object_storage::Object {
  public:
@@ -95,13 +121,12 @@ class Dump_manifest_object
   std::unique_ptr<mysqlshdk::storage::IDirectory> parent() const override;
 
  private:
-  void create_par();
   std::string object_name() const;
 
   std::shared_ptr<Manifest_writer> m_writer;
-  std::unique_ptr<std::thread> m_par_thread;
+  std::future<mysqlshdk::oci::PAR> m_par_future;
   std::unique_ptr<mysqlshdk::oci::PAR> m_par;
-  std::string m_par_thread_error;
+  std::string m_par_error;
   Dump_manifest_write_config_ptr m_config;
 };
 
@@ -113,16 +138,18 @@ Dump_manifest_object::Dump_manifest_object(
 
 void Dump_manifest_object::open(mysqlshdk::storage::Mode mode) {
   // The PAR creation is done in parallel
-  m_par_thread = std::make_unique<std::thread>(
-      mysqlsh::spawn_scoped_thread([this]() { create_par(); }));
+  m_par_future = m_writer->create_par(object_name());
 
   Object::open(mode);
 }
 
 void Dump_manifest_object::close() {
-  if (m_par_thread) {
-    m_par_thread->join();
-    m_par_thread.reset();
+  if (m_par_future.valid()) {
+    try {
+      m_par = std::make_unique<mysqlshdk::oci::PAR>(m_par_future.get());
+    } catch (const std::exception &error) {
+      m_par_error = error.what();
+    }
 
     // Getting the file size when a writer is open takes the value from the
     // writer rather than sending another request to the server
@@ -152,32 +179,7 @@ void Dump_manifest_object::close() {
   // throw only after everything is cleaned up
   if (!m_par) {
     THROW_ERROR(SHERR_DUMP_MANIFEST_PAR_CREATION_FAILED, object_name().c_str(),
-                m_par_thread_error.c_str());
-  }
-}
-
-void Dump_manifest_object::create_par() {
-  const auto name = object_name();
-
-  try {
-    FI_TRIGGER_TRAP(par_manifest,
-                    mysqlshdk::utils::FI::Trigger_options({{"name", name}}));
-
-    const auto bucket = m_config->oci_bucket();
-    const auto par_name = k_par_prefix + name;
-
-    auto par = bucket->create_pre_authenticated_request(
-        mysqlshdk::oci::PAR_access_type::OBJECT_READ,
-        m_config->par_expire_time(), par_name, name);
-    m_par = std::make_unique<mysqlshdk::oci::PAR>(std::move(par));
-  } catch (const mysqlshdk::rest::Response_error &error) {
-    m_par_thread_error = error.what();
-    log_error("Error creating PAR for object '%s': %s", name.c_str(),
-              error.what());
-  } catch (const mysqlshdk::rest::Connection_error &error) {
-    m_par_thread_error = error.what();
-    log_error("Error creating PAR for object '%s': %s", name.c_str(),
-              error.what());
+                m_par_error.c_str());
   }
 }
 
@@ -278,18 +280,27 @@ const IDirectory::File_info &Manifest_base::get_object(
   }
 }
 
-Manifest_writer::Manifest_writer(
-    std::unique_ptr<mysqlshdk::storage::IFile> file_handle,
-    const std::string &base_name, const std::string &par_expire_time)
-    : Manifest_base(std::move(file_handle), base_name),
-      m_par_expire_time(par_expire_time) {
+Manifest_writer::Manifest_writer(const Dump_manifest_write_config_ptr &config,
+                                 const std::string &base_name)
+    : Manifest_base(
+          mysqlshdk::storage::backend::object_storage::Directory(config,
+                                                                 base_name)
+              .file(k_at_manifest_json),
+          base_name),
+      m_config(config),
+      m_flush_interval(k_min_flush_interval) {
+  start_par_workers();
+
   m_par_thread =
       std::make_unique<std::thread>(mysqlsh::spawn_scoped_thread([this]() {
-        const auto five_seconds = std::chrono::milliseconds(5000);
         auto last_update = std::chrono::system_clock::now();
-        auto wait_for = five_seconds;
+        auto wait_for = m_flush_interval;
         size_t last_count = 0;
         bool test = false;
+        const auto par_count = [this]() {
+          return m_segments.size() * k_manifest_segment_size +
+                 m_par_cache.size();
+        };
 
         m_start_time = shcore::current_time_rfc3339();
 
@@ -320,11 +331,10 @@ Manifest_writer::Manifest_writer(
             // The manifest will be flushed
             // - When the first PAR arrives
             // - When close() is called
-            // - Or if waited for five seconds and new PARs arrived in the
-            //   mean time
+            // - Or if waited for the flush interval (at least five seconds)
+            //   and new PARs arrived in the mean time
             if (last_count == 0 ||
-                (waited_for >= five_seconds &&
-                 last_count < m_par_cache.size()) ||
+                (waited_for >= m_flush_interval && last_count < par_count()) ||
                 is_complete()) {
               last_update = std::chrono::system_clock::now();
               try {
@@ -334,16 +344,74 @@ Manifest_writer::Manifest_writer(
                     "Error flushing dump manifest: %s", error.what());
                 break;
               }
-              last_count = m_par_cache.size();
-              wait_for = five_seconds;
+              last_count = par_count();
+              wait_for = m_flush_interval;
             } else {
-              wait_for = five_seconds - waited_for;
+              wait_for = m_flush_interval - waited_for;
             }
           }
         }
       }));
 }
 
+Manifest_writer::~Manifest_writer() {
+  try {
+    finalize();
+  } catch (const std::exception &error) {
+    log_error("Error finalizing dump manifest: %s", error.what());
+  }
+
+  stop_par_workers();
+}
+
+std::future<mysqlshdk::oci::PAR> Manifest_writer::create_par(
+    const std::string &object_name) {
+  auto promise = std::make_shared<std::promise<mysqlshdk::oci::PAR>>();
+  auto future = promise->get_future();
+
+  m_par_requests.push([this, object_name, promise = std::move(promise)](
+                          mysqlshdk::oci::Oci_bucket *bucket) {
+    try {
+      FI_TRIGGER_TRAP(par_manifest, mysqlshdk::utils::FI::Trigger_options(
+                                        {{"name", object_name}}));
+
+      promise->set_value(bucket->create_pre_authenticated_request(
+          mysqlshdk::oci::PAR_access_type::OBJECT_READ,
+          m_config->par_expire_time(), k_par_prefix + object_name,
+          object_name));
+    } catch (const std::exception &error) {
+      log_error("Error creating PAR for object '%s': %s", object_name.c_str(),
+                error.what());
+      promise->set_exception(std::current_exception());
+    }
+  });
+
+  return future;
+}
+
+void Manifest_writer::start_par_workers() {
+  for (std::size_t i = 0; i < k_par_threads; ++i) {
+    m_par_workers.emplace_back(mysqlsh::spawn_scoped_thread([this]() {
+      // each thread reuses its bucket, and its connection
+      const auto bucket = m_config->oci_bucket();
+
+      while (const auto request = m_par_requests.pop()) {
+        request(bucket.get());
+      }
+    }));
+  }
+}
+
+void Manifest_writer::stop_par_workers() {
+  m_par_requests.shutdown(m_par_workers.size());
+
+  for (auto &worker : m_par_workers) {
+    worker.join();
+  }
+
+  m_par_workers.clear();
+}
+
 void Manifest_writer::cache_par(mysqlshdk::oci::PAR &&par) {
   if (!par.name.empty()) {
     if (shcore::str_endswith(par.name, k_at_done_json)) m_complete = true;
@@ -356,27 +424,28 @@ std::string Manifest_writer::serialize() const {
 
   // Starts the manifest object
   json.start_object();
+
+  if (!m_segments.empty()) {
+    json.append_string("segments");
+    json.start_array();
+    for (const auto &par : m_segments) {
+      append_par(par, &json);
+    }
+    json.end_array();
+  }
+
   json.append_string("contents");
 
   // Starts the contents array
   json.start_array();
   for (const auto &par : m_par_cache) {
-    json.start_object();
-    json.append_string("parId");
-    json.append_string(par.id);
-    json.append_string("parUrl");
-    json.append_string(par.access_uri);
-    json.append_string("objectName");
-    json.append_string(par.object_name);
-    json.append_string("objectSize");
-    json.append_int(static_cast<int>(par.size));
-    json.end_object();
+    append_par(par, &json);
   }
   // contents array
   json.end_array();
   auto last_update = shcore::current_time_rfc3339();
   json.append_string("expireTime");
-  json.append_string(m_par_expire_time);
+  json.append_string(m_config->par_expire_time());
   json.append_string("lastUpdate");
   json.append_string(last_update);
   json.append_string("startTime");
@@ -394,17 +463,67 @@ std::string Manifest_writer::serialize() const {
 
 void Manifest_writer::flush() {
   // Avoids creating an empty manifest file
-  if (m_par_cache.empty()) return;
+  if (m_par_cache.empty() && m_segments.empty()) return;
 
-  std::string data = serialize();
+  const auto start = std::chrono::system_clock::now();
 
   try {
+    // full segments are written just once, only the remaining PARs are
+    // rewritten on each flush
+    while (m_par_cache.size() >= k_manifest_segment_size) {
+      write_segment();
+    }
+
+    std::string data = serialize();
+
     m_file->open(mysqlshdk::storage::Mode::WRITE);
     m_file->write(data.c_str(), data.length());
     m_file->close();
   } catch (const std::runtime_error &error) {
     m_par_thread_error = error.what();
   }
+
+  const auto elapsed = std::chrono::system_clock::now() - start;
+  m_flush_interval = std::max(
+      k_min_flush_interval,
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          k_flush_interval_factor * elapsed));
+}
+
+void Manifest_writer::write_segment() {
+  const auto begin = m_par_cache.begin();
+  const auto end = begin + k_manifest_segment_size;
+
+  shcore::JSON_dumper json(true);
+
+  json.start_object();
+  json.append_string("contents");
+  json.start_array();
+  for (auto it = begin; it != end; ++it) {
+    append_par(*it, &json);
+  }
+  json.end_array();
+  json.end_object();
+
+  const auto data = json.str();
+  const auto file =
+      mysqlshdk::storage::backend::object_storage::Directory(m_config,
+                                                             base_name())
+          .file(shcore::str_format(k_manifest_segment_format,
+                                   m_segments.size()));
+
+  file->open(mysqlshdk::storage::Mode::WRITE);
+  file->write(data.c_str(), data.length());
+  file->close();
+
+  const auto name = file->full_path().real();
+  auto par = m_config->oci_bucket()->create_pre_authenticated_request(
+      mysqlshdk::oci::PAR_access_type::OBJECT_READ,
+      m_config->par_expire_time(), k_par_prefix + name, name);
+  par.size = data.length();
+
+  m_segments.emplace_back(std::move(par));
+  m_par_cache.erase(begin, end);
 }
 
 /**
@@ -412,6 +531,10 @@ void Manifest_writer::flush() {
  * PARs are flushed into the manifest.
  */
 void Manifest_writer::finalize() {
+  std::lock_guard<std::mutex> lock(m_finalize_mutex);
+
+  m_finalized = true;
+
   if (m_par_thread) {
     mysqlshdk::oci::PAR done_guard;
     done_guard.id = "DONE";
@@ -421,6 +544,19 @@ void Manifest_writer::finalize() {
   }
 }
 
+void Manifest_writer::add_par(mysqlshdk::oci::PAR &&par) {
+  std::lock_guard<std::mutex> lock(m_finalize_mutex);
+
+  if (!m_finalized) {
+    m_pars_queue.push(std::move(par));
+  } else {
+    // an object was closed after the manifest was finalized, the PAR thread is
+    // no longer running, write its PAR right away so that it's not lost
+    cache_par(std::move(par));
+    flush();
+  }
+}
+
 const IDirectory::File_info &Manifest_reader::get_object(
     const std::string &name) {
   if (!has_object(name) && !is_complete()) {
@@ -431,8 +567,6 @@ const IDirectory::File_info &Manifest_reader::get_object(
 }
 
 void Manifest_reader::unserialize(const std::string &data) {
-  std::lock_guard<std::mutex> lock(m_mutex);
-
   auto manifest_map = shcore::Value::parse(data).as_map();
 
   {
@@ -444,9 +578,32 @@ void Manifest_reader::unserialize(const std::string &data) {
     }
   }
 
-  m_objects.clear();
+  // segments are never modified, each one is read just once
+  std::vector<std::pair<std::string, shcore::Array_t>> segments;
+
+  if (manifest_map->has_key("segments")) {
+    for (const auto &val : *manifest_map->get_array("segments")) {
+      const auto segment = val.as_map();
+      auto name = segment->get_string("objectName");
+
+      if (0 == m_loaded_segments.count(name)) {
+        segments.emplace_back(std::move(name),
+                              read_segment(segment->get_string("parUrl")));
+      }
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  for (auto &segment : segments) {
+    add_objects(segment.second);
+    m_loaded_segments.emplace(std::move(segment.first));
+  }
+
+  add_objects(manifest_map->get_array("contents"));
+}
 
-  const auto contents = manifest_map->get_array("contents");
+void Manifest_reader::add_objects(const shcore::Array_t &contents) {
   const auto done_path = base_name() + k_at_done_json;
 
   for (const auto &val : (*contents)) {
@@ -464,6 +621,22 @@ void Manifest_reader::unserialize(const std::string &data) {
   }
 }
 
+shcore::Array_t Manifest_reader::read_segment(
+    const std::string &par_url) const {
+  mysqlshdk::storage::backend::Http_object file(
+      mysqlshdk::oci::anonymize_par(m_par_endpoint + par_url), true);
+
+  file.open(mysqlshdk::storage::Mode::READ);
+
+  std::string buffer;
+  buffer.resize(file.file_size());
+  file.read(&buffer[0], buffer.size());
+
+  file.close();
+
+  return shcore::Value::parse(buffer).as_map()->get_array("contents");
+}
+
 void Manifest_reader::reload() {
   // If the manifest is fully loaded, avoids rework
   if (is_complete()) return;
@@ -505,8 +678,7 @@ Dump_manifest_writer::Dump_manifest_writer(
     // WRITE Mode: acts as a normal OCI Directory excepts that will
     // automatically create a PAR for each object created and a manifest file
     // containing the relation between files and PARs.
-    m_writer = std::make_shared<Manifest_writer>(
-        Directory::file(k_at_manifest_json), name, config->par_expire_time());
+    m_writer = std::make_shared<Manifest_writer>(config, name);
   }
 }
 
@@ -546,7 +718,7 @@ Dump_manifest_reader::Dump_manifest_reader(
     m_reader = std::make_shared<Manifest_reader>(
         std::make_unique<mysqlshdk::storage::backend::Http_object>(
             mysqlshdk::oci::anonymize_par(config->par().full_url()), true),
-        m_config->par().object_prefix());
+        m_config->par().object_prefix(), m_config->par().endpoint());
   }
 }
 
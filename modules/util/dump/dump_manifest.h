@@ -24,14 +24,20 @@
 #ifndef MODULES_UTIL_DUMP_DUMP_MANIFEST_H_
 #define MODULES_UTIL_DUMP_DUMP_MANIFEST_H_
 
+#include <chrono>
+#include <functional>
+#include <future>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "mysqlshdk/include/scripting/types.h"
 #include "mysqlshdk/libs/oci/oci_par.h"
 #include "mysqlshdk/libs/storage/backend/object_storage.h"
 #include "mysqlshdk/libs/storage/idirectory.h"
@@ -75,17 +81,38 @@ class Manifest_base {
 };
 
 /**
- * Handles the creation of the dump manifest
+ * Handles the creation of the dump manifest.
+ *
+ * The manifest is written in segments: once enough PARs are cached, they are
+ * written to a separate object (a segment), which is never modified again. The
+ * main manifest file holds the PARs of the segments and the PARs which were not
+ * yet written to a segment, this way its size is bounded and each flush writes
+ * only a limited amount of data.
  */
 class Manifest_writer final : public Manifest_base {
  public:
-  Manifest_writer(std::unique_ptr<mysqlshdk::storage::IFile> file_handle,
-                  const std::string &base_name,
-                  const std::string &par_expire_time);
+  Manifest_writer(const Dump_manifest_write_config_ptr &config,
+                  const std::string &base_name);
+
+  ~Manifest_writer();
 
   void cache_par(mysqlshdk::oci::PAR &&par);
 
-  void add_par(mysqlshdk::oci::PAR &&par) { m_pars_queue.push(std::move(par)); }
+  /**
+   * Adds the PAR of a written object to the manifest. If the manifest was
+   * already finalized, it is flushed right away.
+   */
+  void add_par(mysqlshdk::oci::PAR &&par);
+
+  /**
+   * Schedules creation of a PAR for the given object, PARs are created
+   * concurrently by a pool of threads.
+   *
+   * @param object_name Full name of the object.
+   *
+   * @returns PAR, or an exception if it could not be created.
+   */
+  std::future<mysqlshdk::oci::PAR> create_par(const std::string &object_name);
 
   std::string serialize() const;
 
@@ -94,12 +121,25 @@ class Manifest_writer final : public Manifest_base {
   void finalize();
 
  private:
-  std::string m_par_expire_time;
+  void start_par_workers();
+
+  void stop_par_workers();
+
+  void write_segment();
+
+  Dump_manifest_write_config_ptr m_config;
   std::vector<mysqlshdk::oci::PAR> m_par_cache;
+  std::vector<mysqlshdk::oci::PAR> m_segments;
   std::unique_ptr<std::thread> m_par_thread;
   std::string m_par_thread_error;
   std::string m_start_time;
   shcore::Synchronized_queue<mysqlshdk::oci::PAR> m_pars_queue;
+  std::chrono::milliseconds m_flush_interval;
+  std::vector<std::thread> m_par_workers;
+  shcore::Synchronized_queue<std::function<void(mysqlshdk::oci::Oci_bucket *)>>
+      m_par_requests;
+  std::mutex m_finalize_mutex;
+  bool m_finalized = false;
 };
 
 /**
@@ -108,8 +148,9 @@ class Manifest_writer final : public Manifest_base {
 class Manifest_reader final : public Manifest_base {
  public:
   Manifest_reader(std::unique_ptr<mysqlshdk::storage::IFile> file_handle,
-                  const std::string &base_name)
-      : Manifest_base(std::move(file_handle), base_name) {}
+                  const std::string &base_name, const std::string &par_endpoint)
+      : Manifest_base(std::move(file_handle), base_name),
+        m_par_endpoint(par_endpoint) {}
 
   const File_info &get_object(const std::string &name) override;
 
@@ -122,7 +163,19 @@ class Manifest_reader final : public Manifest_base {
   mysqlshdk::Masked_string full_path() const { return m_file->full_path(); }
 
  private:
+  /**
+   * Adds the objects from the "contents" array of a manifest.
+   */
+  void add_objects(const shcore::Array_t &contents);
+
+  /**
+   * Reads the "contents" array of the given manifest segment.
+   */
+  shcore::Array_t read_segment(const std::string &par_url) const;
+
   size_t m_last_manifest_size = 0;
+  std::string m_par_endpoint;
+  std::unordered_set<std::string> m_loaded_segments;
 };
 
 /**
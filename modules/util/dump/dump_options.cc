@@ -55,6 +55,7 @@ const shcore::Option_pack_def<Dump_options> &Dump_options::options() {
           .on_start(&Dump_options::on_start_unpack)
           .optional("maxRate", &Dump_options::set_string_option)
           .optional("showProgress", &Dump_options::m_show_progress)
+          .optional("metricsFile", &Dump_options::m_metrics_file)
           .optional("compression", &Dump_options::set_string_option)
           .optional("defaultCharacterSet", &Dump_options::m_character_set)
           .include(&Dump_options::m_dialect_unpacker)
@@ -102,6 +102,8 @@ class Dump_options {
 
   bool show_progress() const { return m_show_progress; }
 
+  const std::string &metrics_file() const { return m_metrics_file; }
+
   mysqlshdk::storage::Compression compression() const { return m_compression; }
 
   const std::shared_ptr<mysqlshdk::db::ISession> &session() const {
@@ -164,6 +166,13 @@ class Dump_options {
 
   virtual bool use_single_file() const = 0;
 
+  /**
+   * If data is written to a single file and it's chunked, each chunk is
+   * written to a separate, numbered file, instead of being merged into the
+   * output file.
+   */
+  virtual bool split_output() const { return false; }
+
   virtual bool dump_ddl() const = 0;
 
   virtual bool dump_data() const = 0;
@@ -259,6 +268,7 @@ class Dump_options {
   // common options
   int64_t m_max_rate = 0;
   bool m_show_progress;
+  std::string m_metrics_file;
   mysqlshdk::storage::Compression m_compression =
       mysqlshdk::storage::Compression::ZSTD;
   mysqlshdk::storage::Config_ptr m_storage_config;
@@ -30,6 +30,7 @@
 #include "mysqlshdk/libs/utils/logger.h"
 #include "mysqlshdk/libs/utils/utils_net.h"
 
+#include "modules/util/common/dump/stage_timer.h"
 #include "modules/util/dump/dump_errors.h"
 
 namespace mysqlsh {
@@ -208,6 +209,9 @@ Dump_write_result Dump_writer::write_buffer(const char *context,
   }
 
   if (result.data_bytes() > 0) {
+    common::Stage_timer::Scope compression{
+        common::Stage::COMPRESSION,
+        m_compressed ? &m_compression_sampler : nullptr};
     const auto bytes_written =
         m_output->write(buffer()->data(), result.data_bytes());
 
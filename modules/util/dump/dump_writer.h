@@ -30,6 +30,7 @@
 #include <string>
 #include <vector>
 
+#include "modules/util/common/dump/stage_timer.h"
 #include "mysqlshdk/libs/db/column.h"
 #include "mysqlshdk/libs/db/row.h"
 #include "mysqlshdk/libs/storage/compressed_file.h"
@@ -184,6 +185,11 @@ class Dump_writer {
 
   mysqlshdk::storage::Compressed_file *m_compressed = nullptr;
 
+  // reading the clock twice for each row is too expensive, compression is
+  // sampled instead
+  mutable common::Stage_timer::Sampler m_compression_sampler{
+      common::k_row_sample_every};
+
   uint64_t m_bytes_written = 0;
 
   uint64_t m_bytes_written_per_idx = 0;
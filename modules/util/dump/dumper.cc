@@ -28,6 +28,7 @@
 #include <cstdint>
 #include <functional>
 #include <iterator>
+#include <thread>
 #include <type_traits>
 #include <utility>
 
@@ -60,10 +61,12 @@
 #include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_lexing.h"
 #include "mysqlshdk/libs/utils/utils_mysql_parsing.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
 #include "mysqlshdk/libs/utils/utils_sqlstring.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 
 #include "modules/mod_utils.h"
+#include "modules/util/common/dump/json_metadata.h"
 #include "modules/util/common/dump/utils.h"
 #include "modules/util/dump/compatibility_option.h"
 #include "modules/util/dump/console_with_progress.h"
@@ -418,6 +421,8 @@ class Dumper::Dump_writer_controller {
     m_writer->close();
 
     if (m_close_output && m_output->is_open()) {
+      common::Stage_timer::Scope compression{common::Stage::COMPRESSION,
+                                             m_output->is_compressed()};
       m_output->close();
 
       // if file is compressed, the final file size may differ from the bytes
@@ -702,6 +707,7 @@ class Dumper::Table_worker final {
                                    {"id", std::to_string(m_id)}}));
 
       mysqlsh::Mysql_thread mysql_thread;
+      common::Stage_timer::Activate timer{&m_dumper->m_worker_timers[m_id]};
       m_rate_limit =
           mysqlshdk::utils::Rate_limit(m_dumper->m_options.max_rate());
 
@@ -813,15 +819,39 @@ class Dumper::Table_worker final {
     const auto full_query = prepare_query(table, &pre_encoded_columns);
     const auto controller = table.controller.get();
 
+    // time which is not spent in any other stage is counted as encoding
+    common::Stage_timer::Scope encoding{common::Stage::ENCODING};
+
     try {
       controller->prepare_for_writing();
 
       if (Dry_run::DISABLED == m_dumper->m_options.dry_run_mode()) {
-        const auto result = query(full_query);
+        std::shared_ptr<mysqlshdk::db::IResult> result;
+
+        {
+          common::Stage_timer::Scope server{common::Stage::SERVER};
+          result = query(full_query);
+        }
 
         controller->start_writing(result->get_metadata(), pre_encoded_columns);
 
-        while (const auto row = result->fetch_one()) {
+        // reading the clock twice for each row is too expensive, fetching of
+        // the rows is sampled instead
+        common::Stage_timer::Sampler fetch_sampler{common::k_row_sample_every};
+
+        while (true) {
+          const mysqlshdk::db::IRow *row;
+
+          {
+            common::Stage_timer::Scope server{common::Stage::SERVER,
+                                              &fetch_sampler};
+            row = result->fetch_one();
+          }
+
+          if (!row) {
+            break;
+          }
+
           if (m_dumper->m_worker_interrupt) {
             return;
           }
@@ -1723,10 +1753,8 @@ Dumper::Dumper(const Dump_options &options)
       }
     }
 
-    using mysqlshdk::storage::make_file;
-    m_output_file =
-        make_file(make_file(m_options.output_url(), m_options.storage_config()),
-                  m_options.compression());
+    m_output_file = make_data_file(mysqlshdk::storage::make_file(
+        m_options.output_url(), m_options.storage_config()));
     m_output_dir = m_output_file->parent();
 
     if (m_output_dir->is_local() && !m_output_dir->exists()) {
@@ -1735,6 +1763,27 @@ Dumper::Dumper(const Dump_options &options)
           m_options.output_url() + "' does not exist at the target location '" +
           m_output_dir->full_path().masked() + "'.");
     }
+
+    if (m_options.split()) {
+      // data is chunked and written in parallel to separate files, which are
+      // either merged into the output file or left as a numbered file set
+      const auto filename = shcore::path::basename(m_options.output_url());
+
+      if (m_options.split_output()) {
+        auto stem = filename;
+        const auto extension =
+            mysqlshdk::storage::get_extension(m_options.compression());
+
+        if (!extension.empty() && shcore::str_endswith(stem, extension)) {
+          stem.resize(stem.length() - extension.length());
+        }
+
+        m_output_parts_basename =
+            std::get<0>(shcore::path::split_extension(stem));
+      } else {
+        m_output_parts_basename = filename + ".part";
+      }
+    }
   } else {
     using mysqlshdk::storage::make_directory;
     m_output_dir =
@@ -1827,10 +1876,12 @@ void Dumper::run() {
     do_run();
   } catch (...) {
     kill_workers();
+    remove_output_parts();
     translate_current_exception(m_progress_thread);
   }
 
   if (m_worker_interrupt) {
+    remove_output_parts();
     // m_worker_interrupt is also used to signal exceptions from workers,
     // if we're here, then no exceptions were thrown and user pressed ^C
     throw shcore::cancelled("Interrupted by user");
@@ -1901,6 +1952,10 @@ void Dumper::do_run() {
     m_worker_interrupt = false;
     m_progress_thread.start();
     shcore::on_leave_scope cleanup_progress([this]() { shutdown_progress(); });
+    m_worker_timers =
+        std::make_unique<common::Stage_timer[]>(m_options.worker_threads());
+    start_metrics();
+    shcore::on_leave_scope cleanup_metrics([this]() { stop_metrics(); });
     m_current_stage = m_progress_thread.start_stage("Initializing");
 
     open_session();
@@ -2569,7 +2624,7 @@ void Dumper::create_schema_tasks() {
   }
 }
 
-void Dumper::validate_mds() const {
+void Dumper::validate_mds() {
   if (!m_options.mds_compatibility() ||
       (!m_options.dump_ddl() && !dump_users())) {
     return;
@@ -2601,50 +2656,65 @@ void Dumper::validate_mds() const {
   }
 
   Progress_thread::Progress_config config;
-  std::atomic<uint64_t> objects_checked{0};
+  auto objects_checked = std::make_shared<std::atomic<uint64_t>>(0);
 
-  config.current = [&objects_checked]() -> uint64_t { return objects_checked; };
+  config.current = [objects_checked]() -> uint64_t { return *objects_checked; };
   config.total = [this]() { return m_total_objects; };
 
   m_current_stage = m_progress_thread.start_stage(
       "Validating MySQL HeatWave Service compatibility", std::move(config));
   shcore::on_leave_scope finish_stage([this]() { m_current_stage->finish(); });
 
-  const auto issues = [&status](const auto &memory) {
-    status.set(show_issues(memory->issues()));
-  };
-
-  const auto dumper = schema_dumper(session());
-
   if (dump_users()) {
-    issues(dump_users(dumper.get()));
+    const auto dumper = schema_dumper(session());
+    status.set(show_issues(dump_users(dumper.get())->issues()));
   }
 
   if (m_options.dump_ddl()) {
+    std::vector<Ddl_check> checks;
+    checks.reserve(m_total_objects);
+
     for (const auto &schema : m_schema_infos) {
-      issues(dump_schema(dumper.get(), schema.name));
-      ++objects_checked;
+      checks.emplace_back([this, &schema](Schema_dumper *dumper) {
+        return dump_schema(dumper, schema.name)->issues();
+      });
     }
 
     for (const auto &schema : m_schema_infos) {
       for (const auto &table : schema.tables) {
-        issues(dump_table(dumper.get(), schema.name, table.name));
-
-        if (m_options.dump_triggers() &&
-            dumper->count_triggers_for_table(schema.name, table.name) > 0) {
-          issues(dump_triggers(dumper.get(), schema.name, table.name));
-        }
+        checks.emplace_back([this, &schema, &table](Schema_dumper *dumper) {
+          auto issues = dump_table(dumper, schema.name, table.name)->issues();
+
+          if (m_options.dump_triggers() &&
+              dumper->count_triggers_for_table(schema.name, table.name) > 0) {
+            const auto triggers =
+                dump_triggers(dumper, schema.name, table.name);
+            issues.insert(issues.end(), triggers->issues().begin(),
+                          triggers->issues().end());
+          }
 
-        ++objects_checked;
+          return issues;
+        });
       }
 
       for (const auto &view : schema.views) {
-        issues(dump_temporary_view(dumper.get(), schema.name, view.name));
-        issues(dump_view(dumper.get(), schema.name, view.name));
-
-        ++objects_checked;
+        checks.emplace_back([this, &schema, &view](Schema_dumper *dumper) {
+          auto issues =
+              dump_temporary_view(dumper, schema.name, view.name)->issues();
+          const auto ddl = dump_view(dumper, schema.name, view.name);
+          issues.insert(issues.end(), ddl->issues().begin(),
+                        ddl->issues().end());
+          return issues;
+        });
       }
     }
+
+    // issues are reported in the same order, regardless of how the DDL was
+    // generated
+    for (const auto &issues :
+         run_ddl_checks(std::move(checks), objects_checked)) {
+      status.set(show_issues(issues));
+    }
   }
 
   if (m_options.implicit_target_version() &&
@@ -2742,6 +2812,107 @@ void Dumper::validate_mds() const {
   }
 }
 
+std::vector<std::vector<Schema_dumper::Issue>> Dumper::run_ddl_checks(
+    std::vector<Ddl_check> &&checks,
+    const std::shared_ptr<std::atomic<uint64_t>> &progress) {
+  // below this number of objects DDL is generated using the main session,
+  // scheduling the work is not worth it
+  static constexpr std::size_t k_min_objects_for_parallel_checks = 100;
+
+  if (checks.size() < k_min_objects_for_parallel_checks ||
+      m_workers.size() < 2) {
+    std::vector<std::vector<Schema_dumper::Issue>> results;
+    results.reserve(checks.size());
+
+    const auto dumper = schema_dumper(session());
+
+    for (const auto &check : checks) {
+      results.emplace_back(check(dumper.get()));
+      ++(*progress);
+    }
+
+    return results;
+  }
+
+  log_info("Generating DDL of %zu objects using %zu threads", checks.size(),
+           m_workers.size());
+
+  // state is shared with the workers, in case this thread stops waiting due to
+  // an interruption while some checks are still being executed
+  struct State {
+    std::vector<Ddl_check> checks;
+    std::vector<std::vector<Schema_dumper::Issue>> results;
+    std::vector<std::exception_ptr> exceptions;
+    std::size_t finished = 0;
+    std::mutex mutex;
+    std::condition_variable cv;
+  };
+
+  const auto state = std::make_shared<State>();
+  state->checks = std::move(checks);
+  state->results.resize(state->checks.size());
+  state->exceptions.resize(state->checks.size());
+
+  // objects are batched, so that the queue is not flooded with tiny tasks
+  const auto total = state->checks.size();
+  const auto batch_size =
+      std::max<std::size_t>(1, std::min<std::size_t>(
+                                   64, total / (m_workers.size() * 8)));
+  std::size_t batches = 0;
+
+  for (std::size_t begin = 0; begin < total; begin += batch_size) {
+    const auto end = std::min(total, begin + batch_size);
+
+    m_worker_tasks.push(
+        {"generating DDL",
+         [this, state, progress, begin, end](Table_worker *worker) {
+           const auto dumper = schema_dumper(worker->m_session);
+
+           for (auto i = begin; i < end; ++i) {
+             try {
+               if (!m_worker_interrupt) {
+                 state->results[i] = state->checks[i](dumper.get());
+               }
+             } catch (...) {
+               state->exceptions[i] = std::current_exception();
+             }
+
+             ++(*progress);
+           }
+
+           {
+             std::lock_guard lock{state->mutex};
+             ++state->finished;
+           }
+
+           state->cv.notify_one();
+         }},
+        shcore::Queue_priority::HIGH);
+
+    ++batches;
+  }
+
+  {
+    std::unique_lock lock{state->mutex};
+
+    while (state->finished < batches) {
+      if (m_worker_interrupt) {
+        return {};
+      }
+
+      state->cv.wait_for(lock, std::chrono::milliseconds(250));
+    }
+  }
+
+  for (const auto &exception : state->exceptions) {
+    if (exception) {
+      std::rethrow_exception(exception);
+    }
+  }
+
+  return std::move(state->results);
+}
+
 void Dumper::initialize_counters() {
   m_total_rows = 0;
   m_total_tables = 0;
@@ -2790,10 +2961,163 @@ void Dumper::finalize_dump() {
     return;
   }
 
+  if (!m_output_parts_basename.empty() && !m_options.split_output() &&
+      !m_worker_exception_thrown) {
+    merge_output_parts();
+  }
+
   write_dump_finished_metadata();
   close_output_directory();
 }
 
+void Dumper::merge_output_parts() {
+  m_current_stage = m_progress_thread.start_stage("Writing output file");
+  shcore::on_leave_scope finish_stage([this]() { m_current_stage->finish(); });
+
+  // parts are named: <basename>.<ext> if table was not chunked,
+  // <basename>@N.<ext> and <basename>@@N.<ext> (last one) otherwise, chunks
+  // of partitions are named <basename>@P@N.<ext>
+  std::vector<std::pair<std::vector<std::size_t>, std::string>> parts;
+  parts.reserve(m_chunk_file_bytes.size());
+
+  for (const auto &file : m_chunk_file_bytes) {
+    const auto &name = file.first;
+    auto pos = m_output_parts_basename.length();
+    std::vector<std::size_t> idx;
+
+    while (pos < name.length() && '@' == name[pos]) {
+      while (pos < name.length() && '@' == name[pos]) {
+        ++pos;
+      }
+
+      std::size_t length = 0;
+      idx.emplace_back(std::stoull(name.substr(pos), &length));
+      pos += length;
+    }
+
+    parts.emplace_back(std::move(idx), name);
+  }
+
+  std::sort(parts.begin(), parts.end());
+
+  using mysqlshdk::storage::Mode;
+
+  // each part is a complete (possibly compressed) file, compressed streams
+  // can be concatenated, so the output file is created by copying the parts
+  const auto output = mysqlshdk::storage::make_file(m_options.output_url(),
+                                                    m_options.storage_config());
+  output->open(Mode::WRITE);
+
+  // if merge does not complete, the incomplete output file is removed, parts
+  // which were not merged yet are removed by run()
+  const auto cleanup = [&output]() {
+    try {
+      if (output->is_open()) {
+        output->close();
+      }
+
+      output->remove();
+    } catch (const std::exception &e) {
+      log_error("Failed to remove the incomplete output file: %s", e.what());
+    }
+  };
+
+  constexpr std::size_t k_buffer_size = 4 * 1024 * 1024;
+  std::string buffer;
+  buffer.resize(k_buffer_size);
+
+  try {
+    for (const auto &part : parts) {
+      if (m_worker_interrupt) {
+        current_console()->print_warning(
+            "Export was interrupted, removing the incomplete output file.");
+        cleanup();
+        return;
+      }
+
+      const auto input = make_file(part.second);
+      input->open(Mode::READ);
+
+      ssize_t bytes;
+
+      while ((bytes = input->read(buffer.data(), buffer.size())) > 0) {
+        output->write(buffer.data(), bytes);
+      }
+
+      input->close();
+      input->remove();
+    }
+
+    output->close();
+  } catch (...) {
+    cleanup();
+    throw;
+  }
+}
+
+void Dumper::remove_output_parts() const {
+  if (m_output_parts_basename.empty() ||
+      Dry_run::DONT_WRITE_ANY_FILES == m_options.dry_run_mode()) {
+    return;
+  }
+
+  // removes all the parts, including the ones which were not fully written
+  try {
+    auto files = m_output_dir->filter_files(m_output_parts_basename + "@*." +
+                                            m_table_data_extension);
+    files.emplace(get_table_data_filename(m_output_parts_basename));
+
+    for (const auto &file : files) {
+      const auto part = m_output_dir->file(file.name());
+
+      if (part->exists()) {
+        part->remove();
+      }
+    }
+  } catch (const std::exception &e) {
+    log_error("Failed to remove the parts of an incomplete export: %s",
+              e.what());
+  }
+}
+
+mysqlshdk::storage::Compression_options Dumper::compression_options() const {
+  mysqlshdk::storage::Compression_options options;
+
+  if (m_options.use_single_file()) {
+    // the hardware threads are shared by all the writers: a single writer if
+    // output is not chunked, otherwise one writer per thread, each one
+    // writing a separate part of the output (used if compression supports it)
+    const std::size_t writers = m_options.split() ? m_options.threads() : 1;
+    options.threads =
+        std::max<std::size_t>(1, std::thread::hardware_concurrency() /
+                                     std::max<std::size_t>(1, writers));
+  }
+
+  return options;
+}
+
+std::unique_ptr<mysqlshdk::storage::IFile> Dumper::make_data_file(
+    std::unique_ptr<mysqlshdk::storage::IFile> file) const {
+  const auto compression = m_options.compression();
+
+  // local files compressed with zstd are written using memory-mapped IO, which
+  // would be disabled by the wrapper, time spent in storage is then counted as
+  // compression
+  if (!file->is_local() ||
+      mysqlshdk::storage::Compression::ZSTD != compression) {
+    file = common::make_timed_file(std::move(file));
+  }
+
+  return mysqlshdk::storage::make_file(std::move(file), compression,
+                                       compression_options());
+}
+
+std::string Dumper::split_output_pattern() const {
+  const auto &url = m_options.output_url();
+  return url.substr(0, url.length() - shcore::path::basename(url).length()) +
+         m_output_parts_basename + "@*." + m_table_data_extension;
+}
+
 void Dumper::create_output_directory() {
   const auto dir = directory();
 
@@ -3148,7 +3472,8 @@ Dumper::Table_task Dumper::create_table_task(const Schema_info &schema,
   task.name = table.name;
   task.quoted_name = table.quoted_name;
   task.schema = schema.name;
-  task.basename = table.basename;
+  task.basename = m_output_parts_basename.empty() ? table.basename
+                                                 : m_output_parts_basename;
   task.info = table.info;
   task.partitions = table.partitions;
   task.where = m_options.where(schema.name, table.name);
@@ -3165,7 +3490,8 @@ Dumper::Table_task Dumper::create_table_task(const Schema_info &schema,
   task.name = view.name;
   task.quoted_name = view.quoted_name;
   task.schema = schema.name;
-  task.basename = view.basename;
+  task.basename = m_output_parts_basename.empty() ? view.basename
+                                                 : m_output_parts_basename;
   task.info = view.info;
   task.where = m_options.where(schema.name, view.name);
 
@@ -3214,15 +3540,27 @@ void Dumper::push_table_task(Table_task &&task) {
     return;
   }
 
-  if (m_options.is_export_only() || task.partitions.empty()) {
+  // data of an export is written to a single file, unless it's chunked
+  const bool chunk_partitions =
+      !m_options.is_export_only() ||
+      (m_options.split() && task.partitions.size() > 1);
+
+  if (!chunk_partitions || task.partitions.empty()) {
     push_table_chunking_task(std::move(task));
   } else {
+    std::size_t idx = 0;
+
     for (const auto &partition : task.partitions) {
       auto copy = task;
 
       copy.task_name =
           task.task_name + " partition " + partition.info->quoted_name;
-      copy.basename = partition.basename;
+      // parts of an export are numbered in partition order:
+      // <basename>@<partition>@<chunk>.<ext>
+      copy.basename = m_output_parts_basename.empty()
+                          ? partition.basename
+                          : m_output_parts_basename + "@" +
+                                std::to_string(idx++);
       copy.partitions.clear();
       copy.partitions.emplace_back(partition);
 
@@ -3248,15 +3586,14 @@ void Dumper::push_table_chunking_task(Table_task &&task) {
 
 std::unique_ptr<Dumper::Dump_writer_controller> Dumper::table_dump_controller(
     const std::string &filename) const {
-  if (m_options.use_single_file()) {
+  if (m_options.use_single_file() && !m_options.split()) {
     return std::make_unique<Single_file_writer_controller>(m_writer_creator(),
                                                            m_output_file.get());
   } else {
     return std::make_unique<Default_writer_controller>(
         m_writer_creator(),
         [this](const std::string &name) {
-          return mysqlshdk::storage::make_file(make_file(name, true),
-                                               m_options.compression());
+          return make_data_file(make_file(name, true));
         },
         m_options.write_index_files()
             ? [this](const std::string &name) { return make_file(name); }
@@ -3425,13 +3762,9 @@ void Dumper::write_dump_finished_metadata() const {
     return;
   }
 
-  using rapidjson::Document;
-  using rapidjson::StringRef;
-  using rapidjson::Type;
-  using rapidjson::Value;
+  common::Json_file_writer json{make_file("@.done.json")};
 
-  Document doc{Type::kObjectType};
-  auto &a = doc.GetAllocator();
+  json.start_object();
 
   // We cannot use m_progress_thread.duration().finished_at() here, because
   // progress thread was not terminated yet, as it needs to optionally show
@@ -3442,41 +3775,46 @@ void Dumper::write_dump_finished_metadata() const {
   // be off only if writing the manifest takes a lot of time. On the other hand,
   // dump is now complete, writing the manifest is an extra step, and the
   // summary will include the time it takes.
-  doc.AddMember(StringRef("end"),
-                {Progress_thread::Duration::current_time().c_str(), a}, a);
-  doc.AddMember(StringRef("dataBytes"), m_data_bytes.load(), a);
+  json.member("end", Progress_thread::Duration::current_time());
+  json.member("dataBytes", m_data_bytes.load());
 
-  {
-    Value bytes{Type::kObjectType};
-    Value rows{Type::kObjectType};
+  // maps are written one after another, each one requires a separate pass
+  const auto write_stats = [&json, this](const char *name, auto &&get) {
+    json.key(name);
+    json.start_object();
 
     for (const auto &schema : m_table_data_stats) {
-      Value table_bytes{Type::kObjectType};
-      Value table_rows{Type::kObjectType};
+      json.key(schema.first);
+      json.start_object();
 
       for (const auto &table : schema.second) {
-        table_bytes.AddMember(refs(table.first), table.second.data_bytes(), a);
-        table_rows.AddMember(refs(table.first), table.second.rows_written(), a);
+        json.member(table.first, get(table.second));
       }
 
-      bytes.AddMember(refs(schema.first), std::move(table_bytes), a);
-      rows.AddMember(refs(schema.first), std::move(table_rows), a);
+      json.end_object();
     }
 
-    doc.AddMember(StringRef("tableDataBytes"), std::move(bytes), a);
-    doc.AddMember(StringRef("tableRows"), std::move(rows), a);
-  }
+    json.end_object();
+  };
 
-  {
-    Value files{Type::kObjectType};
+  write_stats("tableDataBytes", [](const Dump_write_result &result) {
+    return static_cast<uint64_t>(result.data_bytes());
+  });
+  write_stats("tableRows", [](const Dump_write_result &result) {
+    return static_cast<uint64_t>(result.rows_written());
+  });
 
-    for (const auto &file : m_chunk_file_bytes)
-      files.AddMember(refs(file.first), file.second, a);
+  json.key("chunkFileBytes");
+  json.start_object();
 
-    doc.AddMember(StringRef("chunkFileBytes"), std::move(files), a);
+  for (const auto &file : m_chunk_file_bytes) {
+    json.member(file.first, file.second);
   }
 
-  write_json(make_file("@.done.json"), &doc);
+  json.end_object();
+
+  json.end_object();
+  json.close();
 }
 
 void Dumper::write_schema_metadata(const Schema_info &schema) const {
@@ -3484,97 +3822,77 @@ void Dumper::write_schema_metadata(const Schema_info &schema) const {
     return;
   }
 
-  using rapidjson::Document;
-  using rapidjson::StringRef;
-  using rapidjson::Type;
-  using rapidjson::Value;
-
-  Document doc{Type::kObjectType};
-  auto &a = doc.GetAllocator();
+  const auto write_string = [](common::Json_file_writer *json,
+                               const std::string &str) { json->value(str); };
+  const auto write_name = [](common::Json_file_writer *json,
+                             const auto &object) { json->value(object.name); };
 
-  doc.AddMember(StringRef("schema"), refs(schema.name), a);
-  doc.AddMember(StringRef("includesDdl"), m_options.dump_ddl(), a);
-  doc.AddMember(StringRef("includesViewsDdl"), m_options.dump_ddl(), a);
-  doc.AddMember(StringRef("includesData"), m_options.dump_data(), a);
+  // fetch everything before the file is created
+  std::vector<std::string> events;
+  std::vector<std::string> functions;
+  std::vector<std::string> procedures;
 
-  {
-    // list of tables
-    Value tables{Type::kArrayType};
+  if (m_options.dump_ddl()) {
+    const auto dumper = schema_dumper(session());
 
-    for (const auto &table : schema.tables) {
-      tables.PushBack(refs(table.name), a);
+    if (m_options.dump_events()) {
+      events = dumper->get_events(schema.name);
     }
 
-    doc.AddMember(StringRef("tables"), std::move(tables), a);
+    if (m_options.dump_routines()) {
+      functions = dumper->get_routines(schema.name, "FUNCTION");
+      procedures = dumper->get_routines(schema.name, "PROCEDURE");
+    }
   }
 
-  if (m_options.dump_ddl()) {
-    // list of views
-    Value views{Type::kArrayType};
+  common::Json_file_writer json{
+      make_file(common::get_schema_filename(schema.basename, "json"))};
 
-    for (const auto &view : schema.views) {
-      views.PushBack(refs(view.name), a);
-    }
+  json.start_object();
 
-    doc.AddMember(StringRef("views"), std::move(views), a);
-  }
+  json.member("schema", schema.name);
+  json.member("includesDdl", m_options.dump_ddl());
+  json.member("includesViewsDdl", m_options.dump_ddl());
+  json.member("includesData", m_options.dump_data());
+
+  // list of tables
+  json.array("tables", schema.tables, write_name);
 
   if (m_options.dump_ddl()) {
-    const auto dumper = schema_dumper(session());
+    // list of views
+    json.array("views", schema.views, write_name);
 
     if (m_options.dump_events()) {
       // list of events
-      Value events{Type::kArrayType};
-
-      for (const auto &event : dumper->get_events(schema.name)) {
-        events.PushBack({event.c_str(), a}, a);
-      }
-
-      doc.AddMember(StringRef("events"), std::move(events), a);
+      json.array("events", events, write_string);
     }
 
     if (m_options.dump_routines()) {
       // list of functions
-      Value functions{Type::kArrayType};
-
-      for (const auto &function :
-           dumper->get_routines(schema.name, "FUNCTION")) {
-        functions.PushBack({function.c_str(), a}, a);
-      }
-
-      doc.AddMember(StringRef("functions"), std::move(functions), a);
-    }
-
-    if (m_options.dump_routines()) {
+      json.array("functions", functions, write_string);
       // list of stored procedures
-      Value procedures{Type::kArrayType};
-
-      for (const auto &procedure :
-           dumper->get_routines(schema.name, "PROCEDURE")) {
-        procedures.PushBack({procedure.c_str(), a}, a);
-      }
-
-      doc.AddMember(StringRef("procedures"), std::move(procedures), a);
+      json.array("procedures", procedures, write_string);
     }
   }
 
   {
     // map of basenames
-    Value basenames{Type::kObjectType};
+    json.key("basenames");
+    json.start_object();
 
     for (const auto &table : schema.tables) {
-      basenames.AddMember(refs(table.name), refs(table.basename), a);
+      json.member(table.name, table.basename);
     }
 
     for (const auto &view : schema.views) {
-      basenames.AddMember(refs(view.name), refs(view.basename), a);
+      json.member(view.name, view.basename);
     }
 
-    doc.AddMember(StringRef("basenames"), std::move(basenames), a);
+    json.end_object();
   }
 
-  write_json(make_file(common::get_schema_filename(schema.basename, "json")),
-             &doc);
+  json.end_object();
+  json.close();
 }
 
 void Dumper::write_table_metadata(
@@ -3584,144 +3902,133 @@ void Dumper::write_table_metadata(
     return;
   }
 
-  using rapidjson::Document;
-  using rapidjson::StringRef;
-  using rapidjson::Type;
-  using rapidjson::Value;
+  const auto write_string = [](common::Json_file_writer *json,
+                               const std::string &str) { json->value(str); };
 
-  Document doc{Type::kObjectType};
-  auto &a = doc.GetAllocator();
+  const auto dumper = schema_dumper(session);
+
+  // fetch everything before the file is created
+  std::vector<std::string> triggers;
+
+  if (m_options.dump_triggers() && m_options.dump_ddl()) {
+    triggers = dumper->get_triggers(table.schema, table.name);
+  }
+
+  const auto all_histograms = dumper->get_histograms(table.schema, table.name);
+
+  common::Json_file_writer json{
+      make_file(common::get_table_data_filename(table.basename, "json"))};
+
+  json.start_object();
 
   {
     // options - to be used by importer
-    Value options{Type::kObjectType};
+    json.key("options");
+    json.start_object();
 
-    options.AddMember(StringRef("schema"), refs(table.schema), a);
-    options.AddMember(StringRef("table"), refs(table.name), a);
+    json.member("schema", table.schema);
+    json.member("table", table.name);
 
-    Value cols{Type::kArrayType};
-    Value decode{Type::kObjectType};
+    json.array("columns", table.info->columns,
+               [](common::Json_file_writer *w, const auto &c) {
+                 w->value(c->name);
+               });
 
-    for (const auto &c : table.info->columns) {
-      cols.PushBack(refs(c->name), a);
+    const auto csv_unsafe =
+        std::any_of(table.info->columns.begin(), table.info->columns.end(),
+                    [](const auto &c) { return c->csv_unsafe; });
 
-      if (c->csv_unsafe) {
-        decode.AddMember(
-            refs(c->name),
-            StringRef(m_options.use_base64() ? "FROM_BASE64" : "UNHEX"), a);
-      }
-    }
+    if (csv_unsafe) {
+      json.key("decodeColumns");
+      json.start_object();
 
-    options.AddMember(StringRef("columns"), std::move(cols), a);
+      for (const auto &c : table.info->columns) {
+        if (c->csv_unsafe) {
+          json.member(c->name,
+                      m_options.use_base64() ? "FROM_BASE64" : "UNHEX");
+        }
+      }
 
-    if (!decode.ObjectEmpty()) {
-      options.AddMember(StringRef("decodeColumns"), std::move(decode), a);
+      json.end_object();
     }
 
-    options.AddMember(StringRef("defaultCharacterSet"),
-                      refs(m_options.character_set()), a);
+    json.member("defaultCharacterSet", m_options.character_set());
 
-    options.AddMember(StringRef("fieldsTerminatedBy"),
-                      refs(m_options.dialect().fields_terminated_by), a);
-    options.AddMember(StringRef("fieldsEnclosedBy"),
-                      refs(m_options.dialect().fields_enclosed_by), a);
-    options.AddMember(StringRef("fieldsOptionallyEnclosed"),
-                      m_options.dialect().fields_optionally_enclosed, a);
-    options.AddMember(StringRef("fieldsEscapedBy"),
-                      refs(m_options.dialect().fields_escaped_by), a);
-    options.AddMember(StringRef("linesTerminatedBy"),
-                      refs(m_options.dialect().lines_terminated_by), a);
+    json.member("fieldsTerminatedBy", m_options.dialect().fields_terminated_by);
+    json.member("fieldsEnclosedBy", m_options.dialect().fields_enclosed_by);
+    json.member("fieldsOptionallyEnclosed",
+                m_options.dialect().fields_optionally_enclosed);
+    json.member("fieldsEscapedBy", m_options.dialect().fields_escaped_by);
+    json.member("linesTerminatedBy", m_options.dialect().lines_terminated_by);
 
-    doc.AddMember(StringRef("options"), std::move(options), a);
+    json.end_object();
   }
 
-  const auto dumper = schema_dumper(session);
-
   if (m_options.dump_triggers() && m_options.dump_ddl()) {
     // list of triggers
-    Value triggers{Type::kArrayType};
-
-    for (const auto &trigger : dumper->get_triggers(table.schema, table.name)) {
-      triggers.PushBack({trigger.c_str(), a}, a);
-    }
-
-    doc.AddMember(StringRef("triggers"), std::move(triggers), a);
+    json.array("triggers", triggers, write_string);
   }
 
-  const auto all_histograms = dumper->get_histograms(table.schema, table.name);
-
   if (!all_histograms.empty()) {
     // list of histograms
-    Value histograms{Type::kArrayType};
-
-    for (const auto &histogram : all_histograms) {
-      Value h{Type::kObjectType};
-
-      h.AddMember(StringRef("column"), refs(histogram.column), a);
-      h.AddMember(StringRef("buckets"),
-                  static_cast<uint64_t>(histogram.buckets), a);
-
-      histograms.PushBack(std::move(h), a);
-    }
-
-    doc.AddMember(StringRef("histograms"), std::move(histograms), a);
+    json.array("histograms", all_histograms,
+               [](common::Json_file_writer *w, const auto &histogram) {
+                 w->start_object();
+                 w->member("column", histogram.column);
+                 w->member("buckets", static_cast<uint64_t>(histogram.buckets));
+                 w->end_object();
+               });
   }
 
-  doc.AddMember(StringRef("includesData"),
-                m_options.dump_data() && should_dump_data(table), a);
-  doc.AddMember(StringRef("includesDdl"), m_options.dump_ddl(), a);
+  json.member("includesData", m_options.dump_data() && should_dump_data(table));
+  json.member("includesDdl", m_options.dump_ddl());
 
-  doc.AddMember(StringRef("extension"), refs(m_table_data_extension), a);
-  doc.AddMember(StringRef("chunking"), m_options.split(), a);
-  doc.AddMember(
-      StringRef("compression"),
-      {mysqlshdk::storage::to_string(m_options.compression()).c_str(), a}, a);
+  json.member("extension", m_table_data_extension);
+  json.member("chunking", m_options.split());
+  json.member("compression",
+              mysqlshdk::storage::to_string(m_options.compression()));
 
   {
-    Value primary{Type::kArrayType};
+    json.key("primaryIndex");
+    json.start_array();
 
     if (table.info->index.primary()) {
       for (const auto &column : table.info->index.columns()) {
-        primary.PushBack(refs(column->name), a);
+        json.value(column->name);
       }
     }
 
-    doc.AddMember(StringRef("primaryIndex"), std::move(primary), a);
+    json.end_array();
   }
 
-  {
-    // list of partitions
-    Value partitions{Type::kArrayType};
-
-    for (const auto &partition : table.partitions) {
-      partitions.PushBack(refs(partition.info->name), a);
-    }
-
-    doc.AddMember(StringRef("partitions"), std::move(partitions), a);
-  }
+  // list of partitions
+  json.array("partitions", table.partitions,
+             [](common::Json_file_writer *w, const auto &partition) {
+               w->value(partition.info->name);
+             });
 
   {
     // map of partition basenames
-    Value basenames{Type::kObjectType};
+    json.key("basenames");
+    json.start_object();
 
     for (const auto &partition : table.partitions) {
-      basenames.AddMember(refs(partition.info->name), refs(partition.basename),
-                          a);
+      json.member(partition.info->name, partition.basename);
     }
 
-    doc.AddMember(StringRef("basenames"), std::move(basenames), a);
+    json.end_object();
   }
 
   {
     const auto &where = m_options.where(table.schema, table.name);
 
     if (!where.empty()) {
-      doc.AddMember(StringRef("where"), refs(where), a);
+      json.member("where", where);
     }
   }
 
-  write_json(make_file(common::get_table_data_filename(table.basename, "json")),
-             &doc);
+  json.end_object();
+  json.close();
 }
 
 void Dumper::summarize() const {
@@ -3776,9 +4083,39 @@ void Dumper::summarize() const {
             m_bytes_written, m_data_dump_stage->duration().seconds()));
   }
 
+  common::print_stage_summary(m_worker_timers.get(), m_options.worker_threads(),
+                              stages());
+
   summary();
 }
 
+std::vector<common::Stage_description> Dumper::stages() const {
+  std::vector<common::Stage_description> result;
+
+  result.push_back({common::Stage::SERVER, "server",
+                    "fetching rows from the server",
+                    "adding more threads may help if the server has spare "
+                    "capacity, otherwise the server is saturated"});
+  result.push_back({common::Stage::ENCODING, "encoding", "encoding rows",
+                    "adding more threads may help if this host has spare CPU "
+                    "capacity"});
+
+  if (compressed()) {
+    result.push_back({common::Stage::COMPRESSION, "compression",
+                      "compressing data",
+                      "consider using a faster compression algorithm, or "
+                      "adding more threads if this host has spare CPU "
+                      "capacity"});
+  }
+
+  result.push_back(
+      {common::Stage::STORAGE, "storage", "writing data to the storage",
+       "consider running the dump on a host closer to the storage, or adding "
+       "more threads if the bandwidth is not saturated"});
+
+  return result;
+}
+
 void Dumper::rethrow() const {
   for (const auto &exc : m_worker_exceptions) {
     if (exc) {
@@ -3878,6 +4215,73 @@ void Dumper::shutdown_progress() {
   }
 }
 
+void Dumper::start_metrics() {
+  if (m_options.metrics_file().empty()) {
+    return;
+  }
+
+  using Type = common::Metrics_writer::Type;
+  using Sample = common::Metrics_writer::Sample;
+
+  const auto threads = m_options.worker_threads();
+  m_metrics =
+      std::make_unique<common::Metrics_writer>(m_options.metrics_file());
+
+  m_metrics->add(Type::COUNTER, "mysqlsh_dump_rows_total",
+                 "Number of rows written.",
+                 [this]() { return static_cast<double>(m_rows_written); });
+  m_metrics->add(Type::COUNTER, "mysqlsh_dump_data_bytes_total",
+                 "Number of uncompressed data bytes written.",
+                 [this]() { return static_cast<double>(m_data_bytes); });
+  m_metrics->add(Type::COUNTER, "mysqlsh_dump_bytes_total",
+                 "Number of bytes written to the output files.",
+                 [this]() { return static_cast<double>(m_bytes_written); });
+  m_metrics->add(Type::GAUGE, "mysqlsh_dump_compression_ratio",
+                 "Ratio of uncompressed to compressed data bytes.", [this]() {
+                   const uint64_t bytes = m_bytes_written;
+                   return bytes ? static_cast<double>(m_data_bytes) / bytes
+                                : 1.0;
+                 });
+  m_metrics->add(Type::GAUGE, "mysqlsh_dump_threads_chunking",
+                 "Number of threads chunking the tables.", [this]() {
+                   return static_cast<double>(m_num_threads_chunking);
+                 });
+  m_metrics->add(Type::GAUGE, "mysqlsh_dump_threads_dumping",
+                 "Number of threads dumping the data.", [this]() {
+                   return static_cast<double>(m_num_threads_dumping);
+                 });
+  m_metrics->add(Type::GAUGE, "mysqlsh_dump_pending_tasks",
+                 "Number of tasks waiting for a worker.", [this]() {
+                   return static_cast<double>(m_worker_tasks.size());
+                 });
+
+  for (const auto &stage : stages()) {
+    m_metrics->add(Type::COUNTER,
+                   shcore::str_format("mysqlsh_dump_worker_%s_seconds_total",
+                                      stage.name),
+                   shcore::str_format("Time spent %s.", stage.description),
+                   "worker", [this, threads, s = stage.stage]() {
+                     std::vector<Sample> samples;
+                     samples.reserve(threads);
+
+                     for (std::size_t i = 0; i < threads; ++i) {
+                       samples.emplace_back(Sample{
+                           std::to_string(i), m_worker_timers[i].seconds(s)});
+                     }
+
+                     return samples;
+                   });
+  }
+
+  m_metrics->start();
+}
+
+void Dumper::stop_metrics() {
+  if (m_metrics) {
+    m_metrics->stop();
+  }
+}
+
 std::string Dumper::throughput() const {
   std::lock_guard<std::recursive_mutex> lock(m_throughput_mutex);
 
@@ -45,17 +45,18 @@
 #include "mysqlshdk/libs/utils/synchronized_queue.h"
 #include "mysqlshdk/libs/utils/version.h"
 
+#include "modules/util/common/dump/metrics_writer.h"
+#include "modules/util/common/dump/stage_timer.h"
 #include "modules/util/dump/capability.h"
 #include "modules/util/dump/dump_options.h"
 #include "modules/util/dump/dump_writer.h"
 #include "modules/util/dump/instance_cache.h"
 #include "modules/util/dump/progress_thread.h"
+#include "modules/util/dump/schema_dumper.h"
 
 namespace mysqlsh {
 namespace dump {
 
-class Schema_dumper;
-
 class Dumper {
  public:
   Dumper() = delete;
@@ -114,6 +115,12 @@ class Dumper {
 
   bool dump_users() const;
 
+  /**
+   * Pattern matching the files written when output of a single file dump is
+   * split.
+   */
+  std::string split_output_pattern() const;
+
  private:
   class Dump_writer_controller;
   class Single_file_writer_controller;
@@ -167,6 +174,9 @@ class Dumper {
 
   class Memory_dumper;
 
+  using Ddl_check =
+      std::function<std::vector<Schema_dumper::Issue>(Schema_dumper *)>;
+
   virtual const char *name() const = 0;
 
   virtual void summary() const = 0;
@@ -216,7 +226,15 @@ class Dumper {
 
   void create_schema_tasks();
 
-  void validate_mds() const;
+  void validate_mds();
+
+  /**
+   * Executes the given checks, uses worker sessions if there are enough
+   * objects to check. Results are returned in the order of checks.
+   */
+  std::vector<std::vector<Schema_dumper::Issue>> run_ddl_checks(
+      std::vector<Ddl_check> &&checks,
+      const std::shared_ptr<std::atomic<uint64_t>> &progress);
 
   void initialize_counters();
 
@@ -224,6 +242,25 @@ class Dumper {
 
   void finalize_dump();
 
+  void merge_output_parts();
+
+  /**
+   * Removes the parts of a chunked export, used if export did not succeed.
+   */
+  void remove_output_parts() const;
+
+  /**
+   * Options used to compress the files written by a single writer.
+   */
+  mysqlshdk::storage::Compression_options compression_options() const;
+
+  /**
+   * Wraps the given data file, so that its IO operations are timed, and
+   * compresses it using the requested compression.
+   */
+  std::unique_ptr<mysqlshdk::storage::IFile> make_data_file(
+      std::unique_ptr<mysqlshdk::storage::IFile> file) const;
+
   void create_output_directory();
 
   void close_output_directory();
@@ -312,6 +349,11 @@ class Dumper {
 
   void summarize() const;
 
+  /**
+   * Stages of the data dump, reported in the summary and the metrics.
+   */
+  std::vector<common::Stage_description> stages() const;
+
   void rethrow() const;
 
   void emergency_shutdown();
@@ -330,6 +372,10 @@ class Dumper {
 
   void shutdown_progress();
 
+  void start_metrics();
+
+  void stop_metrics();
+
   std::string throughput() const;
 
   mysqlshdk::storage::IDirectory *directory() const;
@@ -397,6 +443,8 @@ class Dumper {
   std::vector<Schema_info> m_schema_infos;
   std::unordered_map<std::string, std::size_t> m_truncated_basenames;
   std::string m_table_data_extension;
+  // basename of the chunks, if data of a single file dump is chunked
+  std::string m_output_parts_basename;
 
   // status variables
   bool m_instance_locked = false;
@@ -457,6 +505,13 @@ class Dumper {
 
   shcore::Synchronized_queue<std::shared_ptr<mysqlshdk::db::ISession>>
       m_session_pool;
+
+  // time spent by each worker in each of the stages
+  std::unique_ptr<common::Stage_timer[]> m_worker_timers;
+
+  // metrics writer needs to be placed after any of the fields it uses, for the
+  // same reasons as the progress thread
+  std::unique_ptr<common::Metrics_writer> m_metrics;
 };
 
 }  // namespace dump
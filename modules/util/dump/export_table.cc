@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, 2022, Oracle and/or its affiliates.
+ * Copyright (c) 2020, 2023, Oracle and/or its affiliates.
  *
  * This program is free software; you can redistribute it and/or modify
  * it under the terms of the GNU General Public License, version 2.0,
@@ -49,8 +49,10 @@ void Export_table::summary() const {
     throw std::logic_error("Internal error - table was not dumped!");
   }
 
-  const auto quoted_filename =
-      shcore::quote_string(m_options.output_url(), '"');
+  const auto quoted_filename = shcore::quote_string(
+      m_options.split_output() ? split_output_pattern()
+                               : m_options.output_url(),
+      '"');
   const auto import_table =
       shcore::get_member_name("importTable", shcore::current_naming_style());
   shcore::Dictionary_t options = shcore::make_dict();
@@ -61,11 +61,13 @@ class Export_table_options : public Dump_options {
 
   bool use_single_file() const override { return true; }
 
-  bool split() const override { return false; }
+  bool split_output() const override { return m_split_output; }
 
-  uint64_t bytes_per_chunk() const override { return 0; }
+  bool split() const override { return m_threads > 1 || m_split_output; }
 
-  std::size_t threads() const override { return 1; }
+  uint64_t bytes_per_chunk() const override { return m_bytes_per_chunk; }
+
+  std::size_t threads() const override { return m_threads; }
 
   bool dump_ddl() const override { return false; }
 
@@ -99,12 +101,18 @@ class Export_table_options : public Dump_options {
 
   void on_set_schema();
 
+  void set_bytes_per_chunk(const std::string &value);
+
   std::string m_schema;
   std::string m_table;
 
   std::string m_where;
   std::unordered_set<std::string> m_partitions;
 
+  uint64_t m_threads = 1;
+  uint64_t m_bytes_per_chunk;
+  bool m_split_output = false;
+
   mysqlshdk::oci::Oci_bucket_options m_oci_bucket_options;
   mysqlshdk::aws::S3_bucket_options m_s3_bucket_options;
   mysqlshdk::azure::Blob_storage_options m_blob_storage_options;
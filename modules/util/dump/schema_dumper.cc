@@ -975,22 +975,24 @@ std::vector<Schema_dumper::Issue> Schema_dumper::check_ct_for_mysqlaas(
     }
   }
 
+  // statement is tokenized once, checks only record the changes, which are
+  // applied in a single pass
+  compatibility::Create_table_statement statement{*create_table};
+
   if (opt_mysqlaas) {
-    if (compatibility::check_create_table_for_data_index_dir_option(
-            *create_table, create_table))
+    if (statement.check_data_index_dir_option(true))
       res.emplace_back(
           prefix + "had {DATA|INDEX} DIRECTORY table option commented out",
           Issue::Status::FIXED);
 
-    if (compatibility::check_create_table_for_encryption_option(*create_table,
-                                                                create_table))
+    if (statement.check_encryption_option(true))
       res.emplace_back(prefix + "had ENCRYPTION table option commented out",
                        Issue::Status::FIXED);
   }
 
   if (opt_mysqlaas || opt_force_innodb) {
-    const auto engine = compatibility::check_create_table_for_engine_option(
-        *create_table, opt_force_innodb ? create_table : nullptr);
+    const auto engine =
+        statement.check_engine_option("InnoDB", opt_force_innodb);
     if (!engine.empty()) {
       if (opt_force_innodb)
         res.emplace_back(
@@ -1005,8 +1007,7 @@ std::vector<Schema_dumper::Issue> Schema_dumper::check_ct_for_mysqlaas(
     // FIXED row format right away
     const auto remove_fixed_row_format = opt_force_innodb || engine.empty();
 
-    if (compatibility::check_create_table_for_fixed_row_format(
-            *create_table, remove_fixed_row_format ? create_table : nullptr)) {
+    if (statement.check_fixed_row_format(remove_fixed_row_format)) {
       if (remove_fixed_row_format) {
         res.emplace_back(
             prefix + "had unsupported ROW_FORMAT=FIXED option removed",
@@ -1019,8 +1020,8 @@ std::vector<Schema_dumper::Issue> Schema_dumper::check_ct_for_mysqlaas(
   }
 
   if (opt_mysqlaas || opt_strip_tablespaces) {
-    if (compatibility::check_create_table_for_tablespace_option(
-            *create_table, opt_strip_tablespaces ? create_table : nullptr)) {
+    if (statement.check_tablespace_option({"innodb_"},
+                                          opt_strip_tablespaces)) {
       if (opt_strip_tablespaces)
         res.emplace_back(prefix + "had unsupported tablespace option removed",
                          Issue::Status::FIXED);
@@ -1030,6 +1031,10 @@ std::vector<Schema_dumper::Issue> Schema_dumper::check_ct_for_mysqlaas(
     }
   }
 
+  if (statement.modified()) {
+    *create_table = statement.rewrite();
+  }
+
   if (opt_mysqlaas) {
     std::size_t count = 0;
 
@@ -248,6 +248,9 @@ struct File_import_info {
   std::pair<size_t, size_t> range{0, 0};
   std::string context;
   bool is_guard = true;
+  bool whole_file = true;  //< Whole file vs chunk of a split file
+  // if false, progress of file reads is reported by the producer of this task
+  bool report_file_progress = true;
 };
 
 /**
@@ -28,6 +28,7 @@
 #include <cstring>
 #include <limits>
 #include <utility>
+#include <vector>
 
 #include "modules/util/dump/console_with_progress.h"
 #include "mysqlshdk/include/shellcore/shell_options.h"
@@ -37,6 +38,7 @@
 #include "mysqlshdk/libs/storage/backend/in_memory/virtual_file_adapter.h"
 #include "mysqlshdk/libs/storage/idirectory.h"
 #include "mysqlshdk/libs/textui/text_progress.h"
+#include "mysqlshdk/libs/utils/logger.h"
 #include "mysqlshdk/libs/utils/natural_compare.h"
 #include "mysqlshdk/libs/utils/strformat.h"
 #include "mysqlshdk/libs/utils/utils_file.h"
@@ -164,6 +166,14 @@ void Import_table::chunk_file() {
 void Import_table::build_queue() {
   m_total_file_size = 0;
 
+  struct Input_file {
+    std::string path;
+    std::unique_ptr<mysqlshdk::storage::IFile> file;
+    std::size_t size;
+  };
+
+  std::vector<Input_file> files;
+
   for (const auto &glob_item : m_opt.filelist_from_user()) {
     if (glob_item.find('*') != std::string::npos ||
         glob_item.find('?') != std::string::npos) {
@@ -177,36 +187,95 @@ void Import_table::build_queue() {
         continue;
       }
 
-      const auto list_files =
-          dir->filter_files_sorted(shcore::path::basename(glob_item));
+      const auto basename = shcore::path::basename(glob_item);
+      const auto prefix =
+          glob_item.substr(0, glob_item.length() - basename.length());
+      const auto list_files = dir->filter_files_sorted(basename);
 
       for (const auto &file_info : list_files) {
-        File_import_info task;
-        task.file = m_opt.create_file_handle(dir->file(file_info.name()));
-        task.range_read = false;
-        task.is_guard = false;
-
-        m_total_file_size += file_info.size();
-        m_has_compressed_files |= task.file->is_compressed();
-        m_range_queue.push(std::move(task));
+        files.emplace_back(Input_file{
+            prefix + file_info.name(),
+            m_opt.create_file_handle(dir->file(file_info.name())),
+            file_info.size()});
       }
     } else {
-      File_import_info task;
-      task.file = m_opt.create_file_handle(glob_item);
-      task.range_read = false;
-      task.is_guard = false;
+      auto file = m_opt.create_file_handle(glob_item);
 
-      if (!task.file->exists()) {
-        std::string errmsg{"File " + task.file->full_path().masked() +
+      if (!file->exists()) {
+        std::string errmsg{"File " + file->full_path().masked() +
                            " does not exist."};
         current_console()->print_error(errmsg);
         noncritical_errors.emplace_back(std::move(errmsg));
         continue;
       }
 
-      m_total_file_size += task.file->file_size();
-      m_has_compressed_files |= task.file->is_compressed();
+      const auto size = file->file_size();
+      files.emplace_back(Input_file{glob_item, std::move(file), size});
+    }
+  }
+
+  for (const auto &file : files) {
+    m_total_file_size += file.size;
+    m_has_compressed_files |= file.file->is_compressed();
+  }
+
+  // A file is loaded by a single thread, if some of the files are much larger
+  // than the others, most of the threads are going to be idle. Files which are
+  // larger than the fair share of a thread are split into chunks by this
+  // thread (decompressing them if needed), chunks are then loaded in parallel.
+  const auto threads = static_cast<std::size_t>(m_opt.threads_size());
+  std::vector<Input_file> split;
+
+  if (threads > 1 && m_opt.dialect_supports_chunking()) {
+    const auto fair_share = m_total_file_size / threads;
+
+    for (auto &file : files) {
+      // size of compressed files is not known, they are always split
+      if (file.size > fair_share && (file.file->is_compressed() ||
+                                     file.size > m_opt.bytes_per_chunk())) {
+        split.emplace_back(std::move(file));
+      }
+    }
+  }
+
+  // whole files are scheduled first, chunks of split files are throttled and
+  // are scheduled when threads become available
+  for (auto &file : files) {
+    if (file.file) {
+      File_import_info task;
+      task.file = std::move(file.file);
+      task.range_read = false;
+      task.is_guard = false;
+
       m_range_queue.push(std::move(task));
+      ++m_scheduled_tasks;
+    }
+  }
+
+  if (!split.empty()) {
+    create_allocator(std::max_element(split.begin(), split.end(),
+                                      [](const auto &l, const auto &r) {
+                                        return l.size < r.size;
+                                      })
+                         ->size);
+
+    for (const auto &file : split) {
+      if (interrupted()) {
+        break;
+      }
+
+      const auto compressed = file.file->is_compressed();
+
+      log_info("Splitting file %s into chunks",
+               file.file->full_path().masked().c_str());
+
+      // chunks of compressed files hold decompressed data, file progress is
+      // reported here, once whole file is read
+      split_file(file.path, !compressed);
+
+      if (compressed) {
+        m_prog_file_bytes += file.size;
+      }
     }
   }
 
@@ -279,29 +348,56 @@ std::string Import_table::rows_affected_info() {
          ": " + m_stats.to_string();
 }
 
+void Import_table::create_allocator(std::size_t file_size) {
+  // if file is big enough, we fetch it in 1MB chunks
+  static constexpr std::size_t k_one_mb = 1024 * 1024;
+  m_block_size = file_size >= k_one_mb * m_opt.threads_size() &&
+                         m_opt.bytes_per_chunk() >= k_one_mb
+                     ? k_one_mb
+                     : 8192;
+  // each thread fetches block_size bytes, a page holds enough memory for all
+  // threads
+  m_allocator = std::make_unique<mysqlshdk::storage::in_memory::Allocator>(
+      m_opt.threads_size() * m_block_size, m_block_size);
+}
+
 void Import_table::scan_file() {
+  create_allocator(m_opt.file_size());
+
+  // If file is compressed, the total size needs to correspond to the
+  // uncompressed size, because otherwise progress will go over 100%
+  // (Load_data_worker works with an in-memory file and has no information
+  // regarding the size of compressed reads). We set it here to zero and update
+  // it once its known. When total is zero, progress is displayed as follows:
+  //   ?% (58.11 MB / ?), 28.15 MB/s
+  if (m_has_compressed_files) {
+    m_prog_total_file_bytes = 0;
+  }
+
+  m_total_file_size = m_opt.file_size();
+
+  const auto total_size = split_file(m_opt.single_file(), true);
+
+  if (m_has_compressed_files) {
+    m_prog_total_file_bytes = total_size;
+  }
+
+  m_range_queue.shutdown(m_opt.threads_size());
+}
+
+std::size_t Import_table::split_file(const std::string &path,
+                                     bool report_file_progress) {
   using mysqlshdk::storage::Mode;
   using mysqlshdk::storage::in_memory::Allocated_file;
-  using mysqlshdk::storage::in_memory::Allocator;
   using mysqlshdk::storage::in_memory::Scoped_data_block;
   using mysqlshdk::storage::in_memory::threaded_file;
   using mysqlshdk::storage::in_memory::Threaded_file_config;
   using mysqlshdk::storage::in_memory::Virtual_file_adapter;
 
-  // if file is big enough, we fetch it in 1MB chunks
-  static constexpr std::size_t k_one_mb = 1024 * 1024;
-  const std::size_t block_size =
-      m_opt.file_size() >= k_one_mb * m_opt.threads_size() &&
-              m_opt.bytes_per_chunk() >= k_one_mb
-          ? k_one_mb
-          : 8192;
-  // each thread fetches block_size bytes, a page holds enough memory for all
-  // threads
-  m_allocator = std::make_unique<Allocator>(m_opt.threads_size() * block_size,
-                                            block_size);
+  const auto block_size = m_block_size;
 
   Threaded_file_config config;
-  config.file_path = m_opt.single_file();
+  config.file_path = path;
   config.config = m_opt.storage_config();
   config.threads = m_opt.threads_size();
   config.max_memory = m_opt.bytes_per_chunk();
@@ -316,9 +412,8 @@ void Import_table::scan_file() {
   });
 
   Scanner scanner{m_opt.dialect(), m_opt.skip_rows_count()};
-  const auto make_chunk = [this]() {
-    return std::make_unique<Allocated_file>(m_opt.single_file(),
-                                            m_allocator.get(), true);
+  const auto make_chunk = [this, &path]() {
+    return std::make_unique<Allocated_file>(path, m_allocator.get(), true);
   };
   std::unique_ptr<Allocated_file> chunk;
   File_import_info info;
@@ -331,7 +426,7 @@ void Import_table::scan_file() {
       }
 
       // wait for at least one thread to be available
-      if (scheduled_chunks - m_stats.total_files_processed >=
+      if (m_scheduled_tasks - m_stats.total_tasks_processed >=
           static_cast<std::size_t>(m_opt.threads_size())) {
         shcore::sleep_ms(100);
       } else {
@@ -342,6 +437,8 @@ void Import_table::scan_file() {
     info.range.second = chunk->size();
     info.is_guard = false;
     info.range_read = true;
+    info.report_file_progress = report_file_progress;
+    info.whole_file = false;
     info.file = std::make_unique<Virtual_file_adapter>(std::move(chunk));
 
     assert(extracted_blocks > 0);
@@ -351,20 +448,10 @@ void Import_table::scan_file() {
                    std::to_string(file_offset + info.range.second) + ")";
 
     m_range_queue.push(std::move(info));
+    ++m_scheduled_tasks;
     ++scheduled_chunks;
   };
 
-  // If file is compressed, the total size needs to correspond to the
-  // uncompressed size, because otherwise progress will go over 100%
-  // (Load_data_worker works with an in-memory file and has no information
-  // regarding the size of compressed reads). We set it here to zero and update
-  // it once its known. When total is zero, progress is displayed as follows:
-  //   ?% (58.11 MB / ?), 28.15 MB/s
-  if (m_has_compressed_files) {
-    m_prog_total_file_bytes = 0;
-  }
-
-  m_total_file_size = m_opt.file_size();
   std::size_t total_size = 0;
 
   // skip rows, then schedule blocks
@@ -424,11 +511,16 @@ void Import_table::scan_file() {
     }
   }
 
-  if (m_has_compressed_files) {
-    m_prog_total_file_bytes = total_size;
+  if (!interrupted()) {
+    log_info("File %s was split into %zu chunks",
+             source->full_path().masked().c_str(), scheduled_chunks);
+
+    // count the file here, it may not yield any chunks (i.e. if all rows were
+    // skipped)
+    ++m_stats.total_files_processed;
   }
 
-  m_range_queue.shutdown(m_opt.threads_size());
+  return total_size;
 }
 
 }  // namespace import_table
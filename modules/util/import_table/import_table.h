@@ -68,6 +68,8 @@ struct Stats {
   // total number of physical bytes processed
   std::atomic<size_t> total_file_bytes{0};
   std::atomic<size_t> total_files_processed{0};
+  // total number of tasks (whole files or chunks of files) processed
+  std::atomic<size_t> total_tasks_processed{0};
 
   std::array<std::atomic<size_t>, Thread_state::LAST> thread_states{};
 
@@ -108,6 +110,8 @@ class Import_table final {
   void progress_setup();
   void progress_shutdown();
   void scan_file();
+  void create_allocator(std::size_t file_size);
+  std::size_t split_file(const std::string &path, bool report_file_progress);
 
   inline bool interrupted() const {
     return (m_interrupt && *m_interrupt) || any_exception();
@@ -120,6 +124,8 @@ class Import_table final {
   bool m_has_compressed_files = false;
 
   std::unique_ptr<mysqlshdk::storage::in_memory::Allocator> m_allocator;
+  std::size_t m_block_size = 0;
+  std::size_t m_scheduled_tasks = 0;
 
   shcore::Synchronized_queue<File_import_info> m_range_queue;
 
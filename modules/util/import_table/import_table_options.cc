@@ -385,8 +385,9 @@ uint64_t Import_table_option_pack::bytes_per_chunk() const {
   if (m_bytes_per_chunk.has_value()) {
     return *m_bytes_per_chunk;
   } else {
-    // at this point m_bytes_per_chunk should have a value
-    assert(false);
+    // user cannot set this value when loading multiple files, default value is
+    // used when splitting large files
+    assert(is_multifile());
     return mysqlshdk::utils::expand_to_bytes(k_default_chunk_size);
   }
 }
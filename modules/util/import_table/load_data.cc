@@ -44,6 +44,7 @@ using off64_t = off_t;
 #include <memory>
 #include <utility>
 
+#include "modules/util/common/dump/stage_timer.h"
 #include "modules/util/import_table/helpers.h"
 #include "mysqlshdk/include/shellcore/console.h"
 #include "mysqlshdk/include/shellcore/scoped_contexts.h"
@@ -523,6 +524,9 @@ int local_infile_init(void **buffer, const char * /* filename */,
   file_info->compressed_file =
       dynamic_cast<mysqlshdk::storage::Compressed_file *>(
           file_info->filehandler.get());
+  file_info->read_ahead_file =
+      dynamic_cast<mysqlshdk::storage::Read_ahead_file *>(
+          file_info->filehandler.get());
   file_info->data_bytes = 0;
   file_info->file_bytes = 0;
   file_info->rate_limit = mysqlshdk::utils::Rate_limit(file_info->max_rate);
@@ -550,12 +554,24 @@ int local_infile_read(void *userdata, char *buffer,
       bytes = 0;
     } else {
       // read from the file until either EOF, or we read enough data to fill
-      // the buffer or the transaction
-      bytes = file_info->buffer.read(buffer, len);
+      // the buffer or the transaction; if data is read ahead by background
+      // threads, they measure the time spent in storage and decompression,
+      // here it's just the time spent waiting for them
+      {
+        dump::common::Stage_timer::Scope reading{
+            file_info->read_ahead_file ? dump::common::Stage::WAITING
+                                       : dump::common::Stage::COMPRESSION,
+            nullptr != file_info->compressed_file ||
+                nullptr != file_info->read_ahead_file};
+        bytes = file_info->buffer.read(buffer, len);
+      }
+
       if (bytes < 0) return bytes;
       assert(static_cast<size_t>(bytes) <= len);
 
-      if (file_info->compressed_file) {
+      if (file_info->read_ahead_file) {
+        file_bytes = file_info->read_ahead_file->latest_io_size();
+      } else if (file_info->compressed_file) {
         file_bytes = file_info->compressed_file->latest_io_size();
       } else {
         file_bytes = bytes;
@@ -573,7 +589,10 @@ int local_infile_read(void *userdata, char *buffer,
   *(file_info->prog_data_bytes) += bytes;
   file_info->data_bytes += bytes;
 
-  *(file_info->prog_file_bytes) += file_bytes;
+  if (file_info->prog_file_bytes) {
+    *(file_info->prog_file_bytes) += file_bytes;
+  }
+
   file_info->file_bytes += file_bytes;
 
   if (file_info->rate_limit.enabled()) {
@@ -847,13 +866,18 @@ void Load_data_worker::execute(
 
             fi.filehandler = std::move(r.file);
             fi.range_read = r.range_read;
+            fi.whole_file = r.whole_file;
+            fi.prog_file_bytes =
+                r.report_file_progress ? m_prog_file_bytes : nullptr;
 
             if (r.range_read) {
               fi.bytes_left = r.range.second - r.range.first;
-              // maxBytesPerTransaction is ignored in case of a file imported in
-              // chunks, because we assume that in this case bytesPerChunk ==
-              // maxBytesPerTransaction
-              max_trx_size = 0;
+              // maxBytesPerTransaction is ignored in case of a single file
+              // imported in chunks, because we assume that in this case
+              // bytesPerChunk == maxBytesPerTransaction; chunks of split files
+              // use the default chunk size, which can be larger, and they hold
+              // just the data of the range, so they can be sub-chunked
+              max_trx_size = r.whole_file ? 0 : m_opt.max_transaction_size();
 
               // if fi.range_read == true, we're importing in chunks from a
               // single file, rows were already skipped
@@ -917,12 +941,22 @@ void Load_data_worker::execute(
         load_result = query(m_query_comment + full_query);
         set_state(Thread_state::IDLE);
         fi.buffer.flush_done(&fi.continuation);
+
+        if (fi.range_read && 0 == fi.bytes_left) {
+          // whole range was loaded, even if EOF was not reached yet
+          fi.continuation = false;
+        }
         m_stats.total_data_bytes += fi.data_bytes;
         m_stats.total_file_bytes += fi.file_bytes;
 
         if (!fi.continuation) {
-          // increase the counter only when there are no more subchunks
-          ++m_stats.total_files_processed;
+          // increase the counters only when there are no more subchunks
+          ++m_stats.total_tasks_processed;
+
+          // split files are counted when they are split
+          if (fi.whole_file) {
+            ++m_stats.total_files_processed;
+          }
         }
       } catch (const mysqlshdk::db::Error &e) {
         handle_exception();
@@ -39,6 +39,7 @@
 #include "mysqlshdk/libs/db/mysql/session.h"
 #include "mysqlshdk/libs/storage/compressed_file.h"
 #include "mysqlshdk/libs/storage/ifile.h"
+#include "mysqlshdk/libs/storage/read_ahead_file.h"
 #include "mysqlshdk/libs/textui/text_progress.h"
 #include "mysqlshdk/libs/utils/rate_limit.h"
 #include "mysqlshdk/libs/utils/synchronized_queue.h"
@@ -129,8 +130,10 @@ struct File_info {
   int64_t worker_id = -1;  //< Thread worker id
   std::unique_ptr<mysqlshdk::storage::IFile> filehandler = nullptr;
   mysqlshdk::storage::Compressed_file *compressed_file = nullptr;
+  mysqlshdk::storage::Read_ahead_file *read_ahead_file = nullptr;
   size_t bytes_left = 0;    //< Bytes left to read from file
   bool range_read = false;  //< Reading whole file vs chunk range
+  bool whole_file = true;   //< Whole file vs chunk of a split file
 
   size_t data_bytes = 0;  //< bytes send to MySQL server
   size_t file_bytes = 0;  //< bytes read from the file
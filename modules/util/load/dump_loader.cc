@@ -51,6 +51,7 @@
 #include "mysqlshdk/libs/mysql/script.h"
 #include "mysqlshdk/libs/mysql/utils.h"
 #include "mysqlshdk/libs/storage/compressed_file.h"
+#include "mysqlshdk/libs/storage/read_ahead_file.h"
 #include "mysqlshdk/libs/utils/debug.h"
 #include "mysqlshdk/libs/utils/fault_injection.h"
 #include "mysqlshdk/libs/utils/strformat.h"
@@ -58,6 +59,7 @@
 #include "mysqlshdk/libs/utils/utils_lexing.h"
 #include "mysqlshdk/libs/utils/utils_mysql_parsing.h"
 #include "mysqlshdk/libs/utils/utils_net.h"
+#include "mysqlshdk/libs/utils/utils_sqlstring.h"
 #include "mysqlshdk/libs/utils/version.h"
 
 namespace mysqlsh {
@@ -88,6 +90,11 @@ static constexpr const auto k_chunk_size_overshoot_tolerance = 1.5;
 
 namespace {
 
+constexpr const char *k_restore_ddl_threads =
+    "SET @@SESSION.innodb_ddl_threads=DEFAULT, "
+    "@@SESSION.innodb_parallel_read_threads=DEFAULT, "
+    "@@SESSION.innodb_ddl_buffer_size=DEFAULT";
+
 bool histograms_supported(const Version &version) {
   return version > Version(8, 0, 0);
 }
@@ -804,8 +811,38 @@ void Dump_loader::Worker::Load_chunk_task::load(
 
     options.skip_bytes = m_bytes_to_skip;
 
-    op.execute(session, mysqlshdk::storage::make_file(std::move(m_file), compr),
-               options);
+    auto file = std::move(m_file);
+
+    // in-memory files used by fast sub-chunking do not perform any IO and
+    // cannot be wrapped, local files compressed with zstd are read using
+    // memory-mapped IO, which would be disabled by the wrapper
+    if (!options.fast_sub_chunking &&
+        (!file->is_local() || mysqlshdk::storage::Compression::ZSTD != compr)) {
+      file = dump::common::make_timed_file(std::move(file));
+    }
+
+    if (mysqlshdk::storage::Compression::NONE != compr) {
+      using mysqlshdk::storage::Read_ahead_file;
+
+      // overlap I/O, decompression and LOAD DATA executed by this thread:
+      // compressed data is fetched ahead by one background thread (unless
+      // file is local, in which case it may use memory-mapped IO), and
+      // decompressed ahead by another one, both threads are reused
+      auto &threads = *worker->read_ahead_threads();
+
+      if (!file->is_local()) {
+        file = dump::common::make_timed_file(
+            std::make_unique<Read_ahead_file>(std::move(file), threads),
+            dump::common::Stage::WAITING);
+      }
+
+      file = std::make_unique<Read_ahead_file>(
+          mysqlshdk::storage::make_file(std::move(file), compr), threads);
+    }
+
+    // time spent in reading and decompressing the data is counted separately
+    dump::common::Stage_timer::Scope server{dump::common::Stage::SERVER};
+    op.execute(session, std::move(file), options);
   }
 
   if (loader->m_thread_exceptions[id()])
@@ -891,6 +928,33 @@ bool Dump_loader::Worker::Index_recreation_task::execute(
     loader->m_num_threads_recreating_indexes++;
     shcore::on_leave_scope cleanup(
         [loader]() { loader->m_num_threads_recreating_indexes--; });
+    dump::common::Stage_timer::Scope indexes{dump::common::Stage::INDEXES};
+
+    // server uses as many threads as the scheduler has reserved for this
+    // task, session is pooled, so the global values are restored afterwards
+    const auto set_ddl_threads = ddl_threads_statement();
+    bool restore_ddl_threads = false;
+
+    if (!set_ddl_threads.empty()) {
+      try {
+        Dump_loader::execute(session, set_ddl_threads);
+        restore_ddl_threads = true;
+      } catch (const mysqlshdk::db::Error &e) {
+        log_warning("%sFailed to set the number of DDL threads for %s: %s",
+                    log_id(), key().c_str(), e.format().c_str());
+      }
+    }
+
+    shcore::on_leave_scope restore([this, &session, restore_ddl_threads]() {
+      if (restore_ddl_threads) {
+        try {
+          Dump_loader::execute(session, k_restore_ddl_threads);
+        } catch (const std::exception &e) {
+          log_warning("%sFailed to restore the number of DDL threads: %s",
+                      log_id(), e.what());
+        }
+      }
+    });
 
     // for the analysis of various index types and their impact on the parallel
     // index creation see: BUG#33976718
@@ -1008,7 +1072,21 @@ bool Dump_loader::Worker::Index_recreation_task::execute(
 }
 
 Dump_loader::Worker::Worker(size_t id, Dump_loader *owner)
-    : m_id(id), m_owner(owner), m_connection_id(0) {}
+    : m_id(id),
+      m_owner(owner),
+      m_connection_id(0),
+      m_read_ahead_threads(
+          std::make_unique<mysqlshdk::storage::Read_ahead_threads>(
+              [this](const std::function<void()> &read) {
+                // time spent in the background threads is counted towards
+                // this worker, waits for the data are measured by the
+                // consumers and are not counted as decompression
+                dump::common::Stage_timer::Activate timer{
+                    &m_owner->m_worker_timers[m_id]};
+                dump::common::Stage_timer::Scope decompression{
+                    dump::common::Stage::COMPRESSION};
+                read();
+              })) {}
 
 void Dump_loader::Worker::run() {
   try {
@@ -1026,6 +1104,7 @@ void Dump_loader::Worker::run() {
 
 void Dump_loader::Worker::do_run() {
   auto console = current_console();
+  dump::common::Stage_timer::Activate timer{&m_owner->m_worker_timers[m_id]};
 
   try {
     connect();
@@ -1047,7 +1126,21 @@ void Dump_loader::Worker::do_run() {
 
     assert(std::numeric_limits<size_t>::max() != m_task->id());
 
-    if (!m_task->execute(m_session, this, m_owner)) break;
+    const auto busy_ns =
+        m_owner->m_worker_busy_ns ? &m_owner->m_worker_busy_ns[m_id] : nullptr;
+    const auto start = busy_ns ? std::chrono::steady_clock::now()
+                               : std::chrono::steady_clock::time_point{};
+
+    const auto result = m_task->execute(m_session, this, m_owner);
+
+    if (busy_ns) {
+      busy_ns->fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                             std::chrono::steady_clock::now() - start)
+                             .count(),
+                         std::memory_order_relaxed);
+    }
+
+    if (!result) break;
   }
 }
 
@@ -1740,13 +1833,20 @@ size_t Dump_loader::handle_worker_events(
       } else {
         assert(!m_pending_tasks.empty());
 
-        const auto pending_weight = m_pending_tasks.top()->weight();
+        auto task = m_pending_tasks.pop_top();
+        // weight of the task may depend on the number of idle threads
+        task->fit_weight(thread_count - m_current_weight);
+        task->set_weight(std::min<uint64_t>(task->weight(), thread_count));
+
+        const auto pending_weight = task->weight();
 
         if (m_current_weight + pending_weight > thread_count) {
           // the task is too heavy, wait till more threads are idle
+          m_pending_tasks.emplace(std::move(task));
           idle_workers.push_back(event.worker);
         } else {
-          event.worker->schedule(m_pending_tasks.pop_top());
+          event.worker->schedule(std::move(task));
+          m_num_pending_tasks = m_pending_tasks.size();
           m_current_weight += pending_weight;
         }
       }
@@ -1848,6 +1948,11 @@ void Dump_loader::run() {
 
     open_dump();
 
+    m_worker_timers = std::make_unique<dump::common::Stage_timer[]>(
+        m_options.threads_count());
+    start_metrics();
+    shcore::on_leave_scope cleanup_metrics([this]() { stop_metrics(); });
+
     spawn_workers();
 
     {
@@ -1938,6 +2043,26 @@ void Dump_loader::show_summary() {
         shcore::str_format("There were %zi retries to create indexes.",
                            m_num_index_retries.load()));
   }
+
+  dump::common::print_stage_summary(m_worker_timers.get(),
+                                    m_options.threads_count(), stages());
+}
+
+std::vector<dump::common::Stage_description> Dump_loader::stages() {
+  return {
+      {dump::common::Stage::STORAGE, "storage",
+       "reading data from the storage",
+       "consider running the load on a host closer to the storage, or adding "
+       "more threads if the bandwidth is not saturated"},
+      {dump::common::Stage::COMPRESSION, "decompression", "decompressing data",
+       "adding more threads may help if this host has spare CPU capacity"},
+      {dump::common::Stage::SERVER, "server", "executing LOAD DATA statements",
+       "adding more threads may help if the server has spare capacity, "
+       "otherwise the server is saturated"},
+      {dump::common::Stage::INDEXES, "indexes", "recreating indexes",
+       "consider increasing the innodb_ddl_threads and innodb_ddl_buffer_size "
+       "system variables"},
+  };
 }
 
 void Dump_loader::open_dump() { open_dump(m_options.create_dump_handle()); }
@@ -3082,6 +3207,104 @@ void Dump_loader::spawn_workers() {
   }
 }
 
+void Dump_loader::start_metrics() {
+  if (m_options.metrics_file().empty()) {
+    return;
+  }
+
+  using Type = dump::common::Metrics_writer::Type;
+  using Sample = dump::common::Metrics_writer::Sample;
+
+  const auto threads = m_options.threads_count();
+  m_worker_busy_ns = std::make_unique<std::atomic<uint64_t>[]>(threads);
+  m_metrics =
+      std::make_unique<dump::common::Metrics_writer>(m_options.metrics_file());
+
+  const auto counter = [this](const char *name, const char *help,
+                              const auto &value) {
+    m_metrics->add(Type::COUNTER, name, help,
+                   [&value]() { return static_cast<double>(value.load()); });
+  };
+
+  const auto gauge = [this](const char *name, const char *help,
+                            const auto &value) {
+    m_metrics->add(Type::GAUGE, name, help,
+                   [&value]() { return static_cast<double>(value.load()); });
+  };
+
+  counter("mysqlsh_load_rows_total", "Number of rows loaded.",
+          m_num_rows_loaded);
+  counter("mysqlsh_load_data_bytes_total",
+          "Number of uncompressed data bytes loaded.", m_num_bytes_loaded);
+  counter("mysqlsh_load_file_bytes_total",
+          "Number of bytes read from the dump files.", m_num_raw_bytes_loaded);
+  counter("mysqlsh_load_chunks_total", "Number of chunks loaded.",
+          m_num_chunks_loaded);
+  counter("mysqlsh_load_warnings_total",
+          "Number of warnings reported by the server.", m_num_warnings);
+  counter("mysqlsh_load_errors_total", "Number of errors.", m_num_errors);
+  counter("mysqlsh_load_ddl_executed_total",
+          "Number of DDL scripts executed.", m_ddl_executed);
+  counter("mysqlsh_load_indexes_recreated_total",
+          "Number of tables which had their indexes recreated.",
+          m_indexes_recreated);
+  counter("mysqlsh_load_tables_analyzed_total", "Number of tables analyzed.",
+          m_tables_analyzed);
+
+  gauge("mysqlsh_load_threads_loading", "Number of threads loading the data.",
+        m_num_threads_loading);
+  gauge("mysqlsh_load_threads_recreating_indexes",
+        "Number of threads recreating the indexes.",
+        m_num_threads_recreating_indexes);
+  gauge("mysqlsh_load_pending_tasks", "Number of tasks waiting for a worker.",
+        m_num_pending_tasks);
+
+  m_metrics->add(Type::GAUGE, "mysqlsh_load_pending_worker_events",
+                 "Number of worker events waiting to be handled.", [this]() {
+                   return static_cast<double>(m_worker_events.size());
+                 });
+
+  for (const auto &stage : stages()) {
+    m_metrics->add(Type::COUNTER,
+                   shcore::str_format("mysqlsh_load_worker_%s_seconds_total",
+                                      stage.name),
+                   shcore::str_format("Time spent %s.", stage.description),
+                   "worker", [this, threads, s = stage.stage]() {
+                     std::vector<Sample> samples;
+                     samples.reserve(threads);
+
+                     for (std::size_t i = 0; i < threads; ++i) {
+                       samples.emplace_back(Sample{
+                           std::to_string(i), m_worker_timers[i].seconds(s)});
+                     }
+
+                     return samples;
+                   });
+  }
+
+  m_metrics->add(Type::COUNTER, "mysqlsh_load_worker_busy_seconds_total",
+                 "Time spent executing the tasks.", "worker",
+                 [this, threads]() {
+                   std::vector<Sample> samples;
+                   samples.reserve(threads);
+
+                   for (std::size_t i = 0; i < threads; ++i) {
+                     samples.emplace_back(Sample{std::to_string(i),
+                                                 m_worker_busy_ns[i] / 1e9});
+                   }
+
+                   return samples;
+                 });
+
+  m_metrics->start();
+}
+
+void Dump_loader::stop_metrics() {
+  if (m_metrics) {
+    m_metrics->stop();
+  }
+}
+
 void Dump_loader::join_workers() {
   log_debug("Waiting on worker threads...");
   for (auto &w : m_workers) w.stop();
@@ -3331,6 +3554,27 @@ bool Dump_loader::should_create_pks() const {
   return m_dump->should_create_pks();
 }
 
+std::string Dump_loader::load_data_eta() const {
+  // total is not known until the dump is complete
+  if (!m_load_data_stage ||
+      Dump_reader::Status::COMPLETE != m_dump->status()) {
+    return {};
+  }
+
+  const auto elapsed = m_load_data_stage->duration().current();
+  const uint64_t loaded = m_num_bytes_loaded - m_num_bytes_previously_loaded;
+  const uint64_t total = m_dump->filtered_data_size();
+
+  // wait a bit for the throughput to stabilize
+  if (elapsed < 10.0 || !loaded || m_num_bytes_loaded >= total) {
+    return {};
+  }
+
+  const auto remaining = (total - m_num_bytes_loaded) * elapsed / loaded;
+
+  return ", ETA " + mysqlshdk::utils::format_seconds(remaining, false);
+}
+
 void Dump_loader::setup_load_data_progress() {
   // Progress mechanics:
   // - if the dump is complete when it's opened, we show progress and
@@ -3406,9 +3650,10 @@ void Dump_loader::setup_load_data_progress() {
 
   config.right_label = [this]() {
     return shcore::str_format(
-        ", %zu / %zu tables%s done", m_unique_tables_loaded.size(),
+        ", %zu / %zu tables%s done%s", m_unique_tables_loaded.size(),
         m_total_tables_with_data,
-        m_dump->has_partitions() ? " and partitions" : "");
+        m_dump->has_partitions() ? " and partitions" : "",
+        load_data_eta().c_str());
   };
   config.on_display_started = []() {
     current_console()->print_status("Starting data load");
@@ -3491,6 +3736,7 @@ void Dump_loader::push_pending_task(Task_ptr task) {
   }
 
   m_pending_tasks.emplace(std::move(task));
+  m_num_pending_tasks = m_pending_tasks.size();
 }
 
 Dump_loader::Task_ptr Dump_loader::load_chunk_file(
@@ -3526,24 +3772,78 @@ Dump_loader::Task_ptr Dump_loader::recreate_indexes(
   assert(!schema.empty());
   assert(!table.empty());
 
-  uint64_t weight = m_options.threads_per_add_index();
+  auto task = std::make_unique<Worker::Index_recreation_task>(
+      schema, table, indexes, m_options,
+      m_dump->table_data_size(schema, table));
 
-  if (weight > 1) {
-    if (auto table_size = m_dump->table_data_size(schema, table)) {
-      // size per each thread
-      table_size /= weight;
+  // weight used to order the pending tasks, adjusted when task is scheduled
+  task->fit_weight(m_options.threads_count());
 
-      // in case of small tables, we assume that they're not that impactful
-      if (table_size <= 10 * 1024 * 1024) {  // 10MiB
-        weight = 1;
-      }
-    }  // else, we don't have the size info, just use the default weight
+  return task;
+}
+
+uint64_t Dump_loader::index_recreation_weight(const Load_dump_options &options,
+                                              uint64_t table_size,
+                                              uint64_t idle_threads) {
+  // number of threads used by the server
+  auto weight = options.threads_per_add_index();
+
+  if (table_size) {
+    // in case of small tables, we assume that they're not that impactful,
+    // each thread should process at least 10MiB
+    const auto threads =
+        std::max<uint64_t>(table_size / (10 * 1024 * 1024), 1);
+
+    // if DDL threads are adjusted, server uses as many threads as reserved,
+    // otherwise global values are used
+    weight =
+        options.adjust_ddl_threads() ? threads : std::min(weight, threads);
+  }  // else, we don't have the size info, just use the default weight
+
+  return std::clamp<uint64_t>(weight, 1, std::max<uint64_t>(idle_threads, 1));
+}
+
+std::string Dump_loader::ddl_threads_statement(
+    const Load_dump_options &options, uint64_t threads) {
+  if (!options.adjust_ddl_threads()) {
+    return {};
   }
 
-  DBUG_EXECUTE_IF("dump_loader_force_index_weight", { weight = 4; });
+  // never use fewer threads than configured by the global values
+  const auto ddl_threads = std::max(threads, options.ddl_threads());
+  const auto read_threads = std::max(threads, options.parallel_read_threads());
+
+  if (ddl_threads == options.ddl_threads() &&
+      read_threads == options.parallel_read_threads()) {
+    return {};
+  }
+
+  // the DDL buffer is shared by all of the DDL threads, each thread gets the
+  // same share as with the global values
+  const auto buffer_size =
+      std::max(options.ddl_buffer_size() /
+                   std::max<uint64_t>(options.ddl_threads(), 1) * ddl_threads,
+               options.ddl_buffer_size());
+
+  return shcore::sqlformat(
+      "SET @@SESSION.innodb_ddl_threads=?, "
+      "@@SESSION.innodb_parallel_read_threads=?, "
+      "@@SESSION.innodb_ddl_buffer_size=?",
+      ddl_threads, read_threads, buffer_size);
+}
+
+void Dump_loader::Worker::Index_recreation_task::fit_weight(
+    uint64_t idle_threads) {
+  set_weight(
+      Dump_loader::index_recreation_weight(m_options, m_table_size,
+                                           idle_threads));
+
+  DBUG_EXECUTE_IF("dump_loader_force_index_weight", { set_weight(4); });
+}
 
-  return std::make_unique<Worker::Index_recreation_task>(schema, table, indexes,
-                                                         weight);
+std::string Dump_loader::Worker::Index_recreation_task::ddl_threads_statement()
+    const {
+  return Dump_loader::ddl_threads_statement(m_options, weight());
 }
 
 Dump_loader::Task_ptr Dump_loader::analyze_table(
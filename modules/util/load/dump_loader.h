@@ -39,6 +39,8 @@
 #include <utility>
 #include <vector>
 
+#include "modules/util/common/dump/metrics_writer.h"
+#include "modules/util/common/dump/stage_timer.h"
 #include "modules/util/dump/compatibility.h"
 #include "modules/util/dump/progress_thread.h"
 
@@ -48,6 +50,7 @@
 
 #include "mysqlshdk/libs/db/mysql/session.h"
 #include "mysqlshdk/libs/storage/ifile.h"
+#include "mysqlshdk/libs/storage/read_ahead_file.h"
 #include "mysqlshdk/libs/utils/priority_queue.h"
 #include "mysqlshdk/libs/utils/synchronized_queue.h"
 
@@ -102,6 +105,12 @@ class Dump_loader {
       void set_weight(uint64_t weight) { m_weight = weight; }
       void done() { m_weight = 0; }
 
+      /**
+       * Adjusts the weight of a task which is about to be scheduled to the
+       * number of threads which are not used by other tasks.
+       */
+      virtual void fit_weight(uint64_t idle_threads) { (void)idle_threads; }
+
      protected:
       static void handle_current_exception(Worker *worker, Dump_loader *loader,
                                            const std::string &error);
@@ -245,16 +254,27 @@ class Dump_loader {
       Index_recreation_task(
           const std::string &schema, const std::string &table,
           compatibility::Deferred_statements::Index_info *indexes,
-          uint64_t weight)
-          : Task(schema, table), m_indexes(indexes) {
-        set_weight(weight);
-      }
+          const Load_dump_options &options, uint64_t table_size)
+          : Task(schema, table),
+            m_indexes(indexes),
+            m_options(options),
+            m_table_size(table_size) {}
 
       bool execute(const std::shared_ptr<mysqlshdk::db::mysql::Session> &,
                    Worker *, Dump_loader *) override;
 
+      void fit_weight(uint64_t idle_threads) override;
+
+      /**
+       * Statement which sets the InnoDB DDL variables to use the threads
+       * reserved for this task, empty if global values are to be used.
+       */
+      std::string ddl_threads_statement() const;
+
      private:
       compatibility::Deferred_statements::Index_info *m_indexes;
+      const Load_dump_options &m_options;
+      uint64_t m_table_size;
     };
 
     Worker(size_t id, Dump_loader *owner);
@@ -269,6 +289,10 @@ class Dump_loader {
 
     uint64_t get_connection_id() const { return m_connection_id; }
 
+    mysqlshdk::storage::Read_ahead_threads *read_ahead_threads() const {
+      return m_read_ahead_threads.get();
+    }
+
    private:
     void handle_current_exception(Dump_loader *loader,
                                   const std::string &error);
@@ -290,6 +314,10 @@ class Dump_loader {
     std::unique_ptr<Task> m_task;
 
     shcore::Synchronized_queue<bool> m_work_ready;
+
+    // read and decompress the data ahead of LOAD DATA, reused by all chunks
+    std::unique_ptr<mysqlshdk::storage::Read_ahead_threads>
+        m_read_ahead_threads;
   };
 
   using Task_ptr = std::unique_ptr<Worker::Task>;
@@ -432,10 +460,21 @@ class Dump_loader {
 
   void setup_load_data_progress();
 
+  std::string load_data_eta() const;
+
   void setup_create_indexes_progress();
 
   void setup_analyze_tables_progress();
 
+  /**
+   * Stages of the data load, reported in the summary and the metrics.
+   */
+  static std::vector<dump::common::Stage_description> stages();
+
+  void start_metrics();
+
+  void stop_metrics();
+
   void add_skipped_schema(const std::string &schema);
 
   void on_ddl_done_for_schema(const std::string &schema);
@@ -494,6 +533,23 @@ class Dump_loader {
       const std::string &schema, const std::string &table,
       const std::vector<Dump_reader::Histogram> &histograms) const;
 
+  /**
+   * Number of threads reserved for a task which recreates the indexes of a
+   * table of the given size (0 if size is not known), when the given number
+   * of threads is idle.
+   */
+  static uint64_t index_recreation_weight(const Load_dump_options &options,
+                                          uint64_t table_size,
+                                          uint64_t idle_threads);
+
+  /**
+   * Statement which sets the InnoDB DDL variables of a session which recreates
+   * indexes using the given number of threads, empty if global values are to
+   * be used.
+   */
+  static std::string ddl_threads_statement(const Load_dump_options &options,
+                                           uint64_t threads);
+
   void load_users();
 
  private:
@@ -502,6 +558,9 @@ class Dump_loader {
   FRIEND_TEST(Load_dump, add_execute_conditionally);
   friend class Load_dump_mocked;
   FRIEND_TEST(Load_dump_mocked, filter_user_script_for_mds);
+  FRIEND_TEST(Load_dump_mocked, index_recreation_weight);
+  FRIEND_TEST(Load_dump_mocked, ddl_threads_statement);
+  FRIEND_TEST(Load_dump_mocked, index_recreation_task);
 #endif
 
   class Sql_transform {
@@ -559,7 +618,12 @@ class Dump_loader {
   std::vector<std::thread> m_worker_threads;
   std::list<Worker> m_workers;
   Queue m_pending_tasks;
+  std::atomic<size_t> m_num_pending_tasks{0};
   uint64_t m_current_weight = 0;
+  // time each worker spent executing the tasks, used by the metrics
+  std::unique_ptr<std::atomic<uint64_t>[]> m_worker_busy_ns;
+  // time spent by each worker in each of the stages
+  std::unique_ptr<dump::common::Stage_timer[]> m_worker_timers;
 
   std::mutex m_tables_being_loaded_mutex;
   std::unordered_multimap<std::string, size_t> m_tables_being_loaded;
@@ -620,6 +684,10 @@ class Dump_loader {
   std::size_t m_loaded_accounts = 0;
   std::size_t m_dropped_accounts = 0;
   std::size_t m_ignored_grant_errors = 0;
+
+  // same as the progress thread, needs to be destroyed before any of the
+  // fields it uses
+  std::unique_ptr<dump::common::Metrics_writer> m_metrics;
 };
 
 }  // namespace mysqlsh
@@ -25,9 +25,12 @@
 
 #include <algorithm>
 #include <atomic>
+#include <iterator>
+#include <mutex>
 #include <numeric>
 #include <utility>
 
+#include "modules/util/common/dump/json_metadata.h"
 #include "modules/util/common/dump/utils.h"
 #include "modules/util/dump/schema_dumper.h"
 #include "modules/util/load/load_errors.h"
@@ -74,15 +77,67 @@ shcore::Dictionary_t fetch_metadata(mysqlshdk::storage::IDirectory *dir,
   return parse_metadata(fetch_file(dir, fn), fn);
 }
 
-auto to_vector_of_strings(const shcore::Array_t &arr) {
-  std::vector<std::string> res;
-  res.reserve(arr->size());
+/**
+ * Parses the metadata file without converting it to shcore::Value, calls the
+ * given callback to extract the information.
+ */
+template <typename F>
+void process_metadata(const std::string &data, const std::string &fn,
+                      F &&process) {
+  std::unique_ptr<dump::common::Json_metadata> metadata;
 
-  for (const auto &s : *arr) {
-    res.emplace_back(s.as_string());
+  try {
+    metadata = std::make_unique<dump::common::Json_metadata>(data);
+  } catch (const std::invalid_argument &e) {
+    THROW_ERROR(SHERR_LOAD_PARSING_METADATA_FILE_FAILED, fn.c_str(), e.what());
   }
 
-  return res;
+  try {
+    process(*metadata);
+  } catch (const std::invalid_argument &e) {
+    log_error("Metadata file %s: %s", fn.c_str(), e.what());
+    THROW_ERROR(SHERR_LOAD_INVALID_METADATA_FILE, fn.c_str());
+  }
+}
+
+/**
+ * Calls the callback for each string in the given array, if it exists.
+ */
+template <typename F>
+void for_each_string(const rapidjson::Value *array, F &&callback) {
+  if (array) {
+    for (const auto &item : array->GetArray()) {
+      callback(dump::common::Json_metadata::as_string(item));
+    }
+  }
+}
+
+std::string get_basename(const rapidjson::Value *basenames,
+                         const std::string &name,
+                         const std::string &default_value) {
+  if (basenames) {
+    const rapidjson::Value key{
+        rapidjson::StringRef(name.c_str(), name.length())};
+    const auto it = basenames->FindMember(key);
+
+    if (basenames->MemberEnd() != it) {
+      return dump::common::Json_metadata::as_string(it->value);
+    }
+  }
+
+  return default_value;
+}
+
+std::string files_prefix(const std::string &schema,
+                         const std::string &basename) {
+  // if schema name was truncated, basename has an ordinal number appended, but
+  // table basenames begin with just the truncated part of the encoded name
+  const auto encoded = dump::common::encode_schema_basename(schema);
+  const auto mismatch = std::mismatch(basename.begin(), basename.end(),
+                                      encoded.begin(), encoded.end())
+                            .first;
+
+  return std::string(basename.begin(), mismatch);
 }
 
 }  // namespace
@@ -108,6 +163,8 @@ Dump_reader::Status Dump_reader::open() {
         info->basename = info->name;
       }
 
+      info->files_prefix = files_prefix(info->name, info->basename);
+
       m_contents.schemas.emplace(info->name, std::move(info));
     } else {
       log_debug("Skipping schema '%s'", schema.as_string().c_str());
@@ -557,19 +614,40 @@ bool Dump_reader::next_table_chunk(
 bool Dump_reader::next_deferred_index(
     std::string *out_schema, std::string *out_table,
     compatibility::Deferred_statements::Index_info **out_indexes) {
-  for (auto &schema : m_contents.schemas) {
-    for (auto &table : schema.second->tables) {
-      if ((!m_options.load_data() || table.second->all_data_loaded()) &&
-          !table.second->indexes_scheduled) {
-        table.second->indexes_scheduled = true;
-        *out_schema = schema.second->name;
-        *out_table = table.second->name;
-        *out_indexes = &table.second->indexes;
-        return true;
-      }
-    }
+  // index builds of big tables take the longest, start them first, otherwise
+  // they end up in a long serial tail of the load
+  if (m_tables_ready_for_indexes.empty()) {
+    return false;
   }
-  return false;
+
+  const auto next = m_tables_ready_for_indexes.begin()->second;
+  m_tables_ready_for_indexes.erase(m_tables_ready_for_indexes.begin());
+
+  next->indexes_scheduled = true;
+  *out_schema = next->schema;
+  *out_table = next->name;
+  *out_indexes = &next->indexes;
+
+  return true;
+}
+
+void Dump_reader::update_pending_indexes(Table_info *table) {
+  if (table->indexes_scheduled) {
+    return;
+  }
+
+  if (m_options.load_data() && !table->all_data_loaded()) {
+    m_tables_with_pending_indexes.emplace(table);
+    return;
+  }
+
+  m_tables_with_pending_indexes.erase(table);
+
+  const auto cost =
+      std::max<uint64_t>(table_data_size(table->schema, table->name), 1) *
+      std::max<uint64_t>(table->indexes.size(), 1);
+
+  m_tables_ready_for_indexes.emplace(cost, table);
 }
 
 bool Dump_reader::next_table_analyze(std::string *out_schema,
@@ -645,7 +723,7 @@ void Dump_reader::compute_filtered_data_size() {
 
 // Scan directory for new files and adds them to the pending file list
 void Dump_reader::rescan(dump::Progress_thread *progress_thread) {
-  Files files;
+  const Files *files = nullptr;
 
   {
     dump::Progress_thread::Stage *stage = nullptr;
@@ -664,16 +742,16 @@ void Dump_reader::rescan(dump::Progress_thread *progress_thread) {
       }
     }
 
-    files = m_dir->list_files();
+    files = &list_files();
   }
 
   log_debug("Finished listing files, starting rescan");
 
-  m_contents.rescan(m_dir.get(), files, this, progress_thread);
+  m_contents.rescan(m_dir.get(), *files, this, progress_thread);
 
   log_debug("Rescan done");
 
-  if (files.find({"@.done.json"}) != files.end() &&
+  if (files->find({"@.done.json"}) != files->end() &&
       m_dump_status != Status::COMPLETE) {
     m_contents.parse_done_metadata(m_dir.get());
     m_dump_status = Status::COMPLETE;
@@ -682,6 +760,89 @@ void Dump_reader::rescan(dump::Progress_thread *progress_thread) {
   compute_filtered_data_size();
 }
 
+const Dump_reader::Files &Dump_reader::list_files() {
+  if (!m_dir->supports_prefix_filtering()) {
+    m_files = m_dir->list_files();
+    return m_files;
+  }
+
+  // Names of all the files which belong to a schema begin with the same
+  // prefix, list only the schemas which were not fully scanned yet, this
+  // allows to list the files in parallel, skips the excluded schemas and the
+  // files which were already found in the previous scans.
+  std::vector<std::string> prefixes;
+  // @.json, @.sql, @.post.sql, @.users.sql, @.done.json
+  prefixes.emplace_back("@.");
+
+  for (const auto &s : m_contents.schemas) {
+    if (!s.second->all_files_found()) {
+      prefixes.emplace_back(s.second->files_prefix);
+    }
+  }
+
+  // remove prefixes which are covered by other prefixes
+  std::sort(prefixes.begin(), prefixes.end());
+
+  for (auto it = prefixes.begin(); it != prefixes.end();) {
+    const auto next = std::next(it);
+
+    if (prefixes.end() != next && shcore::str_beginswith(*next, *it)) {
+      prefixes.erase(next);
+    } else {
+      ++it;
+    }
+  }
+
+  log_debug("Listing files using %zu prefixes", prefixes.size());
+
+  std::mutex files_mutex;
+  const auto pool = create_thread_pool();
+
+  pool->start_threads();
+
+  for (const auto &prefix : prefixes) {
+    pool->add_task(
+        [this, &files_mutex, &prefix]() {
+          // listed files are added to the known files in batches, to avoid
+          // locking the mutex for each file
+          constexpr std::size_t k_batch_size = 1000;
+          std::vector<mysqlshdk::storage::IDirectory::File_info> batch;
+
+          const auto flush = [this, &files_mutex, &batch]() {
+            std::lock_guard<std::mutex> lock(files_mutex);
+            m_files.insert(std::make_move_iterator(batch.begin()),
+                           std::make_move_iterator(batch.end()));
+            batch.clear();
+          };
+
+          batch.reserve(k_batch_size);
+
+          m_dir->for_each_file(
+              prefix + "*",
+              [&batch, &flush](
+                  mysqlshdk::storage::IDirectory::File_info &&file) {
+                batch.emplace_back(std::move(file));
+
+                if (batch.size() >= k_batch_size) {
+                  flush();
+                }
+              });
+
+          if (!batch.empty()) {
+            flush();
+          }
+
+          return std::string{};
+        },
+        [](std::string &&) {});
+  }
+
+  pool->tasks_done();
+  pool->process();
+
+  return m_files;
+}
+
 uint64_t Dump_reader::add_deferred_statements(
     const std::string &schema, const std::string &table,
     compatibility::Deferred_statements &&stmts) {
@@ -704,6 +865,7 @@ uint64_t Dump_reader::add_deferred_statements(
   t->second->indexes_scheduled = t->second->indexes_created =
       !m_options.load_deferred_indexes() || stmts.index_info.empty();
   t->second->indexes = std::move(stmts.index_info);
+  update_pending_indexes(t->second.get());
 
   const auto table_name = schema_object_key(schema, table);
 
@@ -813,108 +975,115 @@ bool Dump_reader::Table_info::should_fetch_metadata_file(
 
 void Dump_reader::Table_info::update_metadata(const std::string &data,
                                               Dump_reader *reader) {
-  auto md = parse_metadata(data, metadata_name());
+  process_metadata(data, metadata_name(), [this, reader](const auto &md) {
+    Table_data_info di;
+    di.owner = this;
 
-  Table_data_info di;
-  di.owner = this;
+    has_sql = md.get_bool("includesDdl", true);
+    di.has_data = md.get_bool("includesData", true);
 
-  has_sql = md->get_bool("includesDdl", true);
-  di.has_data = md->get_bool("includesData", true);
+    options = md.get_map("options");
 
-  options = md->get_map("options");
+    if (options) {
+      // "compression" and "primaryIndex" are not used by the chunk importer
+      // and need to be removed
+      // these were misplaced in the options dictionary, code is kept for
+      // backward compatibility
+      options->erase("compression");
 
-  if (options) {
-    // "compression" and "primaryIndex" are not used by the chunk importer
-    // and need to be removed
-    // these were misplaced in the options dictionary, code is kept for
-    // backward compatibility
-    options->erase("compression");
+      if (options->has_key("primaryIndex")) {
+        auto index = options->get_string("primaryIndex");
 
-    if (options->has_key("primaryIndex")) {
-      auto index = options->get_string("primaryIndex");
+        if (!index.empty()) {
+          primary_index.emplace_back(std::move(index));
+        }
 
-      if (!index.empty()) {
-        primary_index.emplace_back(std::move(index));
+        options->erase("primaryIndex");
       }
 
-      options->erase("primaryIndex");
+      // chunk importer uses characterSet instead of defaultCharacterSet
+      if (options->has_key("defaultCharacterSet")) {
+        options->set("characterSet", options->at("defaultCharacterSet"));
+        options->erase("defaultCharacterSet");
+      } else {
+        // By default, we use the character set from the source DB
+        options->set("characterSet",
+                     shcore::Value(reader->default_character_set()));
+      }
     }
 
-    // chunk importer uses characterSet instead of defaultCharacterSet
-    if (options->has_key("defaultCharacterSet")) {
-      options->set("characterSet", options->at("defaultCharacterSet"));
-      options->erase("defaultCharacterSet");
-    } else {
-      // By default, we use the character set from the source DB
+    options->set("showProgress",
+                 shcore::Value(reader->m_options.show_progress()));
+
+    // Override characterSet if given in options
+    if (!reader->m_options.character_set().empty()) {
       options->set("characterSet",
-                   shcore::Value(reader->default_character_set()));
+                   shcore::Value(reader->m_options.character_set()));
     }
-  }
 
-  options->set("showProgress",
-               shcore::Value(reader->m_options.show_progress()));
+    di.extension = md.get_string("extension", "tsv");
+    di.chunked = md.get_bool("chunking", false);
 
-  // Override characterSet if given in options
-  if (!reader->m_options.character_set().empty()) {
-    options->set("characterSet",
-                 shcore::Value(reader->m_options.character_set()));
-  }
+    if (const auto index = md.get_array("primaryIndex")) {
+      primary_index.clear();
 
-  di.extension = md->get_string("extension", "tsv");
-  di.chunked = md->get_bool("chunking", false);
+      for_each_string(index, [this](std::string &&column) {
+        primary_index.emplace_back(std::move(column));
+      });
+    }
 
-  if (md->has_key("primaryIndex")) {
-    primary_index = to_vector_of_strings(md->get_array("primaryIndex"));
-  }
+    if (const auto trigger_list = md.get_array("triggers")) {
+      for_each_string(trigger_list, [this, reader](std::string &&trigger) {
+        if (reader->include_trigger(schema, name, trigger)) {
+          triggers.emplace_back(Object_info{std::move(trigger)});
+        }
+      });
 
-  if (const auto trigger_list = md->get_array("triggers")) {
-    for (const auto &t : *trigger_list) {
-      auto trigger_name = t.as_string();
+      has_triggers = !triggers.empty();
 
-      if (reader->include_trigger(schema, name, trigger_name)) {
-        triggers.emplace_back(Object_info{std::move(trigger_name)});
-      }
+      log_debug("%s.%s has %zi triggers", schema.c_str(), name.c_str(),
+                triggers.size());
+    } else {
+      has_triggers = false;
     }
 
-    has_triggers = !triggers.empty();
+    if (const auto histogram_list = md.get_array("histograms")) {
+      for (const auto &h : histogram_list->GetArray()) {
+        if (h.IsObject()) {
+          const auto column = h.FindMember("column");
+          const auto buckets = h.FindMember("buckets");
 
-    log_debug("%s.%s has %zi triggers", schema.c_str(), name.c_str(),
-              triggers.size());
-  } else {
-    has_triggers = false;
-  }
+          if (h.MemberEnd() == column || h.MemberEnd() == buckets) {
+            throw std::invalid_argument("Incomplete histogram information");
+          }
 
-  auto histogram_list = md->get_array("histograms");
-
-  if (histogram_list) {
-    for (const auto &h : *histogram_list) {
-      auto histogram = h.as_map();
-      if (histogram) {
-        histograms.emplace_back(
-            Histogram{histogram->get_string("column"),
-                      static_cast<size_t>(histogram->get_int("buckets"))});
+          histograms.emplace_back(Histogram{
+              dump::common::Json_metadata::as_string(column->value),
+              static_cast<size_t>(
+                  dump::common::Json_metadata::as_uint(buckets->value))});
+        }
       }
     }
-  }
 
-  {
-    // maps partition names to basenames
-    const auto basenames = md->get_map("basenames");
+    {
+      // maps partition names to basenames
+      const auto basenames = md.get_object("basenames");
 
-    if (basenames && !basenames->empty()) {
-      for (const auto &p : *basenames) {
-        auto copy = di;
+      if (basenames && !basenames->ObjectEmpty()) {
+        for (const auto &p : basenames->GetObject()) {
+          auto copy = di;
 
-        copy.partition = p.first;
-        copy.basename = p.second.as_string();
+          copy.partition = dump::common::Json_metadata::as_string(p.name);
+          copy.basename = dump::common::Json_metadata::as_string(p.value);
 
-        data_info.emplace_back(std::move(copy));
+          data_info.emplace_back(std::move(copy));
+        }
+      } else {
+        di.basename = basename;
+        data_info.emplace_back(std::move(di));
       }
-    } else {
-      di.basename = basename;
-      data_info.emplace_back(std::move(di));
     }
-  }
+  });
 
   reader->on_table_metadata_parsed(*this);
   md_done = true;
@@ -1076,98 +1245,85 @@ bool Dump_reader::Schema_info::should_fetch_metadata_file(
 
 void Dump_reader::Schema_info::update_metadata(const std::string &data,
                                                Dump_reader *reader) {
-  auto md = parse_metadata(data, metadata_name());
-
-  has_sql = md->get_bool("includesDdl", true);
-  has_view_sql = md->get_bool("includesViewsDdl", has_sql);
-  has_data = md->get_bool("includesData", true);
-
-  shcore::Dictionary_t basenames = md->get_map("basenames");
-
-  if (const auto table_list = md->get_array("tables")) {
-    for (const auto &t : *table_list) {
-      auto table_name = t.as_string();
-
-      if (reader->include_table(name, table_name)) {
-        auto info = std::make_shared<Table_info>();
-
-        info->schema = name;
-        info->name = std::move(table_name);
-
-        if (basenames->has_key(info->name))
-          info->basename = basenames->get_string(info->name);
-        else
-          info->basename = basename + "@" + info->name;
-
-        // if tables are not going to be analysed, we're marking them as already
-        // analysed
-        info->analyze_scheduled = info->analyze_finished =
-            reader->m_options.analyze_tables() ==
-            Load_dump_options::Analyze_table_mode::OFF;
+  process_metadata(data, metadata_name(), [this, reader](const auto &md) {
+    has_sql = md.get_bool("includesDdl", true);
+    has_view_sql = md.get_bool("includesViewsDdl", has_sql);
+    has_data = md.get_bool("includesData", true);
+
+    const auto basenames = md.get_object("basenames");
+
+    if (const auto table_list = md.get_array("tables")) {
+      for_each_string(table_list, [this, reader,
+                                   basenames](std::string &&table_name) {
+        if (reader->include_table(name, table_name)) {
+          auto info = std::make_shared<Table_info>();
+
+          info->schema = name;
+          info->name = std::move(table_name);
+          info->basename =
+              get_basename(basenames, info->name, basename + "@" + info->name);
+
+          // if tables are not going to be analysed, we're marking them as
+          // already analysed
+          info->analyze_scheduled = info->analyze_finished =
+              reader->m_options.analyze_tables() ==
+              Load_dump_options::Analyze_table_mode::OFF;
+
+          tables.emplace(info->name, std::move(info));
+        }
+      });
 
-        tables.emplace(info->name, std::move(info));
-      }
+      log_debug("%s has %zi tables", name.c_str(), tables.size());
     }
 
-    log_debug("%s has %zi tables", name.c_str(), tables.size());
-  }
-
-  if (const auto view_list = md->get_array("views")) {
-    for (const auto &v : *view_list) {
-      auto view_name = v.as_string();
+    if (const auto view_list = md.get_array("views")) {
+      for_each_string(view_list, [this, reader,
+                                  basenames](std::string &&view_name) {
+        if (reader->include_table(name, view_name)) {
+          View_info info;
 
-      if (reader->include_table(name, view_name)) {
-        View_info info;
+          info.schema = name;
+          info.name = std::move(view_name);
+          info.basename =
+              get_basename(basenames, info.name, basename + "@" + info.name);
 
-        info.schema = name;
-        info.name = std::move(view_name);
-        if (basenames->has_key(info.name))
-          info.basename = basenames->get_string(info.name);
-        else
-          info.basename = basename + "@" + info.name;
+          views.emplace_back(std::move(info));
+        }
+      });
 
-        views.emplace_back(std::move(info));
-      }
+      log_debug("%s has %zi views", name.c_str(), views.size());
     }
 
-    log_debug("%s has %zi views", name.c_str(), views.size());
-  }
-
-  if (const auto function_list = md->get_array("functions")) {
-    for (const auto &f : *function_list) {
-      auto function_name = f.as_string();
+    if (const auto function_list = md.get_array("functions")) {
+      for_each_string(function_list, [this, reader](std::string &&function) {
+        if (reader->include_routine(name, function)) {
+          functions.emplace_back(Object_info{std::move(function)});
+        }
+      });
 
-      if (reader->include_routine(name, function_name)) {
-        functions.emplace_back(Object_info{std::move(function_name)});
-      }
+      log_debug("%s has %zi functions", name.c_str(), functions.size());
     }
 
-    log_debug("%s has %zi functions", name.c_str(), functions.size());
-  }
-
-  if (const auto procedure_list = md->get_array("procedures")) {
-    for (const auto &p : *procedure_list) {
-      auto procedure_name = p.as_string();
+    if (const auto procedure_list = md.get_array("procedures")) {
+      for_each_string(procedure_list, [this, reader](std::string &&procedure) {
+        if (reader->include_routine(name, procedure)) {
+          procedures.emplace_back(Object_info{std::move(procedure)});
+        }
+      });
 
-      if (reader->include_routine(name, procedure_name)) {
-        procedures.emplace_back(Object_info{std::move(procedure_name)});
-      }
+      log_debug("%s has %zi procedures", name.c_str(), procedures.size());
     }
 
-    log_debug("%s has %zi procedures", name.c_str(), procedures.size());
-  }
-
-  if (const auto event_list = md->get_array("events")) {
-    for (const auto &e : *event_list) {
-      auto event_name = e.as_string();
+    if (const auto event_list = md.get_array("events")) {
+      for_each_string(event_list, [this, reader](std::string &&event) {
+        if (reader->include_event(name, event)) {
+          events.emplace_back(Object_info{std::move(event)});
+        }
+      });
 
-      if (reader->include_event(name, event_name)) {
-        events.emplace_back(Object_info{std::move(event_name)});
-      }
+      log_debug("%s has %zi events", name.c_str(), events.size());
     }
-
-    log_debug("%s has %zi events", name.c_str(), events.size());
-  }
+  });
 
   md_loaded = true;
   reader->on_metadata_parsed();
@@ -1262,6 +1418,22 @@ void Dump_reader::Schema_info::rescan_data(const Files &files,
   }
 }
 
+bool Dump_reader::Schema_info::all_files_found() const {
+  if (!ready()) {
+    return false;
+  }
+
+  for (const auto &t : tables) {
+    for (const auto &di : t.second->data_info) {
+      if (!di.data_dumped()) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
 bool Dump_reader::Dump_info::ready() const {
   // we're not checking for the @.sql, @.post.sql and @.users.sql here, because
   // presence of these files depends on the dataOnly dump option (which is not
@@ -1389,22 +1561,35 @@ void Dump_reader::Dump_info::rescan_data(const Files &files,
 
 void Dump_reader::Dump_info::parse_done_metadata(
     mysqlshdk::storage::IDirectory *dir) {
-  shcore::Dictionary_t metadata = fetch_metadata(dir, "@.done.json");
+  static constexpr auto k_done_metadata = "@.done.json";
+  const auto data = fetch_file(dir, k_done_metadata);
+
   log_info("Dump %s is complete", dir->full_path().masked().c_str());
 
-  if (metadata) {
-    if (metadata->has_key("dataBytes")) {
-      data_size = metadata->get_uint("dataBytes");
+  process_metadata(data, k_done_metadata, [this](const auto &md) {
+    using dump::common::Json_metadata;
+
+    if (md.has("dataBytes")) {
+      data_size = md.get_uint("dataBytes");
     } else {
       log_warning(
           "Dump metadata file @.done.json does not contain dataBytes "
           "information");
     }
 
-    if (metadata->has_key("tableDataBytes")) {
-      for (const auto &schema : *metadata->get_map("tableDataBytes")) {
-        for (const auto &table : *schema.second.as_map()) {
-          table_data_size[schema.first][table.first] = table.second.as_uint();
+    if (const auto bytes = md.get_object("tableDataBytes")) {
+      for (const auto &schema : bytes->GetObject()) {
+        if (!schema.value.IsObject()) {
+          throw std::invalid_argument("Expected object value of '" +
+                                      Json_metadata::as_string(schema.name) +
+                                      "'");
+        }
+
+        auto &tables = table_data_size[Json_metadata::as_string(schema.name)];
+
+        for (const auto &table : schema.value.GetObject()) {
+          tables[Json_metadata::as_string(table.name)] =
+              Json_metadata::as_uint(table.value);
         }
       }
     } else {
@@ -1414,14 +1599,13 @@ void Dump_reader::Dump_info::parse_done_metadata(
     }
 
     // only exists in 1.0.1+
-    if (metadata->has_key("chunkFileBytes")) {
-      for (const auto &file : *metadata->get_map("chunkFileBytes")) {
-        chunk_sizes[file.first] = file.second.as_uint();
+    if (const auto files = md.get_object("chunkFileBytes")) {
+      for (const auto &file : files->GetObject()) {
+        chunk_sizes[Json_metadata::as_string(file.name)] =
+            Json_metadata::as_uint(file.value);
       }
     }
-  } else {
-    log_warning("Dump metadata file @.done.json is invalid");
-  }
+  });
 }
 
 std::unique_ptr<mysqlshdk::storage::IFile>
@@ -1518,6 +1702,11 @@ void Dump_reader::on_chunk_loaded(const std::string &schema,
   for (auto &tdi : t->data_info) {
     if (tdi.partition == partition) {
       ++tdi.chunks_loaded;
+
+      if (m_tables_with_pending_indexes.count(t)) {
+        update_pending_indexes(t);
+      }
+
       return;
     }
   }
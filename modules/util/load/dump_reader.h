@@ -393,6 +393,8 @@ class Dump_reader {
 
   struct Schema_info : public Object_info {
     std::string basename;
+    // prefix shared by the names of all files which belong to this schema
+    std::string files_prefix;
 
     std::unordered_map<std::string, std::shared_ptr<Table_info>> tables;
     std::vector<View_info> views;
@@ -429,6 +431,11 @@ class Dump_reader {
     void check_if_ready();
 
     void rescan_data(const Files &files, Dump_reader *reader);
+
+    /**
+     * Whether all files which belong to this schema were already found.
+     */
+    bool all_files_found() const;
   };
 
   struct Dump_info {
@@ -490,10 +497,21 @@ class Dump_reader {
  private:
   const std::string &override_schema(const std::string &s) const;
 
+  /**
+   * Lists the files of the dump, the result is valid until the next call.
+   */
+  const Files &list_files();
+
   const Table_info *find_table(const std::string &schema,
                                const std::string &table,
                                const char *context) const;
 
+  /**
+   * Moves the table to the tables ready for index recreation, if its indexes
+   * are not yet scheduled and all of its data is loaded.
+   */
+  void update_pending_indexes(Table_info *table);
+
   Table_info *find_table(const std::string &schema, const std::string &table,
                          const char *context);
 
@@ -509,11 +527,21 @@ class Dump_reader {
 
   Status m_dump_status = Status::INVALID;
   Dump_info m_contents;
+  // files found so far, if directory supports filtering by prefix these are
+  // kept between the scans, otherwise replaced by each scan
+  Files m_files;
   size_t m_filtered_data_size = 0;
 
   // Tables and partitions that are ready to be loaded
   std::unordered_set<Table_data_info *> m_tables_with_data;
 
+  // tables with deferred indexes which wait for their data to be loaded
+  std::unordered_set<Table_info *> m_tables_with_pending_indexes;
+
+  // tables whose deferred indexes can be recreated, the most costly first
+  std::multimap<uint64_t, Table_info *, std::greater<uint64_t>>
+      m_tables_ready_for_indexes;
+
   // tables which have data to be loaded (possibly partitioned)
   std::atomic<uint64_t> m_tables_to_load{0};
 
@@ -538,6 +566,9 @@ class Dump_reader {
 
 #ifdef FRIEND_TEST
   FRIEND_TEST(Dump_scheduler, load_scheduler);
+  FRIEND_TEST(Dump_scheduler, deferred_indexes);
+  FRIEND_TEST(Dump_reader, list_files_all);
+  FRIEND_TEST(Dump_reader, list_files_prefix);
 #endif
 };
 
@@ -72,6 +72,7 @@ const shcore::Option_pack_def<Load_dump_options> &Load_dump_options::options() {
           .optional("backgroundThreads",
                     &Load_dump_options::m_background_threads_count)
           .optional("showProgress", &Load_dump_options::m_show_progress)
+          .optional("metricsFile", &Load_dump_options::m_metrics_file)
           .optional("waitDumpTimeout", &Load_dump_options::set_wait_timeout)
           .optional("loadData", &Load_dump_options::m_load_data)
           .optional("loadDdl", &Load_dump_options::m_load_ddl)
@@ -264,12 +265,21 @@ void Load_dump_options::set_session(
     // innodb_ddl_threads threads are used during second and third stages, in
     // most cases first stage is executed before the rest, so we're using
     // maximum of these two values
-    m_threads_per_add_index =
-        query(
-            "SELECT GREATEST(@@innodb_parallel_read_threads, "
-            "@@innodb_ddl_threads)")
-            ->fetch_one_or_throw()
-            ->get_uint(0);
+    const auto row = query(
+                         "SELECT @@innodb_parallel_read_threads, "
+                         "@@innodb_ddl_threads, @@innodb_ddl_buffer_size")
+                         ->fetch_one_or_throw();
+    m_parallel_read_threads = row->get_uint(0);
+    m_ddl_threads = row->get_uint(1);
+    m_ddl_buffer_size = row->get_uint(2);
+    m_threads_per_add_index = std::max(m_parallel_read_threads, m_ddl_threads);
+
+    // if user configures the DDL threads in sessionInitSql, we leave them be
+    m_adjust_ddl_threads = std::none_of(
+        m_session_init_sql.begin(), m_session_init_sql.end(),
+        [](const std::string &sql) {
+          return std::string::npos != shcore::str_lower(sql).find("innodb_");
+        });
   }
 
   if (m_target_server_version >= Version(8, 0, 16)) {
@@ -149,6 +149,10 @@ class Load_dump_options {
 
   void set_show_progress(bool show) { m_show_progress = show; }
 
+  const std::string &metrics_file() const { return m_metrics_file; }
+
+  void set_metrics_file(const std::string &path) { m_metrics_file = path; }
+
   uint64_t threads_count() const { return m_threads_count; }
 
   uint64_t background_threads_count(uint64_t def) const {
@@ -161,6 +165,14 @@ class Load_dump_options {
 
   uint64_t threads_per_add_index() const { return m_threads_per_add_index; }
 
+  uint64_t parallel_read_threads() const { return m_parallel_read_threads; }
+
+  uint64_t ddl_threads() const { return m_ddl_threads; }
+
+  uint64_t ddl_buffer_size() const { return m_ddl_buffer_size; }
+
+  bool adjust_ddl_threads() const { return m_adjust_ddl_threads; }
+
   uint64_t dump_wait_timeout_ms() const { return m_wait_dump_timeout_ms; }
 
   void set_dump_wait_timeout_ms(uint64_t timeout_ms) {
@@ -277,6 +289,7 @@ class Load_dump_options {
   uint64_t m_threads_count = 4;
   std::optional<uint64_t> m_background_threads_count;
   bool m_show_progress = isatty(fileno(stdout)) ? true : false;
+  std::string m_metrics_file;
 
   mysqlshdk::oci::Oci_bucket_options m_oci_bucket_options;
   mysqlshdk::aws::S3_bucket_options m_s3_bucket_options;
@@ -324,6 +337,15 @@ class Load_dump_options {
   // how many threads are used by the server per one ALTER TABLE ... ADD INDEX
   uint64_t m_threads_per_add_index = 1;
 
+  // global values of innodb_parallel_read_threads, innodb_ddl_threads and
+  // innodb_ddl_buffer_size
+  uint64_t m_parallel_read_threads = 0;
+  uint64_t m_ddl_threads = 0;
+  uint64_t m_ddl_buffer_size = 0;
+
+  // whether number of DDL threads is set for each ALTER TABLE ... ADD INDEX
+  bool m_adjust_ddl_threads = false;
+
   // whether partial revokes are enabled
   bool m_partial_revokes = false;
 
@@ -1173,6 +1173,9 @@ list of SQL statements in each session about to load data.
 information stored in the dump files, i.e. binary log file name and position.
 @li <b>showProgress</b>: bool (default: true if stdout is a tty, false
 otherwise) - Enable or disable import progress information.
+@li <b>metricsFile</b>: string (default: not set) - Path to a local file which
+is periodically replaced with the current metrics of the load, in the Prometheus
+text format.
 @li <b>skipBinlog</b>: bool (default: false) - Disables the binary log
 for the MySQL sessions used by the loader (set sql_log_bin=0).
 @li <b>threads</b>: int (default: 4) - Number of threads to use to import table
@@ -1471,6 +1474,9 @@ maximum rate, measured in bytes per second per thread. Use maxRate="0" to set no
 limit.
 @li <b>showProgress</b>: bool (default: true if stdout is a TTY device, false
 otherwise) - Enable or disable dump progress information.
+@li <b>metricsFile</b>: string (default: not set) - Path to a local file which
+is periodically replaced with the current metrics of the dump, in the Prometheus
+text format.
 @li <b>defaultCharacterSet</b>: string (default: "utf8mb4") - Character set used
 for the dump.)*");
 
@@ -1806,6 +1812,13 @@ to be overwritten. The output file is created with the following access rights
 used to filter the data being exported.
 @li <b>partitions</b>: list of strings (default: not set) - A list of valid
 partition names used to limit the data export to just the specified partitions.
+@li <b>threads</b>: int (default: 1) - Use N threads to export data chunks from
+the server. If greater than 1, enables chunking.
+@li <b>bytesPerChunk</b>: string (default: "64M") - Sets average estimated
+number of bytes to be written to each data chunk, used if chunking is enabled.
+@li <b>splitOutput</b>: bool (default: false) - If enabled, enables chunking and
+writes each data chunk to a separate, numbered file instead of merging them into
+the output file.
 
 ${TOPIC_UTIL_DUMP_EXPORT_COMMON_OPTIONS}
 @li <b>compression</b>: string (default: "none") - Compression used when writing
@@ -1836,6 +1849,15 @@ The <b>maxRate</b> option supports unit suffixes:
 
 i.e. maxRate="2k" - limit throughput to 2000 bytes per second.
 
+If chunking is enabled, table data is divided into chunks using the same logic
+as the dump utilities, and each chunk is written to a separate file in the
+directory containing the output file. Unless <b>splitOutput</b> is enabled, once
+all chunks are written, they are merged into the output file and removed. If
+<b>splitOutput</b> is enabled, files are named after the output file, i.e. if
+<b>outputUrl</b> is "out.csv", files "out@0.csv", "out@1.csv", ... are written.
+
+The value of the <b>bytesPerChunk</b> option cannot be smaller than "128k".
+
 ${TOPIC_UTIL_DUMP_OCI_COMMON_OPTION_DETAILS}
 
 ${TOPIC_UTIL_DUMP_AWS_COMMON_OPTION_DETAILS}
@@ -2294,6 +2316,9 @@ maximum rate, measured in bytes per second per thread. Use maxRate="0" to set no
 limit.
 @li <b>showProgress</b>: bool (default: true if stdout is a TTY device, false
 otherwise) - Enable or disable copy progress information.
+@li <b>metricsFile</b>: string (default: not set) - Path to a local file which
+is periodically replaced with the current metrics of the copy, in the Prometheus
+text format.
 @li <b>defaultCharacterSet</b>: string (default: "utf8mb4") - Character set used
 for the copy.
 
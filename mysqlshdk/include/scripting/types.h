@@ -132,16 +132,44 @@ struct SHCORE_PUBLIC Value {
   typedef std::vector<Value> Array_type;
   typedef std::shared_ptr<Array_type> Array_type_ref;
 
+  /**
+   * Dictionary of values.
+   *
+   * Items are sorted by key, lookups accept any string-like key without
+   * creating a temporary std::string. Use Map_type::Builder to add many items
+   * in any order.
+   */
   class SHCORE_PUBLIC Map_type {
    public:
-    typedef std::map<std::string, Value> container_type;
+    typedef std::map<std::string, Value, std::less<>> container_type;
     typedef container_type::const_iterator const_iterator;
     typedef container_type::iterator iterator;
     using value_type = container_type::value_type;
     using reverse_iterator = container_type::reverse_iterator;
     using const_reverse_iterator = container_type::const_reverse_iterator;
 
-    inline bool has_key(const std::string &k) const { return find(k) != end(); }
+    /**
+     * Collects items in any order, creates a map sorting them only once.
+     */
+    class SHCORE_PUBLIC Builder {
+     public:
+      explicit Builder(size_t size_hint = 0) { m_items.reserve(size_hint); }
+
+      void emplace(std::string key, Value value) {
+        m_items.emplace_back(std::move(key), std::move(value));
+      }
+
+      /**
+       * Creates the map and empties the builder. If a key was added more than
+       * once, the last value is used, like when assigning items one by one.
+       */
+      std::shared_ptr<Map_type> build();
+
+     private:
+      std::vector<std::pair<std::string, Value>> m_items;
+    };
+
+    inline bool has_key(std::string_view k) const { return find(k) != end(); }
 
     Value_type get_type(const std::string &k) const;
 
@@ -173,10 +201,18 @@ struct SHCORE_PUBLIC Value {
       return iter->second.as_object<C>();
     }
 
-    const_iterator find(const std::string &k) const { return _map.find(k); }
-    iterator find(const std::string &k) { return _map.find(k); }
+    const_iterator find(std::string_view k) const { return _map.find(k); }
+    iterator find(std::string_view k) { return _map.find(k); }
+
+    size_t erase(std::string_view k) {
+      const auto it = find(k);
+
+      if (it == end()) return 0;
+
+      _map.erase(it);
+      return 1;
+    }
 
-    size_t erase(const std::string &k) { return _map.erase(k); }
     iterator erase(const_iterator it) { return _map.erase(it); }
     iterator erase(iterator it) { return _map.erase(it); }
     void clear() { _map.clear(); }
@@ -199,19 +235,25 @@ struct SHCORE_PUBLIC Value {
 
     void set(const std::string &k, const shcore::Value &v) { _map[k] = v; }
 
-    const container_type::mapped_type &at(const std::string &k) const {
-      return _map.at(k);
-    }
-    container_type::mapped_type &operator[](const std::string &k) {
-      return _map[k];
+    const Value &at(std::string_view k) const {
+      const auto it = find(k);
+
+      if (it == end()) {
+        throw std::out_of_range("Map_type::at");
+      }
+
+      return it->second;
     }
+
+    Value &operator[](const std::string &k) { return _map[k]; }
+
     bool operator==(const Map_type &other) const { return _map == other._map; }
     bool operator<(const Map_type &other) const { return _map < other._map; }
     bool operator<=(const Map_type &other) const { return _map <= other._map; }
 
     bool empty() const { return _map.empty(); }
     size_t size() const { return _map.size(); }
-    size_t count(const std::string &k) const { return _map.count(k); }
+    size_t count(std::string_view k) const { return has_key(k) ? 1 : 0; }
 
     template <class T>
     std::pair<iterator, bool> emplace(const std::string &key, T &&v) {
@@ -224,17 +266,22 @@ struct SHCORE_PUBLIC Value {
   typedef std::shared_ptr<Map_type> Map_type_ref;
 
   Value_type type{Undefined};
-  union {
+  // strings and shared pointers are stored inline, short strings do not
+  // allocate any memory; the active member is selected by the type field
+  union Storage {
+    Storage() {}
+    ~Storage() {}
+
     bool b;
-    std::string *s;
+    std::string s;
     int64_t i;
     uint64_t ui;
     double d;
-    std::shared_ptr<class Object_bridge> *o;
-    std::shared_ptr<Array_type> *array;
-    std::shared_ptr<Map_type> *map;
-    std::weak_ptr<Map_type> *mapref;
-    std::shared_ptr<class Function_base> *func;
+    std::shared_ptr<class Object_bridge> o;
+    std::shared_ptr<Array_type> array;
+    std::shared_ptr<Map_type> map;
+    std::weak_ptr<Map_type> mapref;
+    std::shared_ptr<class Function_base> func;
   } value;
 
   Value() = default;
@@ -357,29 +404,29 @@ struct SHCORE_PUBLIC Value {
   std::wstring as_wstring() const;
   const std::string &get_string() const {
     check_type(String);
-    return *value.s;
+    return value.s;
   }
   template <class C>
   std::shared_ptr<C> as_object() const {
     check_type(Object);
     return std::dynamic_pointer_cast<C>(type == shcore::Null ? nullptr
-                                                             : *value.o);
+                                                             : value.o);
   }
 
   std::shared_ptr<Object_bridge> as_object() const {
     check_type(Object);
     return std::dynamic_pointer_cast<Object_bridge>(
-        type == shcore::Null ? nullptr : *value.o);
+        type == shcore::Null ? nullptr : value.o);
   }
 
   std::shared_ptr<Map_type> as_map() const {
     check_type(Map);
-    return type == shcore::Null ? nullptr : *value.map;
+    return type == shcore::Null ? nullptr : value.map;
   }
 
   std::shared_ptr<Array_type> as_array() const {
     check_type(Array);
-    return type == shcore::Null ? nullptr : *value.array;
+    return type == shcore::Null ? nullptr : value.array;
   }
 
   template <class C>
@@ -417,7 +464,7 @@ struct SHCORE_PUBLIC Value {
   std::shared_ptr<Function_base> as_function() const {
     check_type(Function);
     return std::dynamic_pointer_cast<Function_base>(
-        type == shcore::Null ? nullptr : *value.func);
+        type == shcore::Null ? nullptr : value.func);
   }
 
  private:
@@ -430,6 +477,8 @@ struct SHCORE_PUBLIC Value {
   static Value parse_number(const char **pc);
 
   std::string yaml(int indent) const;
+
+  void destroy() noexcept;
 };
 typedef Value::Map_type_ref Dictionary_t;
 typedef Value::Array_type_ref Array_t;
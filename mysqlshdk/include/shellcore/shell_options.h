@@ -144,6 +144,9 @@ class Shell_options final : public shcore::Options {
     std::string log_sql_ignore_unsafe;
     shcore::Logger::LOG_LEVEL log_level = shcore::Logger::LOG_INFO;
     std::string log_file;
+    bool log_async = false;
+    shcore::Logger::Overflow_policy log_async_overflow =
+        shcore::Logger::Overflow_policy::BLOCK;
     int verbose_level = 0;
     bool wizards = true;
     bool admin_mode = false;
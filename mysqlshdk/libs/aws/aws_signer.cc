@@ -46,6 +46,7 @@ const std::string k_authorization_header = "Authorization";
 const std::string k_host_header = "Host";
 const std::string k_date_header = "x-amz-date";
 const std::string k_hash_header = "x-amz-content-sha256";
+const std::string k_unsigned_payload = "UNSIGNED-PAYLOAD";
 const std::string k_token_header = "x-amz-security-token";
 
 std::string hex(const std::vector<unsigned char> &hash) {
@@ -82,6 +83,7 @@ std::string hex_sha256(const char *data, size_t size) {
 Aws_signer::Aws_signer(const S3_bucket_config &config)
     : m_host(config.host()),
       m_region(config.region()),
+      m_sign_payload(config.payload_signing()),
       m_credentials_provider(config.credentials_provider()) {
   update_credentials();
 }
@@ -116,9 +118,9 @@ rest::Headers Aws_signer::sign_request(const rest::Signed_request *request,
   }
 
   // hash of the payload - Hex(SHA256Hash(<payload>)
-  const auto &payload_hash = request->size
-                                 ? hex_sha256(request->body, request->size)
-                                 : k_empty_payload_hash;
+  const auto &payload_hash = !request->size    ? k_empty_payload_hash
+                             : m_sign_payload ? hex(request->body_sha256())
+                                              : k_unsigned_payload;
 
   // add required headers
   result[k_host_header] = m_host;
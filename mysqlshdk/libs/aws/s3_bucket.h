@@ -72,6 +72,10 @@ class S3_bucket : public storage::backend::object_storage::Container {
 
   void delete_objects(const std::vector<std::string> &list);
 
+  bool body_sha256_required() const override {
+    return m_config->payload_signing();
+  }
+
  private:
   rest::Signed_request list_objects_request(
       const std::string &prefix, size_t limit, bool recursive,
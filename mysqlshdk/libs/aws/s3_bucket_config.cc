@@ -33,6 +33,7 @@
 #include "mysqlshdk/libs/utils/utils_file.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_path.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
 
 #include "mysqlshdk/libs/aws/aws_signer.h"
 #include "mysqlshdk/libs/aws/config_credentials_provider.h"
@@ -106,6 +107,8 @@ S3_bucket_config::S3_bucket_config(const S3_bucket_options &options)
 
   setup_endpoint_uri();
 
+  setup_payload_signing();
+
   setup_credentials_provider();
 }
 
@@ -148,6 +151,8 @@ const std::string &S3_bucket_config::hash() const {
                                  .count());
     m_hash += '-';
     m_hash += m_region;
+    m_hash += '-';
+    m_hash += m_payload_signing ? '1' : '0';
   }
 
   return m_hash;
@@ -271,6 +276,31 @@ void S3_bucket_config::setup_endpoint_uri() {
   }
 }
 
+void S3_bucket_config::setup_payload_signing() {
+  if (!m_profile_from_config_file.has_value()) {
+    return;
+  }
+
+  // same setting as used by the AWS CLI, nested in the 's3' section
+  const auto &settings = m_profile_from_config_file->settings;
+  const auto enabled = settings.find("payload_signing_enabled");
+
+  if (settings.end() == enabled ||
+      !shcore::str_caseeq(enabled->second, "false")) {
+    return;
+  }
+
+  if (shcore::str_ibeginswith(m_endpoint, "https://")) {
+    log_info("Payload signing of AWS S3 requests is disabled.");
+    m_payload_signing = false;
+  } else {
+    log_warning(
+        "The payload_signing_enabled setting is ignored, because the endpoint "
+        "'%s' does not use HTTPS.",
+        m_endpoint.c_str());
+  }
+}
+
 void S3_bucket_config::setup_credentials_provider() {
   std::vector<std::unique_ptr<Aws_credentials_provider>> providers;
 
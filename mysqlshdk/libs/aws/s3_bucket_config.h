@@ -80,6 +80,8 @@ class S3_bucket_config
 
   const std::string &region() const { return m_region; }
 
+  bool payload_signing() const { return m_payload_signing; }
+
   Aws_credentials_provider *credentials_provider() const {
     return m_credentials_provider.get();
   }
@@ -105,6 +107,8 @@ class S3_bucket_config
 
   void setup_endpoint_uri();
 
+  void setup_payload_signing();
+
   void setup_credentials_provider();
 
   std::string m_label = "AWS-S3-OS";
@@ -116,6 +120,7 @@ class S3_bucket_config
 
   std::string m_host;
   bool m_path_style_access = false;
+  bool m_payload_signing = true;
 
   std::optional<Aws_config_file::Profile> m_profile_from_credentials_file;
   std::optional<Aws_config_file::Profile> m_profile_from_config_file;
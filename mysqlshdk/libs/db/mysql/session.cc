@@ -697,6 +697,20 @@ static void free_result(T *result) {
   result = NULL;
 }
 
+void Session_impl::set_multi_statements(bool enable) {
+  if (_mysql == nullptr) throw std::runtime_error("Not connected");
+
+  _prev_result.reset();
+
+  const auto option = enable ? MYSQL_OPTION_MULTI_STATEMENTS_ON
+                            : MYSQL_OPTION_MULTI_STATEMENTS_OFF;
+
+  if (mysql_set_server_option(_mysql, option)) {
+    throw Error(mysql_error(_mysql), mysql_errno(_mysql),
+                mysql_sqlstate(_mysql));
+  }
+}
+
 bool Session_impl::next_resultset() {
   if (_prev_result) _prev_result.reset();
 
@@ -116,6 +116,8 @@ class Session_impl : public std::enable_shared_from_this<Session_impl> {
   void commit();
   void rollback();
 
+  void set_multi_statements(bool enable);
+
   void close();
 
   bool next_resultset();
@@ -260,6 +262,15 @@ class SHCORE_PUBLIC Session : public ISession,
     _impl->execute(sql, len);
   }
 
+  /**
+   * Allows several statements separated by ';' to be sent in a single query.
+   * All result sets need to be consumed (i.e. using next_resultset()) in order
+   * to detect errors reported by the statements following the first one.
+   */
+  virtual void set_multi_statements(bool enable) {
+    _impl->set_multi_statements(enable);
+  }
+
   const char *get_ssl_cipher() const override {
     return _impl->get_ssl_cipher();
   }
@@ -83,10 +83,24 @@ class SHCORE_PUBLIC Result : public mysqlshdk::db::IResult,
   void fetch_metadata();
   std::shared_ptr<Field_names> field_names() const override;
 
+  /**
+   * Adds results of the statements which were executed before the current
+   * one, when a single operation was split into multiple statements. Their
+   * affected rows, warnings and generated IDs are reported as a part of this
+   * result.
+   *
+   * @param results Results of the previous statements, already drained.
+   */
+  void add_batch_results(
+      std::vector<std::unique_ptr<xcl::XQuery_result>> &&results);
+
+  const Mysqlx::Notice::Warning *get_warning(std::size_t index) const;
+
   std::vector<Column> _metadata;
 
   std::deque<mysqlshdk::db::Row_copy> _pre_fetched_rows;
   std::unique_ptr<xcl::XQuery_result> _result;
+  std::vector<std::unique_ptr<xcl::XQuery_result>> m_batch_results;
   mutable std::shared_ptr<Field_names> _field_names;
 
   Row _row;
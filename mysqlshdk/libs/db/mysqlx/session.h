@@ -33,6 +33,7 @@
 #include <string>
 #include <string_view>
 #include <utility>
+#include <vector>
 #include "mysqlshdk/libs/db/mysqlx/mysqlxclient_clean.h"
 
 #include "mysqlshdk/libs/db/mysqlx/result.h"
@@ -119,6 +120,23 @@ class XSession_impl : public std::enable_shared_from_this<XSession_impl> {
   std::shared_ptr<IResult> execute_crud(const ::Mysqlx::Crud::Delete &msg);
   std::shared_ptr<IResult> execute_crud(const ::Mysqlx::Crud::Find &msg);
 
+  /**
+   * Executes an insert which does not fit into a single message. Rows are
+   * split into multiple messages, each at most max_size bytes long. Messages
+   * are pipelined within an expectation block, execution stops at the first
+   * error.
+   */
+  std::unique_ptr<xcl::XQuery_result> execute_batched_insert(
+      const ::Mysqlx::Crud::Insert &msg, std::size_t max_size,
+      std::vector<std::unique_ptr<xcl::XQuery_result>> *batch_results);
+
+  /**
+   * Provides the maximum size of a message accepted by the server, as read
+   * when session was established, or the server's default value if it's not
+   * known (i.e. account is expired).
+   */
+  std::size_t max_message_size() const;
+
   uint32_t next_prep_stmt_id() { return ++m_prep_stmt_count; }
   void prepare_stmt(const ::Mysqlx::Prepare::Prepare &msg);
 
@@ -160,6 +178,7 @@ class XSession_impl : public std::enable_shared_from_this<XSession_impl> {
   bool _enable_trace = false;
   bool _expired_account = false;
   bool _case_sensitive_table_names = false;
+  std::size_t m_max_message_size = 0;
 
   std::weak_ptr<Result> _prev_result;
   mysqlshdk::db::Connection_options _connection_options;
@@ -21,6 +21,7 @@
  * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
  */
 
+#include <iterator>
 #include <string>
 #include <utility>
 #include "mysqlshdk/libs/db/mysqlx/result.h"
@@ -192,6 +193,15 @@ std::string Result::get_info() const {
 
 int64_t Result::get_auto_increment_value() const {
   uint64_t i = 0;
+
+  // in case of batched inserts, first value is the one generated for the
+  // first row, like in case of a single insert
+  for (const auto &result : m_batch_results) {
+    if (result->try_get_last_insert_id(&i) && i) {
+      return i;
+    }
+  }
+
   if (_result) {
     _result->try_get_last_insert_id(&i);
   }
@@ -200,25 +210,76 @@ int64_t Result::get_auto_increment_value() const {
 
 uint64_t Result::get_affected_row_count() const {
   uint64_t i = 0;
-  if (_result) {
-    _result->try_get_affected_rows(&i);
+  uint64_t total = 0;
+
+  for (const auto &result : m_batch_results) {
+    if (result->try_get_affected_rows(&i)) {
+      total += i;
+    }
   }
-  return i;
+
+  if (_result && _result->try_get_affected_rows(&i)) {
+    total += i;
+  }
+  return total;
 }
 
 uint64_t Result::get_warning_count() const {
-  if (_result) return _result->get_warnings().size();
-  return 0;
+  uint64_t count = 0;
+
+  for (const auto &result : m_batch_results) {
+    count += result->get_warnings().size();
+  }
+
+  if (_result) count += _result->get_warnings().size();
+  return count;
 }
 
 std::vector<std::string> Result::get_generated_ids() {
   std::vector<std::string> ids;
 
-  _result->try_get_generated_document_ids(&ids);
+  const auto append = [&ids](xcl::XQuery_result *result) {
+    std::vector<std::string> batch_ids;
+    result->try_get_generated_document_ids(&batch_ids);
+    std::move(batch_ids.begin(), batch_ids.end(), std::back_inserter(ids));
+  };
+
+  for (const auto &result : m_batch_results) {
+    append(result.get());
+  }
+
+  append(_result.get());
 
   return ids;
 }
 
+void Result::add_batch_results(
+    std::vector<std::unique_ptr<xcl::XQuery_result>> &&results) {
+  m_batch_results = std::move(results);
+}
+
+const Mysqlx::Notice::Warning *Result::get_warning(std::size_t index) const {
+  for (const auto &result : m_batch_results) {
+    const auto &warnings = result->get_warnings();
+
+    if (index < warnings.size()) {
+      return &warnings[index];
+    }
+
+    index -= warnings.size();
+  }
+
+  if (_result) {
+    const auto &warnings = _result->get_warnings();
+
+    if (index < warnings.size()) {
+      return &warnings[index];
+    }
+  }
+
+  return nullptr;
+}
+
 Result::~Result() {
   // flush all
   if (_result) {
@@ -330,10 +391,9 @@ bool Result::next_resultset() {
 }
 
 std::unique_ptr<Warning> Result::fetch_one_warning() {
-  const auto &warnings = _result->get_warnings();
-  if (_fetched_warning_count < warnings.size()) {
+  if (const auto next = get_warning(_fetched_warning_count)) {
     auto w = std::make_unique<Warning>();
-    const Mysqlx::Notice::Warning &warning = warnings[_fetched_warning_count];
+    const Mysqlx::Notice::Warning &warning = *next;
     switch (warning.level()) {
       case Mysqlx::Notice::Warning::NOTE:
         w->level = Warning::Level::Note;
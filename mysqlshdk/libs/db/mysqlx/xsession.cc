@@ -23,10 +23,12 @@
 
 #include <mysqlx_version.h>
 
+#include <algorithm>
 #include <memory>
 #include <sstream>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "mysqlshdk/include/shellcore/console.h"
 #include "mysqlshdk/libs/db/mysqlx/session.h"
@@ -113,6 +115,23 @@ std::ostream &operator<<(std::ostream &os,
             << output << "}\n";
 }
 
+// lowest possible value of mysqlx_max_allowed_packet
+constexpr std::size_t k_min_max_message_size = 512;
+
+// default value of mysqlx_max_allowed_packet, used if it cannot be read
+constexpr std::size_t k_default_max_message_size = 64 * 1024 * 1024;
+
+// upper bound of the per-row overhead (field tag + length) in Crud::Insert
+constexpr std::size_t k_row_overhead = 10;
+
+#ifdef _WIN32
+// same as in Json_importer, writes are stuck on SSL connections on Windows
+// when there are responses pending
+constexpr std::size_t k_max_pending_batches = 1;
+#else
+constexpr std::size_t k_max_pending_batches = 4;
+#endif  // _WIN32
+
 std::pair<xcl::XProtocol::Handler_id, xcl::XProtocol::Handler_id>
 do_enable_trace(xcl::XSession *session) {
   xcl::XProtocol::Handler_id rh, sh;
@@ -535,7 +554,8 @@ void XSession_impl::enable_trace(bool flag) {
 void XSession_impl::load_session_info() {
   static constexpr char sql[] =
       "select @@lower_case_table_names, @@version, connection_id(), "
-      "variable_value from performance_schema.session_status where "
+      "variable_value, @@mysqlx_max_allowed_packet from "
+      "performance_schema.session_status where "
       "variable_name = 'mysqlx_ssl_cipher'";
   std::shared_ptr<IResult> result(query(sql, sizeof(sql) - 1));
 
@@ -551,6 +571,10 @@ void XSession_impl::load_session_info() {
   if (!row->is_null(3)) {
     _ssl_cipher = row->get_string(3);
   }
+  if (!row->is_null(4)) {
+    m_max_message_size =
+        std::max<std::size_t>(row->get_uint(4), k_min_max_message_size);
+  }
 }
 
 XSession_impl::~XSession_impl() {
@@ -665,17 +689,147 @@ std::shared_ptr<IResult> XSession_impl::execute_crud(
     const ::Mysqlx::Crud::Insert &msg) {
   mysqlshdk::utils::Profile_timer timer;
   timer.stage_begin("Mysqlx::Crud::Insert");
+
+  // inserts which are too big to be sent in a single message would be
+  // rejected by the server, split them into multiple messages
+  const auto message_size = msg.ByteSizeLong();
+  const bool split = msg.row_size() > 1 &&
+                     message_size > k_min_max_message_size &&
+                     message_size > max_message_size();
+
   before_query();
-  xcl::XError error;
-  std::unique_ptr<xcl::XQuery_result> xresult(
-      _mysql->get_protocol().execute_insert(msg, &error));
-  check_error_and_throw(error);
+
+  std::unique_ptr<xcl::XQuery_result> xresult;
+  std::vector<std::unique_ptr<xcl::XQuery_result>> batch_results;
+
+  if (split) {
+    xresult = execute_batched_insert(msg, max_message_size(), &batch_results);
+  } else {
+    xcl::XError error;
+    xresult = _mysql->get_protocol().execute_insert(msg, &error);
+    check_error_and_throw(error);
+  }
+
   auto result = after_query(std::move(xresult));
+  std::static_pointer_cast<Result>(result)->add_batch_results(
+      std::move(batch_results));
   timer.stage_end();
   result->set_execution_time(timer.total_seconds_elapsed());
   return result;
 }
 
+std::unique_ptr<xcl::XQuery_result> XSession_impl::execute_batched_insert(
+    const ::Mysqlx::Crud::Insert &msg, std::size_t max_size,
+    std::vector<std::unique_ptr<xcl::XQuery_result>> *batch_results) {
+  auto &protocol = _mysql->get_protocol();
+
+  // all batches share everything except for the rows
+  ::Mysqlx::Crud::Insert batch;
+  *batch.mutable_collection() = msg.collection();
+  batch.set_data_model(msg.data_model());
+  *batch.mutable_projection() = msg.projection();
+  *batch.mutable_args() = msg.args();
+  if (msg.has_upsert()) batch.set_upsert(msg.upsert());
+
+  const auto header_size = batch.ByteSizeLong();
+
+  if (header_size >= max_size) {
+    throw std::runtime_error(
+        "Insert statement exceeds the maximum allowed message size");
+  }
+
+  // stop the execution of the pending batches once one of them fails
+  {
+    ::Mysqlx::Expect::Open open;
+    auto cond = open.add_cond();
+    cond->set_condition_key(::Mysqlx::Expect::Open_Condition::EXPECT_NO_ERROR);
+    cond->set_condition_value("1");
+
+    check_error_and_throw(protocol.send(open));
+    check_error_and_throw(protocol.recv_ok());
+  }
+
+  std::unique_ptr<xcl::XQuery_result> last_result;
+  xcl::XError first_error;
+  std::size_t pending = 0;
+
+  const auto recv_response = [&]() {
+    xcl::XError error;
+    auto result = protocol.recv_resultset(&error);
+
+    if (!error && result) {
+      // results of inserts need to be drained (bug#26581651)
+      while (result->next_resultset(&error)) {
+      }
+    }
+
+    if (error) {
+      if (!first_error) first_error = error;
+    } else if (result) {
+      if (last_result) batch_results->emplace_back(std::move(last_result));
+      last_result = std::move(result);
+    }
+
+    --pending;
+  };
+
+  const auto send_batch = [&]() {
+    if (pending >= k_max_pending_batches) recv_response();
+
+    xcl::XError error;
+
+    if (!first_error) {
+      // once an error is reported, there's no point in sending more data
+      error = protocol.send(batch);
+      ++pending;
+    }
+
+    batch.mutable_row()->Clear();
+
+    if (error) {
+      // connection level error, the session is no longer usable
+      check_error_and_throw(error);
+    }
+  };
+
+  std::size_t batch_size = header_size;
+
+  for (const auto &row : msg.row()) {
+    const auto row_size = row.ByteSizeLong() + k_row_overhead;
+
+    if (batch.row_size() > 0 && batch_size + row_size > max_size) {
+      send_batch();
+      batch_size = header_size;
+    }
+
+    // a single row which is too big is sent anyway, server will report an
+    // error
+    *batch.add_row() = row;
+    batch_size += row_size;
+  }
+
+  if (batch.row_size() > 0) send_batch();
+
+  check_error_and_throw(protocol.send(::Mysqlx::Expect::Close()));
+
+  while (pending > 0) recv_response();
+
+  {
+    const auto error = protocol.recv_ok();
+    if (!first_error) first_error = error;
+  }
+
+  check_error_and_throw(first_error);
+
+  return last_result;
+}
+
+std::size_t XSession_impl::max_message_size() const {
+  // value is read when session is established, no queries are executed here
+  return 0 == m_max_message_size ? k_default_max_message_size
+                                  : m_max_message_size;
+}
+
 std::shared_ptr<IResult> XSession_impl::execute_crud(
     const ::Mysqlx::Crud::Update &msg) {
   before_query();
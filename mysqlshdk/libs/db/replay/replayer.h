@@ -57,6 +57,9 @@ class Replayer_mysql : public mysql::Session {
 
   void executes(const char *sql, size_t length) override;
 
+  // statements are replayed from the trace, there's no server to configure
+  void set_multi_statements(bool) override {}
+
   bool is_open() const override;
 
   uint64_t get_connection_id() const override;
@@ -414,7 +414,9 @@ Trace_writer::~Trace_writer() {
 
 Trace::Trace(const std::string &path) : _trace_path(path) {
   std::FILE *file;
-  char buffer[1024 * 4];
+  // traces of dumps can be hundreds of MB, read them in bigger chunks
+  constexpr std::size_t k_buffer_size = 64 * 1024;
+  std::unique_ptr<char[]> buffer{new char[k_buffer_size]};
 
   DBUG_LOG("sql", "Opening trace file " << path);
 
@@ -422,7 +424,7 @@ Trace::Trace(const std::string &path) : _trace_path(path) {
   if (!file) throw std::logic_error(path + ": " + strerror(errno));
 
   _index = 0;
-  rapidjson::FileReadStream stream(file, buffer, sizeof(buffer));
+  rapidjson::FileReadStream stream(file, buffer.get(), k_buffer_size);
   _doc.ParseStream(stream);
   std::fclose(file);
   if (_doc.HasParseError()) {
@@ -439,14 +441,34 @@ Trace::Trace(const std::string &path) : _trace_path(path) {
 
 Trace::~Trace() = default;
 
-void Trace::next(rapidjson::Value *entry) {
+rapidjson::Value &Trace::next() {
   if (_index >= _doc.Size() - 1) throw sequence_error("Session trace is over");
 
-  *entry = _doc[_index++];
+  // entries are not moved out of the document, so that the trace can be
+  // rewound and replayed again
+  auto &entry = _doc[_index++];
 
   if (0) {
-    std::cerr << "Trace read: " << to_json(entry) << "\n";
+    std::cerr << "Trace read: " << to_json(&entry) << "\n";
   }
+
+  return entry;
+}
+
+void Trace::rewind() {
+  _index = 0;
+  _got_error = false;
+  _last_request = nullptr;
+}
+
+const char *Trace::peek_subtype() const {
+  if (_index >= _doc.Size() - 1) return nullptr;
+
+  const auto &entry = _doc[_index];
+
+  if (!entry.IsObject() || !entry.HasMember("subtype")) return nullptr;
+
+  return entry["subtype"].GetString();
 }
 
 std::map<std::string, std::string> Trace::get_metadata() { return {}; }
@@ -478,12 +500,12 @@ void Trace::expect_request(rapidjson::Value *doc, const char *subtype,
               .c_str());
   }
 
-  _last_request = to_json(doc);
+  // serialized only if an error is reported, this is called for each request
+  _last_request = doc;
 }
 
 mysqlshdk::db::Connection_options Trace::expected_connect() {
-  rapidjson::Value obj;
-  next(&obj);
+  auto &obj = next();
 
   expect_request(&obj, "CONNECT");
   DBUG_LOG("sqlall", shcore::path::basename(_trace_path)
@@ -492,15 +514,13 @@ mysqlshdk::db::Connection_options Trace::expected_connect() {
 }
 
 void Trace::expected_close() {
-  rapidjson::Value obj;
-  next(&obj);
+  auto &obj = next();
 
   expect_request(&obj, "CLOSE");
 }
 
 std::string Trace::expected_query(const std::string &expected) {
-  rapidjson::Value obj;
-  next(&obj);
+  auto &obj = next();
 
   expect_request(&obj, "QUERY", expected.c_str());
   std::string query = obj["sql"].GetString();
@@ -523,8 +543,7 @@ void throw_error(rapidjson::Value *doc) {
 }
 
 void Trace::expected_status() {
-  rapidjson::Value obj;
-  next(&obj);
+  auto &obj = next();
 
   if (strcmp(obj["type"].GetString(), "response") != 0)
     throw sequence_error(shcore::str_format(
@@ -540,8 +559,7 @@ void Trace::expected_status() {
 
 void Trace::expected_connect_status(
     std::map<std::string, std::string> *out_info) {
-  rapidjson::Value obj;
-  next(&obj);
+  auto &obj = next();
 
   if (strcmp(obj["type"].GetString(), "response") != 0)
     throw sequence_error(shcore::str_format(
@@ -664,13 +682,13 @@ void Trace::unserialize_result_rows(
 
 std::shared_ptr<Result_mysql> Trace::expected_result(
     std::function<std::unique_ptr<IRow>(std::unique_ptr<IRow>)> intercept) {
-  rapidjson::Value obj;
-  next(&obj);
+  auto &obj = next();
 
   if (strcmp(obj["type"].GetString(), "response") != 0) {
     throw sequence_error(shcore::str_format(
         "Expected RESULT for %s in session trace, but got something else: %s",
-        _last_request.c_str(), to_json(&obj).c_str()));
+        _last_request ? to_json(_last_request).c_str() : "",
+        to_json(&obj).c_str()));
   }
 
   const char *subtype = obj["subtype"].GetString();
@@ -704,8 +722,7 @@ std::shared_ptr<Result_mysql> Trace::expected_result(
 
 std::shared_ptr<Result_mysqlx> Trace::expected_result_x(
     std::function<std::unique_ptr<IRow>(std::unique_ptr<IRow>)> intercept) {
-  rapidjson::Value obj;
-  next(&obj);
+  auto &obj = next();
 
   if (strcmp(obj["type"].GetString(), "response") != 0)
     throw sequence_error(shcore::str_format(
@@ -172,8 +172,20 @@ class Trace {
 
   size_t trace_index() const { return static_cast<size_t>(_index); }
 
+  /**
+   * Restarts the trace from its first entry, allows to replay the same parsed
+   * trace multiple times.
+   */
+  void rewind();
+
+  /**
+   * Returns the subtype (i.e. CONNECT, QUERY, CLOSE) of the next entry in the
+   * trace, or nullptr if the trace is over.
+   */
+  const char *peek_subtype() const;
+
  private:
-  void next(rapidjson::Value *entry);
+  rapidjson::Value &next();
   void unserialize_result_rows(
       rapidjson::Value *rlist, std::shared_ptr<Result_mysql> result,
       std::function<std::unique_ptr<IRow>(std::unique_ptr<IRow>)> intercept);
@@ -187,7 +199,7 @@ class Trace {
   std::string _trace_path;
   bool _got_error = false;
 
-  std::string _last_request;
+  rapidjson::Value *_last_request = nullptr;
 };
 
 bool is_set_as_string(Type type);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2022, Oracle and/or its affiliates.
+ * Copyright (c) 2021, 2023, Oracle and/or its affiliates.
  *
  * This program is free software; you can redistribute it and/or modify
  * it under the terms of the GNU General Public License, version 2.0,
@@ -23,8 +23,10 @@
 
 #include "mysqlshdk/libs/mysql/binlog_utils.h"
 
+#include <memory>
 #include <vector>
 
+#include "mysqlshdk/libs/db/mysql/session.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_sqlstring.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
@@ -42,20 +44,90 @@ void inject_gtid(const mysqlshdk::mysql::IInstance &server, const Gtid &gtid) {
 }
 
 size_t inject_gtid_set(const mysqlshdk::mysql::IInstance &server,
-                       const Gtid_set &gtid_set) {
-  shcore::on_leave_scope guard(
-      [&]() { server.executef("SET gtid_next = AUTOMATIC"); });
+                       const Gtid_set &gtid_set,
+                       const Gtid_injection_progress &progress,
+                       size_t batch_size) {
+  if (gtid_set.empty()) return 0;
+
+  // skip the transactions which were already injected (i.e. by a previous,
+  // interrupted call)
+  const auto gtids = Gtid_set::from_normalized_string(server.queryf_one_string(
+      0, "", "SELECT gtid_subtract(?, @@global.gtid_executed)",
+      gtid_set.str()));
+  const auto total = gtids.count();
+
+  if (0 == total) return 0;
 
-  size_t count = 0;
+  const auto session =
+      std::dynamic_pointer_cast<db::mysql::Session>(server.get_session());
 
-  gtid_set.enumerate([&server, &count](const Gtid &gtid) {
-    server.executef("SET gtid_next = ?", gtid);
-    server.execute("START TRANSACTION");
-    server.execute("COMMIT");
-    ++count;
+  if (!session || 0 == batch_size) {
+    batch_size = 1;
+  }
+
+  const auto multi_statements = batch_size > 1;
+
+  if (multi_statements) {
+    session->set_multi_statements(true);
+  }
+
+  shcore::on_leave_scope guard([&]() {
+    if (multi_statements) {
+      session->set_multi_statements(false);
+    }
+
+    server.executef("SET gtid_next = AUTOMATIC");
   });
 
-  return count;
+  std::string batch;
+  size_t pending = 0;
+  uint64_t injected = 0;
+
+  const auto flush = [&]() {
+    if (0 == pending) return;
+
+    if (multi_statements) {
+      // errors in the subsequent statements are reported when moving to their
+      // result sets, execution stops at the first one which fails
+      const auto result = server.query(batch);
+      while (result->next_resultset()) {
+      }
+
+      batch.clear();
+    }
+
+    injected += pending;
+    pending = 0;
+
+    if (progress) progress(injected, total);
+  };
+
+  gtids.enumerate_ranges([&](const Gtid_range &range) {
+    const auto &uuid = std::get<0>(range);
+
+    for (auto gno = std::get<1>(range), last = std::get<2>(range); gno <= last;
+         ++gno) {
+      const auto set_gtid_next = shcore::sqlformat(
+          "SET gtid_next = ?", uuid + ':' + std::to_string(gno));
+
+      if (multi_statements) {
+        if (!batch.empty()) batch += ';';
+
+        batch += set_gtid_next;
+        batch += ";START TRANSACTION;COMMIT";
+      } else {
+        server.execute(set_gtid_next);
+        server.execute("START TRANSACTION");
+        server.execute("COMMIT");
+      }
+
+      if (++pending >= batch_size) flush();
+    }
+  });
+
+  flush();
+
+  return injected;
 }
 
 [[maybe_unused]] std::vector<std::string> list_binlogs(
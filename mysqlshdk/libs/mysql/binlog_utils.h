@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2022, Oracle and/or its affiliates.
+ * Copyright (c) 2021, 2023, Oracle and/or its affiliates.
  *
  * This program is free software; you can redistribute it and/or modify
  * it under the terms of the GNU General Public License, version 2.0,
@@ -48,11 +48,34 @@ struct Binlog_event {
  */
 void inject_gtid(const mysqlshdk::mysql::IInstance &server, const Gtid &gtid);
 
+/**
+ * Called after each batch of injected transactions, with the number of
+ * transactions injected so far and the total number of transactions to inject.
+ */
+using Gtid_injection_progress =
+    std::function<void(uint64_t injected, uint64_t total)>;
+
+/**
+ * Default number of empty transactions sent to the server in a single packet.
+ */
+inline constexpr size_t k_gtid_injection_batch_size = 500;
+
 /**
  * Inject empty transactions with each of the gtids in the given set.
+ *
+ * GTIDs which are already in gtid_executed are skipped, so an interrupted
+ * injection can be resumed by calling this function again with the same set.
+ *
+ * If the server is using the classic protocol, transactions are sent in
+ * batches of up to batch_size transactions per multi-statement query, each
+ * batch being a checkpoint reported to the progress callback.
+ *
+ * @returns number of injected transactions
  */
-size_t inject_gtid_set(const mysqlshdk::mysql::IInstance &server,
-                       const Gtid_set &gtid_set);
+size_t inject_gtid_set(
+    const mysqlshdk::mysql::IInstance &server, const Gtid_set &gtid_set,
+    const Gtid_injection_progress &progress = {},
+    size_t batch_size = k_gtid_injection_batch_size);
 
 /**
  * Returns list of binary logs at the server.
@@ -24,6 +24,7 @@
 #include "mysqlshdk/libs/oci/oci_signer.h"
 
 #include <utility>
+#include <vector>
 
 #include "mysqlshdk/libs/utils/ssl_keygen.h"
 #include "mysqlshdk/libs/utils/strformat.h"
@@ -71,8 +72,7 @@ std::string sign(EVP_PKEY *sigkey, const std::string &string_to_sign) {
   return signature_b64;
 }
 
-std::string encode_sha256(const char *data, size_t size) {
-  const auto hash = shcore::ssl::sha256(data, size);
+std::string encode_sha256(const std::vector<unsigned char> &hash) {
   std::string encoded;
   shcore::encode_base64(hash.data(), hash.size(), &encoded);
 
@@ -112,7 +112,7 @@ rest::Headers Oci_signer::sign_request(const rest::Signed_request *request,
 
   if (method == rest::Type::POST) {
     all_headers["x-content-sha256"] =
-        encode_sha256(request->size ? request->body : "", request->size);
+        encode_sha256(request->body_sha256());
     all_headers["content-length"] = std::to_string(request->size);
     string_to_sign.append(
         "\nx-content-sha256: " + all_headers["x-content-sha256"] +
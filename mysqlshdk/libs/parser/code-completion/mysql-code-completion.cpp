@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015, 2022, Oracle and/or its affiliates.
+ * Copyright (c) 2015, 2023, Oracle and/or its affiliates.
  *
  * This program is free software; you can redistribute it and/or modify
  * it under the terms of the GNU General Public License, version 2.0,
@@ -286,10 +286,12 @@ struct AutoCompletionContext {
     c3.showDebugOutput = false;
     referencesStack.emplace_front();  // For the root level of table references.
 
-    parser->reset();
-    ParserRuleContext *context = parser->query();
-
-    completionCandidates = c3.collectCandidates(caretIndex, context);
+    // Candidates are always collected starting with the first token of the
+    // query rule. This is what the context would be if we parsed the input,
+    // but parsing the whole input (i.e. a long stored procedure) on every
+    // completion request is expensive, and the resulting tree is not used.
+    static_assert(MySQLParser::RuleQuery == 0);
+    completionCandidates = c3.collectCandidates(caretIndex, nullptr);
 
     // Post processing some entries.
     if (completionCandidates.tokens.count(MySQLLexer::NOT2_SYMBOL) > 0) {
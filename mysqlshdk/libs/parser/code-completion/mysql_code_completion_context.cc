@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022, Oracle and/or its affiliates.
+ * Copyright (c) 2022, 2023, Oracle and/or its affiliates.
  *
  * This program is free software; you can redistribute it and/or modify
  * it under the terms of the GNU General Public License, version 2.0,
@@ -24,6 +24,7 @@
 #include "mysqlshdk/libs/parser/code-completion/mysql_code_completion_context.h"
 
 #include <algorithm>
+#include <optional>
 #include <set>
 
 #include "mysqlshdk/libs/db/charset.h"
@@ -65,9 +66,25 @@ class Sql_completion_context::Impl {
   }
 
   Sql_completion_result complete(const std::string &sql, std::size_t offset) {
+    // completion is often requested multiple times for the same input (i.e.
+    // TAB is pressed twice to list the candidates)
+    if (m_last_result.has_value() && offset == m_last_offset &&
+        sql == m_last_sql) {
+      return *m_last_result;
+    }
+
+    invalidate();
     prepare(sql);
-    return getCodeCompletion(offset, m_active_schema, m_uppercase_keywords,
-                             m_filtered, &m_parser);
+
+    auto result = getCodeCompletion(offset, m_active_schema,
+                                    m_uppercase_keywords, m_filtered,
+                                    &m_parser);
+
+    m_last_sql = sql;
+    m_last_offset = offset;
+    m_last_result = result;
+
+    return result;
   }
 
   void set_server_version(const Version &version) {
@@ -75,6 +92,7 @@ class Sql_completion_context::Impl {
 
     if (m_parser.serverVersion != m_lexer.serverVersion) {
       resetPreconditions(&m_parser);
+      invalidate();
     }
 
     m_lexer.serverVersion = m_parser.serverVersion;
@@ -85,22 +103,39 @@ class Sql_completion_context::Impl {
 
     if (m_parser.sqlMode != m_lexer.sqlMode) {
       resetPreconditions(&m_parser);
+      invalidate();
     }
 
     m_lexer.sqlMode = m_parser.sqlMode;
   }
 
   void set_uppercase_keywords(bool uppercase) {
-    m_uppercase_keywords = uppercase;
+    if (m_uppercase_keywords != uppercase) {
+      m_uppercase_keywords = uppercase;
+      invalidate();
+    }
   }
 
-  void set_filtered(bool filtered) { m_filtered = filtered; }
+  void set_filtered(bool filtered) {
+    if (m_filtered != filtered) {
+      m_filtered = filtered;
+      invalidate();
+    }
+  }
 
   void set_active_schema(const std::string &active_schema) {
-    m_active_schema = active_schema;
+    if (m_active_schema != active_schema) {
+      m_active_schema = active_schema;
+      invalidate();
+    }
   }
 
  private:
+  void invalidate() {
+    m_last_result.reset();
+    m_last_sql.clear();
+  }
+
   void prepare(const std::string &sql) {
     m_parser.reset();
     m_lexer.reset();
@@ -118,6 +153,11 @@ class Sql_completion_context::Impl {
   bool m_uppercase_keywords = true;
   bool m_filtered = true;
   std::string m_active_schema;
+
+  // result of the last completion
+  std::string m_last_sql;
+  std::size_t m_last_offset = 0;
+  std::optional<Sql_completion_result> m_last_result;
 };
 
 Sql_completion_context::Sql_completion_context(const Version &version)
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/rest/connection_pool.h"
+
+#include <utility>
+
+#include "mysqlshdk/libs/utils/logger.h"
+
+namespace mysqlshdk {
+namespace rest {
+
+void Connection_pool::Handle_deleter::operator()(CURL *handle) const {
+  if (m_pool) {
+    m_pool->release(m_key, handle);
+  } else {
+    curl_easy_cleanup(handle);
+  }
+}
+
+std::shared_ptr<Connection_pool> Connection_pool::get() {
+  // handles and services keep the pool alive after this one is destroyed
+  static const std::shared_ptr<Connection_pool> s_pool{
+      new Connection_pool(), [](Connection_pool *pool) { delete pool; }};
+  return s_pool;
+}
+
+Connection_pool::Connection_pool()
+    : m_share(curl_share_init(), &curl_share_cleanup) {
+  if (m_share) {
+    curl_share_setopt(m_share.get(), CURLSHOPT_LOCKFUNC,
+                      &Connection_pool::lock);
+    curl_share_setopt(m_share.get(), CURLSHOPT_UNLOCKFUNC,
+                      &Connection_pool::unlock);
+    curl_share_setopt(m_share.get(), CURLSHOPT_USERDATA, this);
+    // connection cache is not shared, as it's not safe to use it concurrently
+    // in multiple threads, handles which hold the connections are pooled
+    // instead
+    curl_share_setopt(m_share.get(), CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    curl_share_setopt(m_share.get(), CURLSHOPT_SHARE,
+                      CURL_LOCK_DATA_SSL_SESSION);
+  }
+}
+
+Connection_pool::~Connection_pool() {
+  clear();
+  // share is cleaned up after all handles are gone
+}
+
+void Connection_pool::lock(CURL *, curl_lock_data data, curl_lock_access,
+                           void *ptr) {
+  static_cast<Connection_pool *>(ptr)->m_share_mutexes[data].lock();
+}
+
+void Connection_pool::unlock(CURL *, curl_lock_data data, void *ptr) {
+  static_cast<Connection_pool *>(ptr)->m_share_mutexes[data].unlock();
+}
+
+Connection_pool::Handle Connection_pool::acquire(const std::string &key) {
+  CURL *handle = nullptr;
+
+  {
+    std::lock_guard lock{m_mutex};
+
+    evict_idle_handles(std::chrono::steady_clock::now());
+
+    const auto it = m_idle.find(key);
+
+    if (m_idle.end() != it && !it->second.empty()) {
+      // use the most recently used handle, its connections are most likely
+      // still alive
+      handle = it->second.back().handle;
+      it->second.pop_back();
+    }
+  }
+
+  if (handle) {
+    ++m_handles_reused;
+  } else {
+    handle = create_handle();
+  }
+
+  return Handle{handle, Handle_deleter{shared_from_this(), key}};
+}
+
+Connection_pool::Handle Connection_pool::duplicate(const Handle &handle) {
+  ++m_handles_created;
+  const auto copy = curl_easy_duphandle(handle.get());
+  attach_share(copy);
+  return Handle{copy, handle.get_deleter()};
+}
+
+void Connection_pool::on_request_executed(CURL *handle) {
+  ++m_requests;
+
+  long new_connections = 0;
+  curl_easy_getinfo(handle, CURLINFO_NUM_CONNECTS, &new_connections);
+
+  if (new_connections > 0) {
+    m_connections_created += new_connections;
+
+    double app_connect = 0.0;
+    curl_easy_getinfo(handle, CURLINFO_APPCONNECT_TIME, &app_connect);
+
+    // TLS session was established or resumed when connecting
+    if (app_connect > 0.0) {
+      ++m_tls_handshakes;
+    }
+  } else {
+    ++m_connections_reused;
+  }
+}
+
+Connection_pool::Stats Connection_pool::stats() const {
+  Stats s;
+
+  s.handles_created = m_handles_created;
+  s.handles_reused = m_handles_reused;
+  s.requests = m_requests;
+  s.connections_created = m_connections_created;
+  s.connections_reused = m_connections_reused;
+  s.tls_handshakes = m_tls_handshakes;
+
+  return s;
+}
+
+void Connection_pool::clear() {
+  std::unordered_map<std::string, std::deque<Idle_handle>> idle;
+
+  {
+    std::lock_guard lock{m_mutex};
+    idle = std::move(m_idle);
+    m_idle.clear();
+  }
+
+  for (const auto &host : idle) {
+    for (const auto &h : host.second) {
+      curl_easy_cleanup(h.handle);
+    }
+  }
+}
+
+CURL *Connection_pool::create_handle() {
+  const auto handle = curl_easy_init();
+
+  attach_share(handle);
+  ++m_handles_created;
+
+  return handle;
+}
+
+void Connection_pool::attach_share(CURL *handle) {
+  if (handle && m_share) {
+    curl_easy_setopt(handle, CURLOPT_SHARE, m_share.get());
+  }
+}
+
+void Connection_pool::release(const std::string &key, CURL *handle) {
+  if (!handle) {
+    return;
+  }
+
+  // bring the handle back to the default state, this does not close the live
+  // connections, also removes any pointers to the data of the previous owner
+  curl_easy_reset(handle);
+  attach_share(handle);
+
+  CURL *excess = nullptr;
+
+  {
+    std::lock_guard lock{m_mutex};
+
+    const auto now = std::chrono::steady_clock::now();
+    auto &handles = m_idle[key];
+
+    handles.emplace_back(Idle_handle{handle, now});
+
+    if (handles.size() > k_max_idle_handles_per_host) {
+      // remove the least recently used handle
+      excess = handles.front().handle;
+      handles.pop_front();
+    }
+
+    evict_idle_handles(now);
+  }
+
+  if (excess) {
+    curl_easy_cleanup(excess);
+  }
+}
+
+void Connection_pool::evict_idle_handles(
+    std::chrono::steady_clock::time_point now) {
+  // m_mutex needs to be locked
+  for (auto it = m_idle.begin(); it != m_idle.end();) {
+    auto &handles = it->second;
+
+    // handles are ordered by the time they were released
+    while (!handles.empty() && now - handles.front().since > k_max_idle_time) {
+      curl_easy_cleanup(handles.front().handle);
+      handles.pop_front();
+    }
+
+    if (handles.empty()) {
+      it = m_idle.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+}  // namespace rest
+}  // namespace mysqlshdk
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_REST_CONNECTION_POOL_H_
+#define MYSQLSHDK_LIBS_REST_CONNECTION_POOL_H_
+
+#include <curl/curl.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace mysqlshdk {
+namespace rest {
+
+/**
+ * Process-wide pool of CURL handles, shared by all instances of Rest_service.
+ *
+ * Each CURL handle keeps its own cache of live connections, when a
+ * Rest_service is destroyed, its handle is returned to the pool and can be
+ * reused by another Rest_service which connects to the same host, avoiding a
+ * new TCP connection and TLS handshake. DNS cache and TLS sessions are shared
+ * between all handles.
+ *
+ * Handles hold a reference to the pool, so that it outlives all of them, even
+ * if they are released during the static destruction.
+ *
+ * This class is thread-safe.
+ */
+class Connection_pool final
+    : public std::enable_shared_from_this<Connection_pool> {
+ public:
+  struct Stats {
+    // number of handles created
+    uint64_t handles_created = 0;
+    // number of handles reused from the pool
+    uint64_t handles_reused = 0;
+    // number of executed requests
+    uint64_t requests = 0;
+    // number of new connections made
+    uint64_t connections_created = 0;
+    // number of requests which reused an existing connection
+    uint64_t connections_reused = 0;
+    // number of TLS handshakes (both full and resumed sessions)
+    uint64_t tls_handshakes = 0;
+  };
+
+  class Handle_deleter final {
+   public:
+    Handle_deleter() = default;
+
+    Handle_deleter(std::shared_ptr<Connection_pool> pool, std::string key)
+        : m_pool(std::move(pool)), m_key(std::move(key)) {}
+
+    void operator()(CURL *handle) const;
+
+    const std::string &key() const { return m_key; }
+
+   private:
+    std::shared_ptr<Connection_pool> m_pool;
+    std::string m_key;
+  };
+
+  using Handle = std::unique_ptr<CURL, Handle_deleter>;
+
+  // maximum number of idle handles kept for a single host
+  static constexpr std::size_t k_max_idle_handles_per_host = 64;
+
+  // idle handles are evicted after this time
+  static constexpr std::chrono::seconds k_max_idle_time{60};
+
+  Connection_pool(const Connection_pool &) = delete;
+  Connection_pool(Connection_pool &&) = delete;
+
+  Connection_pool &operator=(const Connection_pool &) = delete;
+  Connection_pool &operator=(Connection_pool &&) = delete;
+
+  static std::shared_ptr<Connection_pool> get();
+
+  /**
+   * Provides a CURL handle which is going to be used to connect to the given
+   * host. Handle is reset to the default state, but retains its connections.
+   *
+   * @param key Identifies the host: scheme, host name and port.
+   *
+   * @returns CURL handle, returned to the pool once it is destroyed.
+   */
+  Handle acquire(const std::string &key);
+
+  /**
+   * Creates a new handle, which is going to be returned to the pool using the
+   * same key as the given one.
+   */
+  Handle duplicate(const Handle &handle);
+
+  /**
+   * Updates the statistics once request is executed using the given handle.
+   */
+  void on_request_executed(CURL *handle);
+
+  Stats stats() const;
+
+  /**
+   * Closes all idle handles.
+   */
+  void clear();
+
+ private:
+  struct Idle_handle {
+    CURL *handle;
+    std::chrono::steady_clock::time_point since;
+  };
+
+  Connection_pool();
+
+  ~Connection_pool();
+
+  static void lock(CURL *, curl_lock_data data, curl_lock_access, void *ptr);
+
+  static void unlock(CURL *, curl_lock_data data, void *ptr);
+
+  CURL *create_handle();
+
+  void attach_share(CURL *handle);
+
+  void release(const std::string &key, CURL *handle);
+
+  void evict_idle_handles(std::chrono::steady_clock::time_point now);
+
+  // mutexes need to outlive the share
+  std::array<std::mutex, CURL_LOCK_DATA_LAST> m_share_mutexes;
+  std::unique_ptr<CURLSH, CURLSHcode (*)(CURLSH *)> m_share;
+
+  std::mutex m_mutex;
+  std::unordered_map<std::string, std::deque<Idle_handle>> m_idle;
+
+  std::atomic<uint64_t> m_handles_created{0};
+  std::atomic<uint64_t> m_handles_reused{0};
+  std::atomic<uint64_t> m_requests{0};
+  std::atomic<uint64_t> m_connections_created{0};
+  std::atomic<uint64_t> m_connections_reused{0};
+  std::atomic<uint64_t> m_tls_handshakes{0};
+};
+
+}  // namespace rest
+}  // namespace mysqlshdk
+
+#endif  // MYSQLSHDK_LIBS_REST_CONNECTION_POOL_H_
@@ -29,6 +29,7 @@
 #include <vector>
 
 #include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/libs/rest/connection_pool.h"
 #include "mysqlshdk/libs/rest/retry_strategy.h"
 #include "mysqlshdk/libs/utils/logger.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
@@ -212,9 +213,18 @@ class Rest_service::Impl {
    * Type of the HTTP request.
    */
   Impl(const Masked_string &base_url, bool verify, const std::string &label)
-      : m_handle(curl_easy_init(), &curl_easy_cleanup),
-        m_base_url{base_url},
-        m_request_sequence(0) {
+      : m_base_url{base_url}, m_request_sequence(0) {
+    mysqlshdk::db::uri::Generic_uri url;
+    mysqlshdk::db::uri::Uri_parser parser(mysqlshdk::db::uri::Type::Generic);
+    parser.parse(m_base_url.real(), &url);
+    m_port = url.port;
+
+    // handles (and their connections) are reused by services which connect to
+    // the same host
+    m_handle = m_pool->acquire(
+        url.scheme + "://" + url.host + ":" +
+        (m_port.has_value() ? std::to_string(*m_port) : ""));
+
     // Disable signal handlers used by libcurl, we're potentially going to use
     // timeouts and background threads.
     curl_easy_setopt(m_handle.get(), CURLOPT_NOSIGNAL, 1L);
@@ -225,11 +235,13 @@ class Rest_service::Impl {
     // introduce ourselves to the server
     curl_easy_setopt(m_handle.get(), CURLOPT_USERAGENT,
                      get_user_agent().c_str());
-
-    mysqlshdk::db::uri::Generic_uri url;
-    mysqlshdk::db::uri::Uri_parser parser(mysqlshdk::db::uri::Type::Generic);
-    parser.parse(m_base_url.real(), &url);
-    m_port = url.port;
+#if LIBCURL_VERSION_NUM >= 0x074100
+    // CURLOPT_MAXAGE_CONN was added in libcurl 7.65.0, connections which were
+    // idle for a longer period are not reused
+    curl_easy_setopt(
+        m_handle.get(), CURLOPT_MAXAGE_CONN,
+        static_cast<long>(Connection_pool::k_max_idle_time.count()));
+#endif
 
 #if LIBCURL_VERSION_NUM >= 0x071900
     // CURLOPT_TCP_KEEPALIVE was added in libcurl 7.25.0
@@ -337,6 +349,8 @@ class Rest_service::Impl {
       throw Connection_error{m_error_buffer, ret_val};
     }
 
+    m_pool->on_request_executed(m_handle.get());
+
     const auto status = get_status_code();
 
     log_response(m_request_sequence, status, header_data);
@@ -386,7 +400,10 @@ class Rest_service::Impl {
   const Masked_string &base_url() const { return m_base_url; }
 
   void reset_connection() {
-    m_handle.reset(curl_easy_duphandle(m_handle.get()));
+    auto handle = m_pool->duplicate(m_handle);
+    // connections held by the old handle may be broken, don't pool it
+    curl_easy_cleanup(m_handle.release());
+    m_handle = std::move(handle);
   }
 
  private:
@@ -498,7 +515,11 @@ class Rest_service::Impl {
     return static_cast<Response::Status_code>(response_code);
   }
 
-  std::unique_ptr<CURL, void (*)(CURL *)> m_handle;
+  // services keep the pool alive, they may be destroyed after it's released
+  // by Connection_pool::get()
+  std::shared_ptr<Connection_pool> m_pool = Connection_pool::get();
+
+  Connection_pool::Handle m_handle;
 
   char m_error_buffer[CURL_ERROR_SIZE];
 
@@ -28,6 +28,7 @@
 #include <vector>
 
 #include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/ssl_keygen.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 
 namespace mysqlshdk {
@@ -77,6 +78,15 @@ const Headers &Signed_request::headers() const {
   }
 }
 
+const std::vector<unsigned char> &Signed_request::body_sha256() const {
+  if (m_body_sha256.empty()) {
+    // requests are signed again when they are retried, hash is computed once
+    m_body_sha256 = shcore::ssl::sha256(size ? body : "", size);
+  }
+
+  return m_body_sha256;
+}
+
 Signed_rest_service::Signed_rest_service(
     const Signed_rest_service_config &config)
     : m_endpoint{config.service_endpoint()},
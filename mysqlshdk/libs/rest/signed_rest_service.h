@@ -28,6 +28,7 @@
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "mysqlshdk/libs/rest/response.h"
 #include "mysqlshdk/libs/rest/rest_service.h"
@@ -48,12 +49,24 @@ struct Signed_request : public rest::Request {
 
   const Headers &unsigned_headers() const { return m_headers; }
 
+  /**
+   * SHA256 hash of the body. If it was not provided, it's computed once, when
+   * it is needed for the first time.
+   */
+  const std::vector<unsigned char> &body_sha256() const;
+
+  void set_body_sha256(std::vector<unsigned char> hash) {
+    m_body_sha256 = std::move(hash);
+  }
+
  private:
   friend class Signed_rest_service;
 
   Signed_rest_service *m_service = nullptr;
 
   rest::Headers m_signed_headers;
+
+  mutable std::vector<unsigned char> m_body_sha256;
 };
 
 class Signer {
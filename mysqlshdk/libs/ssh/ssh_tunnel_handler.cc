@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2022, Oracle and/or its affiliates.
+ * Copyright (c) 2021, 2023, Oracle and/or its affiliates.
  *
  * This program is free software; you can redistribute it and/or modify
  * it under the terms of the GNU General Public License, version 2.0,
@@ -23,10 +23,15 @@
 
 #include "mysqlshdk/libs/ssh/ssh_tunnel_handler.h"
 
+#ifndef _WIN32
+#include <unistd.h>
+#endif  // !_WIN32
+
 #include <string>
 #include <utility>
 #include <vector>
 #include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/strformat.h"
 
 #ifndef MSG_NOSIGNAL
 #define MSG_NOSIGNAL 0
@@ -40,15 +45,29 @@ namespace mysqlshdk {
 namespace ssh {
 
 namespace {
-int on_socket_event(socket_t UNUSED(fd), int UNUSED(revents),
-                    void *UNUSED(userdata)) {
+int on_socket_event(socket_t UNUSED(fd), int UNUSED(revents), void *userdata) {
   // the return should be:
   //  0 success
   // -1 the internal ssh_poll_handle was removed/freed and should be removed
   // from the context -2 an error happened and the ssh_event_dopoll() should
   // stop
+
+  // client socket has data or was closed, it's going to be serviced once
+  // ssh_event_dopoll() returns
+  *static_cast<bool *>(userdata) = true;
+  return 0;
+}
+
+#ifndef _WIN32
+int on_wakeup_event(socket_t fd, int UNUSED(revents), void *UNUSED(userdata)) {
+  char buffer[64];
+
+  while (read(fd, buffer, sizeof(buffer)) > 0) {
+  }
+
   return 0;
 }
+#endif  // !_WIN32
 
 void cleanup_socket(ssh_event e, int sock,
                     std::unique_ptr<::ssh::Channel> chan) {
@@ -64,6 +83,20 @@ Ssh_tunnel_handler::Ssh_tunnel_handler(uint16_t local_port, int local_socket,
     : m_session(std::move(session)),
       m_local_port(local_port),
       m_local_socket(local_socket) {
+  m_buffer.resize(m_session->config().get_buffer_size());
+
+#ifndef _WIN32
+  if (pipe(m_wakeup_pipe) == 0) {
+    for (const auto fd : m_wakeup_pipe) {
+      fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+    }
+  } else {
+    log_warning("SSH: tunnel handler: Unable to create wakeup pipe: %s",
+                get_error().c_str());
+    m_wakeup_pipe[0] = m_wakeup_pipe[1] = -1;
+  }
+#endif  // !_WIN32
+
   make_event();
 }
 
@@ -74,15 +107,36 @@ Ssh_tunnel_handler::~Ssh_tunnel_handler() {
     m_session->disconnect();
     m_session.reset();
   }
+
+#ifndef _WIN32
+  for (auto &fd : m_wakeup_pipe) {
+    if (fd >= 0) {
+      close(fd);
+      fd = -1;
+    }
+  }
+#endif  // !_WIN32
 }
 
 void Ssh_tunnel_handler::make_event() {
   m_event = ssh_event_new();
   ssh_event_add_session(m_event, m_session->get_csession());
+
+#ifndef _WIN32
+  if (m_wakeup_pipe[0] >= 0 &&
+      ssh_event_add_fd(m_event, m_wakeup_pipe[0], POLLIN, on_wakeup_event,
+                       nullptr) != SSH_OK) {
+    log_warning(
+        "SSH: tunnel handler: Could not register wakeup event handler.");
+  }
+#endif  // !_WIN32
 }
 
 void Ssh_tunnel_handler::cleanup_event() {
   if (m_event) {
+#ifndef _WIN32
+    if (m_wakeup_pipe[0] >= 0) ssh_event_remove_fd(m_event, m_wakeup_pipe[0]);
+#endif  // !_WIN32
     ssh_event_remove_session(m_event, m_session->get_csession());
     ssh_event_free(m_event);
     m_event = nullptr;
@@ -113,6 +167,8 @@ void Ssh_tunnel_handler::handle_connection() {
       m_new_connection.pop();
     }
     lock.unlock();
+    // new connections interrupt the poll using the wakeup pipe, the timeout
+    // only bounds the time it takes to notice that the handler was stopped
     rc = ssh_event_dopoll(m_event, 100);
 
     if (rc == SSH_ERROR) {
@@ -127,11 +183,7 @@ void Ssh_tunnel_handler::handle_connection() {
             "SSH: tunnel handler: There was an error handling connection poll, "
             "retrying");
 
-      for (auto &s_it : m_client_socket_list) {
-        cleanup_socket(m_event, s_it.first, std::move(s_it.second));
-      }
-      m_client_socket_list.clear();
-
+      close_all_channels();
       cleanup_event();
 
       if (!m_session->is_connected()) m_session->clean_connect();
@@ -147,11 +199,21 @@ void Ssh_tunnel_handler::handle_connection() {
     for (auto it = m_client_socket_list.begin();
          it != m_client_socket_list.end() && !m_stop;) {
       try {
-        transfer_data_from_client(it->first, it->second.get());
-        transfer_data_to_client(it->first, it->second.get());
+        // client sockets are read only if poll() reported them as ready,
+        // channels are checked every time, as libssh may have already
+        // received (and buffered) their data while handling other channels
+        if (it->second.client_readable &&
+            !transfer_data_from_client(it->first, &it->second)) {
+          log_debug("SSH: tunnel handler: Client disconnected.");
+          close_channel(it->first, &it->second);
+          it = m_client_socket_list.erase(it);
+          continue;
+        }
+
+        transfer_data_to_client(it->first, &it->second);
         ++it;
       } catch (const Ssh_tunnel_exception &exc) {
-        cleanup_socket(m_event, it->first, std::move(it->second));
+        close_channel(it->first, &it->second);
         it = m_client_socket_list.erase(it);
         log_error("SSH: tunnel handler: Error during data transfer: %s",
                   exc.what());
@@ -159,11 +221,48 @@ void Ssh_tunnel_handler::handle_connection() {
     }
   } while (!m_stop);
 
+  close_all_channels();
+  log_debug3("SSH: tunnel handler: Tunnel handler thread stopped.");
+}
+
+void Ssh_tunnel_handler::close_channel(int sock, Forwarded_channel *fwd) {
+  const auto seconds = std::chrono::duration<double>(
+                           std::chrono::steady_clock::now() - fwd->opened)
+                           .count();
+
+  log_debug(
+      "SSH: tunnel handler: Closing channel of client socket %d, open for %s, "
+      "sent: %s (%s), received: %s (%s).",
+      sock, mysqlshdk::utils::format_seconds(seconds).c_str(),
+      mysqlshdk::utils::format_bytes(fwd->bytes_sent).c_str(),
+      mysqlshdk::utils::format_throughput_bytes(fwd->bytes_sent, seconds)
+          .c_str(),
+      mysqlshdk::utils::format_bytes(fwd->bytes_received).c_str(),
+      mysqlshdk::utils::format_throughput_bytes(fwd->bytes_received, seconds)
+          .c_str());
+
+  cleanup_socket(m_event, sock, std::move(fwd->channel));
+}
+
+void Ssh_tunnel_handler::close_all_channels() {
   for (auto &s_it : m_client_socket_list) {
-    cleanup_socket(m_event, s_it.first, std::move(s_it.second));
+    close_channel(s_it.first, &s_it.second);
   }
+
   m_client_socket_list.clear();
-  log_debug3("SSH: tunnel handler: Tunnel handler thread stopped.");
+}
+
+void Ssh_tunnel_handler::wakeup() {
+#ifndef _WIN32
+  if (m_wakeup_pipe[1] >= 0) {
+    const char c = 0;
+    // if the pipe is full, the poll is going to be interrupted anyway
+    if (write(m_wakeup_pipe[1], &c, 1) < 0 && EAGAIN != errno) {
+      log_debug("SSH: tunnel handler: Unable to wake up the handler: %s",
+                get_error().c_str());
+    }
+  }
+#endif  // !_WIN32
 }
 
 bool Ssh_tunnel_handler::handle_new_connection(int incoming_socket) {
@@ -191,20 +290,27 @@ bool Ssh_tunnel_handler::handle_new_connection(int incoming_socket) {
     log_error("SSH: tunnel handler: Failed to set SO_NOSIGPIPE on socket");
 #endif
 
-  std::lock_guard<std::recursive_mutex> guard(m_new_connection_mtx);
-  m_new_connection.push(client_sock);
+  {
+    std::lock_guard<std::recursive_mutex> guard(m_new_connection_mtx);
+    m_new_connection.push(client_sock);
+  }
+
+  wakeup();
   log_debug3("SSH: tunnel handler: Accepted new connection.");
   return true;
 }
 
-void Ssh_tunnel_handler::transfer_data_from_client(int sock,
-                                                   ::ssh::Channel *chan) {
+bool Ssh_tunnel_handler::transfer_data_from_client(int sock,
+                                                   Forwarded_channel *fwd) {
+  const auto chan = fwd->channel.get();
   ssize_t readlen = 0;
-  std::vector<char> buff(m_session->config().get_buffer_size(), '\0');
 
-  while (!m_stop && (readlen = recv(sock, buff.data(), buff.size(), 0)) > 0) {
+  while (!m_stop &&
+         (readlen = recv(sock, m_buffer.data(), m_buffer.size(), 0)) > 0) {
+    fwd->bytes_sent += readlen;
+
     int b_written = 0;
-    for (char *buff_ptr = buff.data(); readlen > 0 && !m_stop;
+    for (char *buff_ptr = m_buffer.data(); readlen > 0 && !m_stop;
          buff_ptr += b_written, readlen -= b_written) {
       try {
         b_written = chan->write(buff_ptr, readlen);
@@ -217,6 +323,18 @@ void Ssh_tunnel_handler::transfer_data_from_client(int sock,
       }
     }
   }
+
+  if (0 == readlen) {
+    // orderly shutdown of the client connection
+    return false;
+  }
+
+  if (readlen < 0) {
+    // everything was read, wait for poll() to report new data
+    fwd->client_readable = false;
+  }
+
+  return true;
 }
 
 namespace {
@@ -238,12 +356,13 @@ std::string err_code_to_string(int err) {
 }  // namespace
 
 void Ssh_tunnel_handler::transfer_data_to_client(int sock,
-                                                 ::ssh::Channel *chan) {
+                                                 Forwarded_channel *fwd) {
+  const auto chan = fwd->channel.get();
   ssize_t readlen = 0;
-  std::vector<char> buff(m_session->config().get_buffer_size(), '\0');
+
   do {
     try {
-      readlen = chan->readNonblocking(buff.data(), buff.size());
+      readlen = chan->readNonblocking(m_buffer.data(), m_buffer.size());
     } catch (::ssh::SshException &exc) {
       throw Ssh_tunnel_exception(exc.getError());
     }
@@ -260,8 +379,10 @@ void Ssh_tunnel_handler::transfer_data_to_client(int sock,
       break;
     }
 
+    fwd->bytes_received += readlen;
+
     ssize_t b_written = 0;
-    for (char *buff_ptr = buff.data(); readlen > 0 && !m_stop;
+    for (char *buff_ptr = m_buffer.data(); readlen > 0 && !m_stop;
          buff_ptr += b_written, readlen -= b_written) {
       do {
         b_written = send(sock, buff_ptr, readlen, MSG_NOSIGNAL);
@@ -317,18 +438,20 @@ void Ssh_tunnel_handler::prepare_tunnel(int client_socket) {
   try {
     channel = open_tunnel();
 
+    auto &fwd = m_client_socket_list[client_socket];
+    fwd.channel = std::move(channel);
+    fwd.opened = std::chrono::steady_clock::now();
+
     int16_t events = POLLIN;
     if (ssh_event_add_fd(m_event, client_socket, events, on_socket_event,
-                         this) != SSH_OK) {
+                         &fwd.client_readable) != SSH_OK) {
       log_error(
           "SSH: tunnel handler: Unable to open tunnel. Could not register "
           "event handler.");
-      channel.reset();
+      m_client_socket_list.erase(client_socket);
       ssh_close_socket(client_socket);
     } else {
       log_debug("SSH: tunnel handler: Tunnel created.");
-      m_client_socket_list.insert(
-          std::make_pair(client_socket, std::move(channel)));
     }
   } catch (const ssh::Ssh_tunnel_exception &exc) {
     ssh_close_socket(client_socket);
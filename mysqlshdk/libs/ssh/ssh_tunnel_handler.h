@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2022, Oracle and/or its affiliates.
+ * Copyright (c) 2021, 2023, Oracle and/or its affiliates.
  *
  * This program is free software; you can redistribute it and/or modify
  * it under the terms of the GNU General Public License, version 2.0,
@@ -30,11 +30,13 @@
 #include <poll.h>
 #endif
 #include <string.h>
+#include <chrono>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <queue>
 #include <thread>
+#include <vector>
 #include "mysqlshdk/libs/ssh/ssh_common.h"
 #include "mysqlshdk/libs/ssh/ssh_session.h"
 
@@ -73,26 +75,48 @@ class Ssh_tunnel_handler : public Ssh_thread {
   }
 
  protected:
+  /**
+   * A client connection forwarded through an SSH channel.
+   */
+  struct Forwarded_channel {
+    std::unique_ptr<::ssh::Channel> channel;
+    // set by the poll callback when the client socket has data (or was
+    // closed), cleared once it's drained
+    bool client_readable = true;
+    uint64_t bytes_sent = 0;
+    uint64_t bytes_received = 0;
+    std::chrono::steady_clock::time_point opened;
+  };
+
   void run() override;
 
   std::unique_ptr<Ssh_session> m_session;
   uint16_t m_local_port;
   int m_local_socket;
-  std::map<int, std::unique_ptr<::ssh::Channel>> m_client_socket_list;
+  std::map<int, Forwarded_channel> m_client_socket_list;
   ssh_event m_event = nullptr;
 
  private:
   void handle_connection();
-  void transfer_data_from_client(int sock, ::ssh::Channel *chan);
-  void transfer_data_to_client(int sock, ::ssh::Channel *chan);
+  bool transfer_data_from_client(int sock, Forwarded_channel *fwd);
+  void transfer_data_to_client(int sock, Forwarded_channel *fwd);
   std::unique_ptr<::ssh::Channel> open_tunnel();
   void prepare_tunnel(int client_socket);
+  void close_channel(int sock, Forwarded_channel *fwd);
+  void close_all_channels();
   void make_event();
   void cleanup_event();
+  void wakeup();
 
   std::recursive_mutex m_new_connection_mtx;
   std::queue<int> m_new_connection;
   std::atomic_int m_usage = 0;
+  // shared by all the channels, they are serviced by a single thread
+  std::vector<char> m_buffer;
+#ifndef _WIN32
+  // used to interrupt ssh_event_dopoll() when a new connection is queued
+  int m_wakeup_pipe[2] = {-1, -1};
+#endif  // !_WIN32
 };
 
 }  // namespace ssh
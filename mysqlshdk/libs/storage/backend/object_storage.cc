@@ -121,30 +121,35 @@ std::unordered_set<IDirectory::File_info> Directory::list_multipart_uploads()
 std::unordered_set<IDirectory::File_info> Directory::filter_files(
     const std::string &pattern) const {
   std::unordered_set<IDirectory::File_info> files;
-  std::vector<Object_details> objects;
+
+  for_each_file(pattern, [&files](File_info &&file) {
+    files.emplace(std::move(file));
+  });
+
+  return files;
+}
+
+void Directory::for_each_file(
+    const std::string &pattern,
+    const std::function<void(File_info &&)> &callback) const {
+  // only objects which begin with the literal part of the pattern can match
+  // it, list just these, using a separate connection
+  const auto literal = pattern.substr(0, pattern.find_first_of("*?\\"));
+  const auto prefix_length = m_prefix.size();
 
   try {
-    objects = m_container->list_objects(m_prefix, 0, false);
+    m_container->config()->container()->for_each_object(
+        m_prefix + literal, false,
+        [&pattern, &callback, prefix_length](Object_details &&object) {
+          auto file_name = object.name.substr(prefix_length);
+
+          if (!file_name.empty() && shcore::match_glob(pattern, file_name)) {
+            callback({std::move(file_name), object.size});
+          }
+        });
   } catch (const rest::Response_error &error) {
     throw rest::to_exception(error);
   }
-
-  if (m_prefix.empty()) {
-    for (auto &object : objects) {
-      if (shcore::match_glob(pattern, object.name)) {
-        files.emplace(std::move(object.name), object.size);
-      }
-    }
-  } else {
-    for (const auto &object : objects) {
-      auto file_name = object.name.substr(m_prefix.size());
-      if (!file_name.empty() && shcore::match_glob(pattern, file_name)) {
-        files.emplace(std::move(file_name), object.size);
-      }
-    }
-  }
-
-  return files;
 }
 
 std::string Directory::join_path(const std::string &a,
@@ -320,6 +325,10 @@ void Object::remove() { m_container->delete_object(full_path().real()); }
 
 Object::Writer::Writer(Object *owner, Multipart_object *object)
     : File_handler(owner), m_is_multipart(false) {
+  if (m_object->m_container->body_sha256_required()) {
+    m_buffer_hash = std::make_unique<shcore::ssl::Sha256>();
+  }
+
   // This is the writer for an already started multipart object
   if (object) {
     m_multipart = *object;
@@ -373,22 +382,27 @@ ssize_t Object::Writer::write(const void *buffer, size_t length) {
   while (to_send > MY_MAX_PART_SIZE) {
     const char *part = nullptr;
 
+    std::vector<unsigned char> part_hash;
+
     if (!m_buffer.empty()) {
       // BUFFERED DATA: fills the buffer and sends it
       const auto buffer_space = MY_MAX_PART_SIZE - m_buffer.size();
-      m_buffer.append(incoming + incoming_offset, buffer_space);
+      append(incoming + incoming_offset, buffer_space);
 
       part = m_buffer.data();
+      part_hash = buffer_hash();
       incoming_offset += buffer_space;
     } else {
-      // NO BUFFERED DATA: sends the data directly from the incoming buffer
+      // NO BUFFERED DATA: sends the data directly from the incoming buffer,
+      // hash is computed when the request is signed
       part = incoming + incoming_offset;
       incoming_offset += MY_MAX_PART_SIZE;
     }
 
     try {
       m_parts.push_back(m_object->m_container->upload_part(
-          m_multipart, m_parts.size() + 1, part, MY_MAX_PART_SIZE));
+          m_multipart, m_parts.size() + 1, part, MY_MAX_PART_SIZE,
+          std::move(part_hash)));
     } catch (const rest::Response_error &error) {
       abort_multipart_upload("failure uploading part", error.format());
       throw rest::to_exception(error);
@@ -400,8 +414,7 @@ ssize_t Object::Writer::write(const void *buffer, size_t length) {
 
   // REMAINING DATA: gets buffered again
   const auto remaining_input = length - incoming_offset;
-  if (remaining_input)
-    m_buffer.append(incoming + incoming_offset, remaining_input);
+  if (remaining_input) append(incoming + incoming_offset, remaining_input);
 
   m_size += length;
 
@@ -414,7 +427,8 @@ void Object::Writer::close() {
     try {
       if (!m_buffer.empty()) {
         m_parts.push_back(m_object->m_container->upload_part(
-            m_multipart, m_parts.size() + 1, m_buffer.data(), m_buffer.size()));
+            m_multipart, m_parts.size() + 1, m_buffer.data(), m_buffer.size(),
+            buffer_hash()));
       }
 
       m_object->m_container->commit_multipart_upload(m_multipart, m_parts);
@@ -430,7 +444,8 @@ void Object::Writer::close() {
     try {
       if (!m_buffer.empty()) {
         m_object->m_container->put_object(m_object->full_path().real(),
-                                          m_buffer.data(), m_buffer.size());
+                                          m_buffer.data(), m_buffer.size(),
+                                          buffer_hash());
       }
     } catch (const rest::Response_error &error) {
       throw rest::to_exception(error);
@@ -447,6 +462,24 @@ void Object::Writer::reset() {
   m_is_multipart = false;
   m_buffer.clear();
   m_parts.clear();
+
+  if (m_buffer_hash) {
+    m_buffer_hash->reset();
+  }
+}
+
+void Object::Writer::append(const char *data, size_t length) {
+  m_buffer.append(data, length);
+
+  // hash the data while it's still in the CPU cache, otherwise the whole buffer
+  // needs to be read again when the request is signed
+  if (m_buffer_hash) {
+    m_buffer_hash->update(data, length);
+  }
+}
+
+std::vector<unsigned char> Object::Writer::buffer_hash() {
+  return m_buffer_hash ? m_buffer_hash->finish() : std::vector<unsigned char>{};
 }
 
 void Object::Writer::abort_multipart_upload(const char *context,
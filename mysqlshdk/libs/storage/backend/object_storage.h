@@ -27,11 +27,13 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "mysqlshdk/libs/storage/idirectory.h"
 #include "mysqlshdk/libs/storage/ifile.h"
 
 #include "mysqlshdk/libs/storage/backend/object_storage_bucket.h"
+#include "mysqlshdk/libs/utils/ssl_keygen.h"
 
 // TODO(rennox): Add handling for read only bucket (public)
 // TODO(rennox): Should we support additional content/types on the objects being
@@ -97,9 +99,28 @@ class Directory : public mysqlshdk::storage::IDirectory {
   std::unordered_set<File_info> list_files(
       bool hidden_files = false) const override;
 
+  /**
+   * Retrieves a list of files on the directory which match the given pattern.
+   *
+   * NOTE: Only the objects which begin with the literal prefix of the pattern
+   * are listed. A new connection is used for each call, so this function can
+   * be called concurrently.
+   */
   std::unordered_set<File_info> filter_files(
       const std::string &pattern) const override;
 
+  /**
+   * Streams the objects which match the given pattern.
+   *
+   * NOTE: Like filter_files(), lists only the objects which begin with the
+   * literal prefix of the pattern, using a new connection for each call.
+   */
+  void for_each_file(
+      const std::string &pattern,
+      const std::function<void(File_info &&)> &callback) const override;
+
+  bool supports_prefix_filtering() const override { return true; }
+
   /**
    * Creates a new file handle for for a file contained on this directory.
    *
@@ -303,10 +324,15 @@ class Object : public mysqlshdk::storage::IFile {
    private:
     void reset();
 
+    void append(const char *data, size_t length);
+
+    std::vector<unsigned char> buffer_hash();
+
     void abort_multipart_upload(const char *context,
                                 const std::string &error = {});
 
     std::string m_buffer;
+    std::unique_ptr<shcore::ssl::Sha256> m_buffer_hash;
     bool m_is_multipart;
     Multipart_object m_multipart;
     std::vector<Multipart_object_part> m_parts;
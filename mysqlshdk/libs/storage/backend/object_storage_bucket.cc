@@ -23,6 +23,7 @@
 
 #include "mysqlshdk/libs/storage/backend/object_storage_bucket.h"
 
+#include <algorithm>
 #include <memory>
 #include <unordered_map>
 #include <utility>
@@ -59,8 +60,38 @@ std::vector<Object_details> Container::list_objects(
     const std::string &prefix, size_t limit, bool recursive,
     const Object_details::Fields_mask &fields,
     std::unordered_set<std::string> *out_prefixes) {
-  bool done = false;
   std::vector<Object_details> result;
+
+  list_objects(prefix, limit, recursive, fields, out_prefixes,
+               [&result, limit](std::vector<Object_details> &&list) {
+                 std::move(list.begin(), list.end(),
+                           std::back_inserter(result));
+                 return result.size() != limit;
+               });
+
+  return result;
+}
+
+void Container::for_each_object(
+    const std::string &prefix, bool recursive,
+    const std::function<void(Object_details &&)> &callback,
+    const Object_details::Fields_mask &fields) {
+  list_objects(prefix, 0, recursive, fields, nullptr,
+               [&callback](std::vector<Object_details> &&list) {
+                 for (auto &object : list) {
+                   callback(std::move(object));
+                 }
+
+                 return true;
+               });
+}
+
+void Container::list_objects(
+    const std::string &prefix, size_t limit, bool recursive,
+    const Object_details::Fields_mask &fields,
+    std::unordered_set<std::string> *out_prefixes,
+    const std::function<bool(std::vector<Object_details> &&)> &callback) {
+  bool done = false;
   std::string next_start;
   auto remaining = limit;
 
@@ -82,16 +113,10 @@ std::vector<Object_details> Container::list_objects(
     }
 
     next_start.clear();
+    std::vector<Object_details> list;
 
     try {
-      auto list =
-          parse_list_objects(response.buffer, &next_start, out_prefixes);
-
-      if (remaining) {
-        remaining -= result.size();
-      }
-
-      std::move(list.begin(), list.end(), std::back_inserter(result));
+      list = parse_list_objects(response.buffer, &next_start, out_prefixes);
     } catch (const shcore::Exception &error) {
       const auto msg = "Failed to parse 'list objects' (with prefix '" +
                        prefix + "') response: " + error.what();
@@ -103,12 +128,14 @@ std::vector<Object_details> Container::list_objects(
       throw shcore::Exception::runtime_error(msg);
     }
 
-    if (next_start.empty() || result.size() == limit) {
+    if (remaining) {
+      remaining -= std::min(remaining, list.size());
+    }
+
+    if (!callback(std::move(list)) || next_start.empty()) {
       done = true;
     }
   }
-
-  return result;
 }
 
 size_t Container::head_object(const std::string &object_name) {
@@ -150,12 +177,14 @@ void Container::rename_object(const std::string &src_name,
 }
 
 void Container::put_object(const std::string &object_name, const char *data,
-                           size_t size) {
+                           size_t size,
+                           std::vector<unsigned char> data_sha256) {
   Headers headers{{"content-type", "application/octet-stream"}};
 
   auto request = put_object_request(object_name, std::move(headers));
   request.body = data;
   request.size = size;
+  request.set_body_sha256(std::move(data_sha256));
 
   try {
     FI_TRIGGER_TRAP(os_bucket,
@@ -329,12 +358,13 @@ Multipart_object Container::create_multipart_upload(
   }
 }
 
-Multipart_object_part Container::upload_part(const Multipart_object &object,
-                                             size_t part_num, const char *body,
-                                             size_t size) {
+Multipart_object_part Container::upload_part(
+    const Multipart_object &object, size_t part_num, const char *body,
+    size_t size, std::vector<unsigned char> body_sha256) {
   auto request = upload_part_request(object, part_num, size);
   request.body = body;
   request.size = size;
+  request.set_body_sha256(std::move(body_sha256));
   Response response;
 
   try {
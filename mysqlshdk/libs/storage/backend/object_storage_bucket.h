@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022, Oracle and/or its affiliates.
+ * Copyright (c) 2022, 2023, Oracle and/or its affiliates.
  *
  * This program is free software; you can redistribute it and/or modify
  * it under the terms of the GNU General Public License, version 2.0,
@@ -24,6 +24,7 @@
 #ifndef MYSQLSHDK_LIBS_STORAGE_BACKEND_OBJECT_STORAGE_BUCKET_H_
 #define MYSQLSHDK_LIBS_STORAGE_BACKEND_OBJECT_STORAGE_BUCKET_H_
 
+#include <functional>
 #include <optional>
 #include <string>
 #include <thread>
@@ -95,6 +96,20 @@ class Container {
       const Object_details::Fields_mask &fields = Object_details::NAME_SIZE,
       std::unordered_set<std::string> *out_prefixes = nullptr);
 
+  /**
+   * Lists objects in the bucket, passing them to the callback as soon as each
+   * page of results is received.
+   *
+   * @param prefix: List only objects with the specified prefix.
+   * @param recursive: Recurse into subdirectories.
+   * @param callback: Called for each object, in lexicographical order.
+   * @param fields: Fields to fetch.
+   */
+  void for_each_object(
+      const std::string &prefix, bool recursive,
+      const std::function<void(Object_details &&)> &callback,
+      const Object_details::Fields_mask &fields = Object_details::NAME_SIZE);
+
   /**
    * Retrieves basic information from an object in the bucket.
    *
@@ -135,9 +150,10 @@ class Container {
    * @param object_name: The name of the object to be created.
    * @param data: Buffer containing the information to be stored on the object.
    * @param size: The length of the data contained on the buffer.
+   * @param data_sha256: SHA256 hash of the data, if already known.
    */
   void put_object(const std::string &object_name, const char *data,
-                  size_t size);
+                  size_t size, std::vector<unsigned char> data_sha256 = {});
 
   /**
    * Retrieves content data from an object.
@@ -214,11 +230,20 @@ class Container {
    * @param part_num: an incremental identifier for the part, the object will be
    * assembled joining the parts in ascending order based on this identifier.
    *
+   * @param body_sha256: SHA256 hash of the body, if already known.
+   *
    * @returns the part summary of the uploaded part.
    */
-  Multipart_object_part upload_part(const Multipart_object &object,
-                                    size_t part_num, const char *body,
-                                    size_t size);
+  Multipart_object_part upload_part(
+      const Multipart_object &object, size_t part_num, const char *body,
+      size_t size, std::vector<unsigned char> body_sha256 = {});
+
+  /**
+   * Whether SHA256 hash of the data is used when signing the upload requests.
+   * If so, uploaders can compute it while the data is being buffered, instead
+   * of hashing the whole buffer once again when request is signed.
+   */
+  virtual bool body_sha256_required() const { return false; }
 
   /**
    * Finishes a multipart object upload.
@@ -249,6 +274,16 @@ class Container {
   rest::Signed_rest_service *ensure_connection();
 
  private:
+  /**
+   * Fetches the object listing page by page, calling the callback for each
+   * page, until listing is complete or callback returns false.
+   */
+  void list_objects(
+      const std::string &prefix, size_t limit, bool recursive,
+      const Object_details::Fields_mask &fields,
+      std::unordered_set<std::string> *out_prefixes,
+      const std::function<bool(std::vector<Object_details> &&)> &callback);
+
   virtual rest::Signed_request list_objects_request(
       const std::string &prefix, size_t limit, bool recursive,
       const Object_details::Fields_mask &fields,
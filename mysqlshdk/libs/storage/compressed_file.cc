@@ -27,6 +27,7 @@
 #include <utility>
 
 #include "mysqlshdk/libs/storage/compression/gz_file.h"
+#include "mysqlshdk/libs/storage/compression/parallel_gz_file.h"
 #include "mysqlshdk/libs/storage/compression/zstd_file.h"
 #include "mysqlshdk/libs/storage/idirectory.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
@@ -163,5 +164,15 @@ std::unique_ptr<IFile> make_file(std::unique_ptr<IFile> file, Compression c) {
   return result;
 }
 
+std::unique_ptr<IFile> make_file(std::unique_ptr<IFile> file, Compression c,
+                                 const Compression_options &options) {
+  if (Compression::GZIP == c && options.threads > 1) {
+    return std::make_unique<compression::Parallel_gz_file>(std::move(file),
+                                                           options.threads);
+  }
+
+  return make_file(std::move(file), c);
+}
+
 }  // namespace storage
 }  // namespace mysqlshdk
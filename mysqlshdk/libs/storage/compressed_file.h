@@ -24,6 +24,7 @@
 #ifndef MYSQLSHDK_LIBS_STORAGE_COMPRESSED_FILE_H_
 #define MYSQLSHDK_LIBS_STORAGE_COMPRESSED_FILE_H_
 
+#include <cstddef>
 #include <memory>
 #include <string>
 
@@ -94,6 +95,18 @@ Compression from_extension(const std::string &e);
 
 std::unique_ptr<IFile> make_file(std::unique_ptr<IFile> file, Compression c);
 
+/**
+ * Options which select the compression engine.
+ */
+struct Compression_options {
+  /// Number of threads used to compress the data, if more than one, an engine
+  /// which compresses in parallel is used (if compression supports it).
+  std::size_t threads = 1;
+};
+
+std::unique_ptr<IFile> make_file(std::unique_ptr<IFile> file, Compression c,
+                                 const Compression_options &options);
+
 }  // namespace storage
 }  // namespace mysqlshdk
 
@@ -52,7 +52,7 @@ ssize_t Gz_file::read(void *buffer, size_t length) {
   start_io();
 
   while (m_stream.avail_out) {
-    const auto input_buf = peek(CHUNK);
+    const auto input_buf = peek(INPUT_CHUNK);
     if (input_buf.length == 0) {
       break;
     }
@@ -83,7 +83,15 @@ ssize_t Gz_file::read(void *buffer, size_t length) {
       consume(consume_bytes);
       update_io(consume_bytes);
     }
-    if (result == Z_STREAM_END || result == Z_BUF_ERROR) {
+    if (result == Z_STREAM_END) {
+      // file may consist of multiple gzip members (i.e. written by
+      // Parallel_gz_file or concatenated), continue with the next one
+      if (0 == peek(INPUT_CHUNK).length) {
+        break;
+      }
+
+      inflateReset(&m_stream);
+    } else if (result == Z_BUF_ERROR) {
       break;
     }
   }
@@ -119,6 +127,7 @@ void Gz_file::init_read() {
                              m_stream.msg);
   }
   m_source.resize(0);
+  m_source_offset = 0;
 }
 
 void Gz_file::init_write() {
@@ -76,6 +76,9 @@ class Gz_file : public Compressed_file {
   };
 
   static constexpr const size_t CHUNK = 1 << 15;
+  // compressed data is read in bigger chunks, to reduce the number of calls
+  // to inflate() and to the underlying file
+  static constexpr const size_t INPUT_CHUNK = 1 << 18;
 
   static constexpr bool is_power_of_2(size_t x) {
     return ((x - 1) & x) == 0 && (x != 0);
@@ -100,15 +103,28 @@ class Gz_file : public Compressed_file {
   inline Buf_view peek(const size_t length);
 
   void consume(const size_t length) {
-    m_source.erase(m_source.begin(), m_source.begin() + length);
+    m_source_offset += length;
+
+    if (m_source_offset == m_source.size()) {
+      m_source.resize(0);
+      m_source_offset = 0;
+    }
   }
 
   z_stream m_stream;
   std::vector<uint8_t> m_source;
+  // beginning of the data which was not consumed yet
+  size_t m_source_offset = 0;
   std::optional<Mode> m_open_mode;
 };
 
 Gz_file::Buf_view Gz_file::peek(const size_t length) {
+  if (m_source_offset > 0 && m_source.size() - m_source_offset < length) {
+    // move the remaining data to the front instead of growing the buffer
+    m_source.erase(m_source.begin(), m_source.begin() + m_source_offset);
+    m_source_offset = 0;
+  }
+
   const auto avail = m_source.size();
   if (avail < length) {
     const auto want = align(length);
@@ -122,7 +138,8 @@ Gz_file::Buf_view Gz_file::peek(const size_t length) {
       m_source.resize(avail + bytes_read);
     }
   }
-  return Gz_file::Buf_view{m_source.data(), m_source.size()};
+  return Gz_file::Buf_view{m_source.data() + m_source_offset,
+                           m_source.size() - m_source_offset};
 }
 
 ssize_t Gz_file::do_write(void *buffer, size_t length, int flag) {
@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/storage/compression/parallel_gz_file.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/libs/utils/logger.h"
+
+namespace mysqlshdk {
+namespace storage {
+namespace compression {
+
+Parallel_gz_file::Parallel_gz_file(std::unique_ptr<IFile> file,
+                                   std::size_t threads, std::size_t block_size)
+    : Gz_file(std::move(file)), m_threads(threads), m_block_size(block_size) {
+  if (0 == m_threads) {
+    throw std::invalid_argument("Parallel_gz_file: need at least one thread");
+  }
+
+  if (0 == m_block_size) {
+    throw std::invalid_argument("Parallel_gz_file: block size cannot be 0");
+  }
+}
+
+Parallel_gz_file::~Parallel_gz_file() {
+  try {
+    if (m_writing) close();
+  } catch (const std::runtime_error &e) {
+    log_error("Failed to close GZ file: %s", e.what());
+  }
+}
+
+void Parallel_gz_file::open(Mode m) {
+  if (Mode::WRITE != m) {
+    Gz_file::open(m);
+    return;
+  }
+
+  if (!file()->is_open()) {
+    file()->open(m);
+  }
+
+  m_writing = true;
+  m_total_in = 0;
+  m_block.clear();
+  m_block.reserve(m_block_size);
+  m_member_written = false;
+
+  m_tasks = std::make_unique<shcore::Synchronized_queue<Member *>>();
+  m_workers.reserve(m_threads);
+
+  for (std::size_t i = 0; i < m_threads; ++i) {
+    m_workers.emplace_back(mysqlsh::spawn_scoped_thread([this]() {
+      while (true) {
+        const auto member = m_tasks->pop();
+
+        if (!member) {
+          break;
+        }
+
+        try {
+          compress(member);
+        } catch (...) {
+          member->exception = std::current_exception();
+        }
+
+        {
+          std::lock_guard lock{m_mutex};
+          member->ready = true;
+        }
+
+        m_member_ready.notify_one();
+      }
+    }));
+  }
+}
+
+bool Parallel_gz_file::is_open() const {
+  return m_writing ? file()->is_open() : Gz_file::is_open();
+}
+
+void Parallel_gz_file::close() {
+  if (!m_writing) {
+    Gz_file::close();
+    return;
+  }
+
+  try {
+    start_io();
+    finish_write();
+    finish_io();
+  } catch (...) {
+    stop_workers();
+    m_members.clear();
+    m_writing = false;
+
+    if (file()->is_open()) {
+      file()->close();
+    }
+
+    throw;
+  }
+
+  stop_workers();
+  m_writing = false;
+
+  if (file()->is_open()) {
+    file()->close();
+  }
+}
+
+ssize_t Parallel_gz_file::write(const void *buffer, size_t length) {
+  if (!m_writing) {
+    return Gz_file::write(buffer, length);
+  }
+
+  auto cbuffer = static_cast<const char *>(buffer);
+  auto remaining = length;
+
+  start_io();
+
+  while (remaining > 0) {
+    const auto bytes = std::min(remaining, m_block_size - m_block.size());
+
+    m_block.append(cbuffer, bytes);
+    cbuffer += bytes;
+    remaining -= bytes;
+
+    if (m_block.size() == m_block_size) {
+      submit_block();
+    }
+  }
+
+  m_total_in += length;
+
+  finish_io();
+
+  return length;
+}
+
+void Parallel_gz_file::compress(Member *member) const {
+  z_stream stream;
+
+  stream.zalloc = nullptr;
+  stream.zfree = nullptr;
+  stream.opaque = nullptr;
+
+  const int gzip_window_bits = 15 + 16;
+  const int mem_level = 8;
+  const int compression_level = 1;
+
+  if (Z_OK != deflateInit2(&stream, compression_level, Z_DEFLATED,
+                           gzip_window_bits, mem_level, Z_DEFAULT_STRATEGY)) {
+    throw std::runtime_error(std::string("deflate init failed: ") +
+                             (stream.msg ? stream.msg : "unknown error"));
+  }
+
+  auto &data = member->data;
+  auto &compressed = member->compressed;
+
+  compressed.resize(deflateBound(&stream, data.size()));
+
+  stream.next_in = reinterpret_cast<Bytef *>(data.data());
+  stream.avail_in = data.size();
+  stream.next_out = reinterpret_cast<Bytef *>(compressed.data());
+  stream.avail_out = compressed.size();
+
+  // output buffer is big enough to hold the whole member
+  const auto result = deflate(&stream, Z_FINISH);
+
+  compressed.resize(stream.total_out);
+  deflateEnd(&stream);
+
+  if (Z_STREAM_END != result) {
+    throw std::runtime_error(std::string("deflate: stream error (") +
+                             (stream.msg ? stream.msg : "unknown error") + ")");
+  }
+
+  // release the memory early
+  std::string{}.swap(data);
+}
+
+void Parallel_gz_file::submit_block() {
+  // limit the memory usage, wait for the oldest member to be written
+  while (m_members.size() >= 2 * m_threads) {
+    write_member();
+  }
+
+  auto member = std::make_unique<Member>();
+  member->data = std::move(m_block);
+
+  m_block = {};
+  m_block.reserve(m_block_size);
+
+  m_tasks->push(member.get());
+  m_members.emplace_back(std::move(member));
+}
+
+void Parallel_gz_file::write_member() {
+  const auto member = m_members.front().get();
+
+  {
+    std::unique_lock lock{m_mutex};
+    m_member_ready.wait(lock, [member]() { return member->ready; });
+  }
+
+  if (member->exception) {
+    std::rethrow_exception(member->exception);
+  }
+
+  const auto size = static_cast<ssize_t>(member->compressed.size());
+
+  if (file()->write(member->compressed.data(), size) != size) {
+    throw std::runtime_error("deflate: cannot write");
+  }
+
+  update_io(size);
+
+  m_members.pop_front();
+  m_member_written = true;
+}
+
+void Parallel_gz_file::finish_write() {
+  // empty file still needs to be a valid gzip file
+  if (!m_block.empty() || (m_members.empty() && !m_member_written)) {
+    submit_block();
+  }
+
+  while (!m_members.empty()) {
+    write_member();
+  }
+}
+
+void Parallel_gz_file::stop_workers() {
+  if (m_tasks) {
+    m_tasks->shutdown(m_workers.size());
+  }
+
+  for (auto &worker : m_workers) {
+    worker.join();
+  }
+
+  m_workers.clear();
+  m_tasks.reset();
+}
+
+}  // namespace compression
+}  // namespace storage
+}  // namespace mysqlshdk
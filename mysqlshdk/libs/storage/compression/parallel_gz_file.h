@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_STORAGE_COMPRESSION_PARALLEL_GZ_FILE_H_
+#define MYSQLSHDK_LIBS_STORAGE_COMPRESSION_PARALLEL_GZ_FILE_H_
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "mysqlshdk/libs/utils/synchronized_queue.h"
+
+#include "mysqlshdk/libs/storage/compression/gz_file.h"
+
+namespace mysqlshdk {
+namespace storage {
+namespace compression {
+
+/**
+ * Gzip file which, when writing, splits the data into blocks and compresses
+ * them in parallel, each block as an independent gzip member. Result is a
+ * valid multi-member gzip file, which can be decompressed by gunzip.
+ *
+ * Reading is handled by the Gz_file.
+ */
+class Parallel_gz_file : public Gz_file {
+ public:
+  Parallel_gz_file() = delete;
+
+  /**
+   * Wraps the given file.
+   *
+   * @param file File to be wrapped.
+   * @param threads Number of threads used to compress the data.
+   * @param block_size Size of the uncompressed data in a single gzip member.
+   *
+   * @throws std::invalid_argument if configuration is not valid
+   */
+  Parallel_gz_file(std::unique_ptr<IFile> file, std::size_t threads,
+                   std::size_t block_size = 1024 * 1024);
+
+  Parallel_gz_file(const Parallel_gz_file &other) = delete;
+  Parallel_gz_file(Parallel_gz_file &&other) = delete;
+
+  Parallel_gz_file &operator=(const Parallel_gz_file &other) = delete;
+  Parallel_gz_file &operator=(Parallel_gz_file &&other) = delete;
+
+  ~Parallel_gz_file() override;
+
+  void open(Mode m) override;
+  bool is_open() const override;
+  void close() override;
+
+  off64_t tell() const override {
+    return m_writing ? m_total_in : Gz_file::tell();
+  }
+
+  ssize_t write(const void *buffer, size_t length) override;
+
+ private:
+  struct Member {
+    std::string data;
+    std::string compressed;
+    bool ready = false;
+    std::exception_ptr exception;
+  };
+
+  void compress(Member *member) const;
+
+  void submit_block();
+
+  void write_member();
+
+  void finish_write();
+
+  void stop_workers();
+
+  std::size_t m_threads;
+  std::size_t m_block_size;
+
+  bool m_writing = false;
+  off64_t m_total_in = 0;
+  std::string m_block;
+  bool m_member_written = false;
+
+  // members in the order they are going to be written
+  std::deque<std::unique_ptr<Member>> m_members;
+
+  std::vector<std::thread> m_workers;
+  std::unique_ptr<shcore::Synchronized_queue<Member *>> m_tasks;
+
+  std::mutex m_mutex;
+  std::condition_variable m_member_ready;
+};
+
+}  // namespace compression
+}  // namespace storage
+}  // namespace mysqlshdk
+
+#endif  // MYSQLSHDK_LIBS_STORAGE_COMPRESSION_PARALLEL_GZ_FILE_H_
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, 2022, Oracle and/or its affiliates.
+ * Copyright (c) 2020, 2023, Oracle and/or its affiliates.
  *
  * This program is free software; you can redistribute it and/or modify
  * it under the terms of the GNU General Public License, version 2.0,
@@ -87,6 +87,14 @@ std::set<IDirectory::File_info> IDirectory::filter_files_sorted(
   return sort(filter_files(pattern));
 }
 
+void IDirectory::for_each_file(
+    const std::string &pattern,
+    const std::function<void(File_info &&)> &callback) const {
+  for (const auto &file : filter_files(pattern)) {
+    callback(File_info{file});
+  }
+}
+
 std::unique_ptr<IDirectory> make_directory(const std::string &path) {
   const auto scheme = utils::get_scheme(path);
   if (scheme.empty() || utils::scheme_matches(scheme, "file")) {
@@ -145,6 +145,29 @@ class IDirectory {
    */
   std::set<File_info> filter_files_sorted(const std::string &pattern) const;
 
+  /**
+   * Calls the callback for each file which matches the glob pattern.
+   *
+   * Remote backends pass the files to the callback as soon as each part of the
+   * listing is received, without materializing the whole contents of the
+   * directory.
+   *
+   * @param pattern Glob pattern, as in filter_files().
+   * @param callback Called for each file.
+   */
+  virtual void for_each_file(
+      const std::string &pattern,
+      const std::function<void(File_info &&)> &callback) const;
+
+  /**
+   * Whether filter_files() and for_each_file() list only the files which
+   * begin with the literal prefix of the pattern (the part before the first
+   * wildcard), and can be called concurrently from multiple threads.
+   *
+   * @returns true if listing with a prefix is cheaper than listing all files.
+   */
+  virtual bool supports_prefix_filtering() const { return false; }
+
   /**
    * Provides handle to the file with the specified name in this directory.
    *
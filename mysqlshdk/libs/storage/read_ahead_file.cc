@@ -0,0 +1,315 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/storage/read_ahead_file.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/libs/storage/compressed_file.h"
+#include "mysqlshdk/libs/storage/idirectory.h"
+
+namespace mysqlshdk {
+namespace storage {
+
+Read_ahead_threads::Read_ahead_threads(Read_block read_block)
+    : m_read_block(std::move(read_block)) {}
+
+Read_ahead_threads::~Read_ahead_threads() {
+  {
+    std::lock_guard lock{m_mutex};
+    m_stop = true;
+    m_task_ready.notify_all();
+  }
+
+  for (auto &thread : m_threads) {
+    thread.join();
+  }
+}
+
+std::size_t Read_ahead_threads::threads() const {
+  std::lock_guard lock{m_mutex};
+  return m_threads.size();
+}
+
+std::future<void> Read_ahead_threads::execute(std::function<void()> &&task) {
+  std::lock_guard lock{m_mutex};
+
+  if (m_tasks.size() >= m_idle) {
+    m_threads.emplace_back(mysqlsh::spawn_scoped_thread([this]() { run(); }));
+    ++m_idle;
+  }
+
+  auto &t = m_tasks.emplace_back();
+  t.run = std::move(task);
+  auto done = t.done.get_future();
+
+  m_task_ready.notify_one();
+
+  return done;
+}
+
+void Read_ahead_threads::read_block(const std::function<void()> &read) const {
+  if (m_read_block) {
+    m_read_block(read);
+  } else {
+    read();
+  }
+}
+
+void Read_ahead_threads::run() {
+  std::unique_lock lock{m_mutex};
+
+  while (true) {
+    m_task_ready.wait(lock, [this]() { return m_stop || !m_tasks.empty(); });
+
+    if (m_tasks.empty()) {
+      break;
+    }
+
+    auto task = std::move(m_tasks.front());
+    m_tasks.pop_front();
+    --m_idle;
+
+    lock.unlock();
+    task.run();
+    lock.lock();
+
+    ++m_idle;
+    task.done.set_value();
+  }
+}
+
+Read_ahead_file::Read_ahead_file(std::unique_ptr<IFile> file,
+                                 std::size_t block_size, std::size_t max_blocks)
+    : m_file(std::move(file)),
+      m_compressed(dynamic_cast<Compressed_file *>(m_file.get())),
+      m_block_size(block_size),
+      m_max_blocks(max_blocks),
+      m_threads(nullptr) {
+  if (0 == m_block_size) {
+    throw std::invalid_argument("Read_ahead_file: block size cannot be 0");
+  }
+
+  if (0 == m_max_blocks) {
+    throw std::invalid_argument("Read_ahead_file: need at least one block");
+  }
+}
+
+Read_ahead_file::Read_ahead_file(std::unique_ptr<IFile> file,
+                                 Read_ahead_threads &threads,
+                                 std::size_t block_size, std::size_t max_blocks)
+    : Read_ahead_file(std::move(file), block_size, max_blocks) {
+  m_threads = &threads;
+}
+
+Read_ahead_file::~Read_ahead_file() { close_impl(); }
+
+void Read_ahead_file::open(Mode m) {
+  if (m != Mode::READ) {
+    throw std::invalid_argument("Read_ahead_file: only READ mode is supported");
+  }
+
+  close_impl();
+
+  m_file->open(m);
+
+  m_finished = false;
+  m_stop = false;
+  m_worker_exception = nullptr;
+  m_current = {};
+  m_consumed = 0;
+  m_eof = false;
+  m_io_size = 0;
+
+  if (m_threads) {
+    m_task_done = m_threads->execute([this]() { read_ahead(); });
+  } else {
+    m_worker = mysqlsh::spawn_scoped_thread([this]() { read_ahead(); });
+  }
+
+  m_running = true;
+}
+
+std::unique_ptr<IDirectory> Read_ahead_file::parent() const {
+  return m_file->parent();
+}
+
+void Read_ahead_file::close() {
+  close_impl();
+
+  if (m_file->is_open()) {
+    m_file->close();
+  }
+}
+
+ssize_t Read_ahead_file::read(void *buffer, size_t length) {
+  ssize_t result = 0;
+  auto cbuffer = static_cast<char *>(buffer);
+
+  m_io_size = 0;
+
+  while (length > 0) {
+    if (m_consumed == m_current.data.size() && !next_block()) {
+      break;
+    }
+
+    const auto bytes = std::min(length, m_current.data.size() - m_consumed);
+
+    ::memcpy(cbuffer, m_current.data.data() + m_consumed, bytes);
+
+    m_consumed += bytes;
+    result += bytes;
+    cbuffer += bytes;
+    length -= bytes;
+  }
+
+  return result;
+}
+
+void Read_ahead_file::read_ahead() {
+  try {
+    while (true) {
+      Block block;
+      std::size_t bytes = 0;
+
+      if (m_threads) {
+        m_threads->read_block([this, &block, &bytes]() {
+          bytes = read_block(&block);
+        });
+      } else {
+        bytes = read_block(&block);
+      }
+
+      std::unique_lock lock{m_mutex};
+
+      m_space_ready.wait(
+          lock, [this]() { return m_stop || m_blocks.size() < m_max_blocks; });
+
+      if (m_stop) {
+        break;
+      }
+
+      if (0 == bytes) {
+        // end of file
+        break;
+      }
+
+      m_blocks.emplace_back(std::move(block));
+      m_block_ready.notify_one();
+    }
+  } catch (...) {
+    std::lock_guard lock{m_mutex};
+    m_worker_exception = std::current_exception();
+  }
+
+  std::lock_guard lock{m_mutex};
+  m_finished = true;
+  m_block_ready.notify_one();
+}
+
+std::size_t Read_ahead_file::read_block(Block *block) {
+  block->data.resize(m_block_size);
+
+  std::size_t bytes = 0;
+
+  while (bytes < m_block_size) {
+    const auto result =
+        m_file->read(block->data.data() + bytes, m_block_size - bytes);
+
+    if (result < 0) {
+      throw std::runtime_error("Failed to read '" +
+                               m_file->full_path().masked() +
+                               "', error: " + std::to_string(m_file->error()));
+    }
+
+    if (0 == result) {
+      break;
+    }
+
+    bytes += result;
+    block->io_size += m_compressed ? m_compressed->latest_io_size() : result;
+  }
+
+  block->data.resize(bytes);
+
+  return bytes;
+}
+
+void Read_ahead_file::close_impl() {
+  if (!m_running) {
+    return;
+  }
+
+  {
+    std::lock_guard lock{m_mutex};
+    m_stop = true;
+    m_space_ready.notify_one();
+  }
+
+  if (m_threads) {
+    m_task_done.wait();
+  } else {
+    m_worker.join();
+  }
+
+  m_running = false;
+  m_blocks.clear();
+}
+
+bool Read_ahead_file::next_block() {
+  if (m_eof) {
+    return false;
+  }
+
+  std::unique_lock lock{m_mutex};
+
+  m_block_ready.wait(lock,
+                     [this]() { return !m_blocks.empty() || m_finished; });
+
+  if (m_blocks.empty()) {
+    // worker has finished, all blocks were consumed
+    if (m_worker_exception) {
+      std::rethrow_exception(m_worker_exception);
+    }
+
+    m_eof = true;
+    return false;
+  }
+
+  m_current = std::move(m_blocks.front());
+  m_blocks.pop_front();
+  m_space_ready.notify_one();
+
+  lock.unlock();
+
+  m_consumed = 0;
+  m_io_size += m_current.io_size;
+
+  return true;
+}
+
+}  // namespace storage
+}  // namespace mysqlshdk
@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_STORAGE_READ_AHEAD_FILE_H_
+#define MYSQLSHDK_LIBS_STORAGE_READ_AHEAD_FILE_H_
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "mysqlshdk/libs/storage/ifile.h"
+
+namespace mysqlshdk {
+namespace storage {
+
+class Compressed_file;
+
+/**
+ * Threads which execute the background reads of Read_ahead_file instances.
+ * Each thread serves one file at a time, and is reused once that file is
+ * closed. New threads are started only if all the existing ones are busy.
+ */
+class Read_ahead_threads final {
+ public:
+  /**
+   * Called by a background thread to read each block of data, allows to
+   * execute the read in a specific context.
+   */
+  using Read_block = std::function<void(const std::function<void()> &)>;
+
+  explicit Read_ahead_threads(Read_block read_block = {});
+
+  Read_ahead_threads(const Read_ahead_threads &) = delete;
+  Read_ahead_threads(Read_ahead_threads &&) = delete;
+
+  Read_ahead_threads &operator=(const Read_ahead_threads &) = delete;
+  Read_ahead_threads &operator=(Read_ahead_threads &&) = delete;
+
+  ~Read_ahead_threads();
+
+  /**
+   * Provides the number of threads started so far.
+   */
+  std::size_t threads() const;
+
+ private:
+  friend class Read_ahead_file;
+
+  struct Task {
+    std::function<void()> run;
+    // set once the thread which executed the task is ready for another one
+    std::promise<void> done;
+  };
+
+  std::future<void> execute(std::function<void()> &&task);
+
+  void read_block(const std::function<void()> &read) const;
+
+  void run();
+
+  Read_block m_read_block;
+
+  std::vector<std::thread> m_threads;
+  std::deque<Task> m_tasks;
+  // number of threads which are not executing a task
+  std::size_t m_idle = 0;
+  bool m_stop = false;
+
+  mutable std::mutex m_mutex;
+  std::condition_variable m_task_ready;
+};
+
+/**
+ * Reads the wrapped file sequentially using a background thread, ahead of the
+ * consumer, storing the data in a bounded queue of blocks. Only for reading.
+ *
+ * If the wrapped file is compressed, data is decompressed by the background
+ * thread, and latest_io_size() reports the number of compressed bytes which
+ * were used to produce the data returned by the most recent read().
+ */
+class Read_ahead_file final : public IFile {
+ public:
+  /**
+   * Wraps the given file.
+   *
+   * @param file File to be read.
+   * @param block_size Size of a single block.
+   * @param max_blocks Maximum number of blocks which are read ahead.
+   *
+   * @throws std::invalid_argument if configuration is not valid
+   */
+  explicit Read_ahead_file(std::unique_ptr<IFile> file,
+                           std::size_t block_size = 1024 * 1024,
+                           std::size_t max_blocks = 4);
+
+  /**
+   * Wraps the given file, background reads are executed by the given threads
+   * instead of a thread which is started each time the file is opened.
+   *
+   * @param file File to be read.
+   * @param threads Threads to execute the reads, need to outlive this object.
+   * @param block_size Size of a single block.
+   * @param max_blocks Maximum number of blocks which are read ahead.
+   *
+   * @throws std::invalid_argument if configuration is not valid
+   */
+  Read_ahead_file(std::unique_ptr<IFile> file, Read_ahead_threads &threads,
+                  std::size_t block_size = 1024 * 1024,
+                  std::size_t max_blocks = 4);
+
+  Read_ahead_file(const Read_ahead_file &) = delete;
+  Read_ahead_file(Read_ahead_file &&) = delete;
+
+  Read_ahead_file &operator=(const Read_ahead_file &) = delete;
+  Read_ahead_file &operator=(Read_ahead_file &&) = delete;
+
+  ~Read_ahead_file() override;
+
+  void open(Mode m) override;
+
+  bool is_open() const override { return m_file->is_open(); }
+
+  int error() const override { return m_file->error(); }
+
+  void close() override;
+
+  size_t file_size() const override { return m_file->file_size(); }
+
+  Masked_string full_path() const override { return m_file->full_path(); }
+
+  std::string filename() const override { return m_file->filename(); }
+
+  bool exists() const override { return m_file->exists(); }
+
+  std::unique_ptr<IDirectory> parent() const override;
+
+  off64_t seek(off64_t) override {
+    throw std::logic_error("Read_ahead_file::seek() - not supported");
+  }
+
+  off64_t tell() const override {
+    throw std::logic_error("Read_ahead_file::tell() - not supported");
+  }
+
+  ssize_t read(void *buffer, size_t length) override;
+
+  ssize_t write(const void *, size_t) override {
+    throw std::logic_error("Read_ahead_file::write() - not supported");
+  }
+
+  bool flush() override {
+    throw std::logic_error("Read_ahead_file::flush() - not supported");
+  }
+
+  bool is_compressed() const override { return m_file->is_compressed(); }
+
+  bool is_local() const override { return m_file->is_local(); }
+
+  void rename(const std::string &) override {
+    throw std::logic_error("Read_ahead_file::rename() - not supported");
+  }
+
+  void remove() override {
+    throw std::logic_error("Read_ahead_file::remove() - not supported");
+  }
+
+  IFile *file() const { return m_file.get(); }
+
+  /**
+   * Provides the number of bytes read from the wrapped file (compressed bytes
+   * if the wrapped file is compressed) to produce the data returned by the
+   * most recent read().
+   */
+  size_t latest_io_size() const { return m_io_size; }
+
+ private:
+  struct Block {
+    std::string data;
+    // number of bytes read from the underlying storage
+    std::size_t io_size = 0;
+  };
+
+  void read_ahead();
+
+  std::size_t read_block(Block *block);
+
+  void close_impl();
+
+  bool next_block();
+
+  std::unique_ptr<IFile> m_file;
+  Compressed_file *m_compressed;
+  std::size_t m_block_size;
+  std::size_t m_max_blocks;
+  Read_ahead_threads *m_threads;
+
+  std::thread m_worker;
+  std::future<void> m_task_done;
+  bool m_running = false;
+
+  // guarded by m_mutex
+  std::deque<Block> m_blocks;
+  bool m_finished = false;
+  bool m_stop = false;
+  std::exception_ptr m_worker_exception;
+
+  std::mutex m_mutex;
+  // signaled when a block is added or the worker has finished
+  std::condition_variable m_block_ready;
+  // signaled when a block is consumed or the worker should stop
+  std::condition_variable m_space_ready;
+
+  // accessed only by the consumer
+  Block m_current;
+  std::size_t m_consumed = 0;
+  bool m_eof = false;
+  std::size_t m_io_size = 0;
+};
+
+}  // namespace storage
+}  // namespace mysqlshdk
+
+#endif  // MYSQLSHDK_LIBS_STORAGE_READ_AHEAD_FILE_H_
@@ -32,14 +32,19 @@
 #include <windows.h>
 #else  // !_WIN32
 #include <fcntl.h>
+#include <signal.h>
 #include <sys/time.h>
 #include <unistd.h>
 #endif  // !_WIN32
 
 #include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
 #include <filesystem>
 #include <ios>
 #include <map>
+#include <thread>
 #include <utility>
 
 #include <rapidjson/prettywriter.h>
@@ -123,6 +128,354 @@ std::string check_logfile_permissions(const std::string &filepath) {
 
 }  // namespace
 
+/**
+ * Writes log entries to the log file using a background thread.
+ *
+ * Entries are stored in a bounded multi-producer ring buffer (based on the
+ * Dmitry Vyukov's bounded MPMC queue), producers do not take any locks unless
+ * the buffer is full and Overflow_policy::BLOCK is used. The writer thread
+ * concatenates all available entries and writes them using a single call.
+ */
+class Logger::Async_writer final {
+ public:
+  Async_writer(Logger *owner, Overflow_policy policy, size_t capacity)
+      : m_owner(owner), m_policy(policy) {
+    size_t size = 2;
+
+    while (size < capacity) {
+      size <<= 1;
+    }
+
+    m_mask = size - 1;
+    m_slots = std::make_unique<Slot[]>(size);
+
+    for (size_t i = 0; i < size; ++i) {
+      m_slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    m_thread = std::thread(&Async_writer::writer_loop, this);
+
+    install_crash_handler();
+  }
+
+  Async_writer(const Async_writer &) = delete;
+  Async_writer(Async_writer &&) = delete;
+
+  Async_writer &operator=(const Async_writer &) = delete;
+  Async_writer &operator=(Async_writer &&) = delete;
+
+  ~Async_writer() { stop(); }
+
+  /**
+   * Writes out all pending entries and stops the writer thread. Entries pushed
+   * afterwards by the threads which still hold a reference to this writer are
+   * written by these threads.
+   */
+  void stop() {
+    {
+      std::lock_guard lock{m_mutex};
+
+      if (m_stop) return;
+
+      m_stop = true;
+    }
+
+    uninstall_crash_handler();
+
+    m_work_cv.notify_one();
+    m_thread.join();
+
+    m_stopped.store(true);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // entries pushed before the threads noticed that writer is stopped
+    write_pending();
+  }
+
+  void push(std::string entry) {
+    while (!try_push(&entry)) {
+      if (Overflow_policy::DROP == m_policy) {
+        ++m_dropped;
+        return;
+      }
+
+      if (m_stopped.load()) {
+        write_pending();
+        continue;
+      }
+
+      std::unique_lock lock{m_mutex};
+      m_work_cv.notify_one();
+      m_space_cv.wait_for(lock, std::chrono::milliseconds(10));
+    }
+
+    ++m_pushed;
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (m_stopped.load()) {
+      write_pending();
+    } else if (m_writer_idle.load(std::memory_order_acquire)) {
+      m_work_cv.notify_one();
+    }
+  }
+
+  void flush() {
+    const auto target = m_pushed.load();
+    std::unique_lock lock{m_mutex};
+
+    while (m_written.load() < target && !m_stop) {
+      m_work_cv.notify_one();
+      m_flushed_cv.wait_for(lock, std::chrono::milliseconds(10));
+    }
+  }
+
+  uint64_t dropped() const { return m_dropped; }
+
+ private:
+  struct Slot {
+    std::atomic<size_t> sequence;
+    std::string data;
+  };
+
+  bool try_push(std::string *entry) {
+    auto pos = m_enqueue_pos.load(std::memory_order_relaxed);
+    Slot *slot;
+
+    while (true) {
+      slot = &m_slots[pos & m_mask];
+      const auto seq = slot->sequence.load(std::memory_order_acquire);
+      const auto diff =
+          static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+      if (0 == diff) {
+        if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1,
+                                                std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        // buffer is full
+        return false;
+      } else {
+        pos = m_enqueue_pos.load(std::memory_order_relaxed);
+      }
+    }
+
+    slot->data = std::move(*entry);
+    slot->sequence.store(pos + 1, std::memory_order_release);
+
+    return true;
+  }
+
+  /**
+   * Claims the next entry, calls the callback and releases the slot.
+   */
+  template <typename C>
+  bool try_pop(C &&callback) {
+    auto pos = m_dequeue_pos.load(std::memory_order_relaxed);
+    Slot *slot;
+
+    while (true) {
+      slot = &m_slots[pos & m_mask];
+      const auto seq = slot->sequence.load(std::memory_order_acquire);
+      const auto diff =
+          static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+
+      if (0 == diff) {
+        if (m_dequeue_pos.compare_exchange_weak(pos, pos + 1,
+                                                std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        // buffer is empty
+        return false;
+      } else {
+        pos = m_dequeue_pos.load(std::memory_order_relaxed);
+      }
+    }
+
+    callback(&slot->data);
+    slot->sequence.store(pos + m_mask + 1, std::memory_order_release);
+
+    return true;
+  }
+
+  void writer_loop() {
+    static constexpr size_t k_batch_size = 64 * 1024;
+
+    std::string batch;
+    batch.reserve(k_batch_size);
+    uint64_t reported_dropped = 0;
+
+    while (true) {
+      uint64_t count = 0;
+
+      while (batch.size() < k_batch_size &&
+             try_pop([&batch](std::string *data) {
+               batch.append(*data);
+               data->clear();
+             })) {
+        ++count;
+      }
+
+      if (const auto dropped = m_dropped.load(); dropped != reported_dropped) {
+        Log_entry entry{"", "", LOG_WARNING};
+        const auto msg = std::to_string(dropped - reported_dropped) +
+                         " log entries were dropped, log buffer is full";
+        entry.message = msg;
+        batch.append(format_message(entry));
+        reported_dropped = dropped;
+      }
+
+      if (!batch.empty()) {
+        m_owner->write_to_file(batch.data(), batch.size());
+        batch.clear();
+
+        m_written += count;
+        m_space_cv.notify_all();
+        m_flushed_cv.notify_all();
+
+        continue;
+      }
+
+      std::unique_lock lock{m_mutex};
+
+      if (m_stop) {
+        // buffer is empty and no new entries are expected
+        break;
+      }
+
+      m_writer_idle.store(true, std::memory_order_release);
+      m_work_cv.wait_for(lock, std::chrono::milliseconds(50));
+      m_writer_idle.store(false, std::memory_order_release);
+    }
+
+    m_flushed_cv.notify_all();
+  }
+
+  /**
+   * Writes the pending entries using the calling thread, once the writer
+   * thread is stopped.
+   */
+  void write_pending() {
+    std::lock_guard lg{g_mutex};
+
+    std::string batch;
+    uint64_t count = 0;
+
+    while (try_pop([&batch](std::string *data) {
+      batch.append(*data);
+      data->clear();
+    })) {
+      ++count;
+    }
+
+    if (!batch.empty()) {
+      m_owner->write_to_file(batch.data(), batch.size());
+      m_written += count;
+    }
+  }
+
+#ifdef _WIN32
+  void install_crash_handler() {}
+
+  void uninstall_crash_handler() {}
+#else   // !_WIN32
+  static constexpr int k_crash_signals[] = {SIGSEGV, SIGBUS, SIGILL, SIGFPE,
+                                            SIGABRT};
+
+  void install_crash_handler() {
+    if (!m_owner->m_log_file) return;
+
+    Async_writer *expected = nullptr;
+
+    if (!s_crash_writer.compare_exchange_strong(expected, this)) {
+      // another logger already handles the crashes
+      return;
+    }
+
+    m_crash_fd = fileno(m_owner->m_log_file);
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = &Async_writer::on_crash;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESETHAND;
+
+    for (size_t i = 0; i < std::size(k_crash_signals); ++i) {
+      sigaction(k_crash_signals[i], &action, &m_previous_handlers[i]);
+    }
+  }
+
+  void uninstall_crash_handler() {
+    Async_writer *expected = this;
+
+    if (!s_crash_writer.compare_exchange_strong(expected, nullptr)) {
+      return;
+    }
+
+    for (size_t i = 0; i < std::size(k_crash_signals); ++i) {
+      sigaction(k_crash_signals[i], &m_previous_handlers[i], nullptr);
+    }
+  }
+
+  static void on_crash(int signo) {
+    if (const auto writer = s_crash_writer.exchange(nullptr)) {
+      // write out whatever is still in the buffer, using only the
+      // async-signal-safe functions, without releasing any memory
+      while (writer->try_pop([fd = writer->m_crash_fd](std::string *data) {
+        const auto ignore = ::write(fd, data->data(), data->size());
+        (void)ignore;
+      })) {
+      }
+
+      for (size_t i = 0; i < std::size(k_crash_signals); ++i) {
+        if (k_crash_signals[i] == signo) {
+          sigaction(signo, &writer->m_previous_handlers[i], nullptr);
+          break;
+        }
+      }
+    }
+
+    raise(signo);
+  }
+
+  static std::atomic<Async_writer *> s_crash_writer;
+
+  int m_crash_fd = -1;
+  struct sigaction m_previous_handlers[std::size(k_crash_signals)];
+#endif  // !_WIN32
+
+  // ~Logger() stops the writer thread, owner outlives it
+  Logger *m_owner;
+  const Overflow_policy m_policy;
+
+  std::unique_ptr<Slot[]> m_slots;
+  size_t m_mask = 0;
+
+  alignas(64) std::atomic<size_t> m_enqueue_pos{0};
+  alignas(64) std::atomic<size_t> m_dequeue_pos{0};
+
+  std::atomic<uint64_t> m_pushed{0};
+  std::atomic<uint64_t> m_written{0};
+  std::atomic<uint64_t> m_dropped{0};
+
+  std::atomic<bool> m_writer_idle{false};
+  bool m_stop = false;
+  std::atomic<bool> m_stopped{false};
+  std::mutex m_mutex;
+  std::condition_variable m_work_cv;
+  std::condition_variable m_space_cv;
+  std::condition_variable m_flushed_cv;
+
+  std::thread m_thread;
+};
+
+#ifndef _WIN32
+std::atomic<Logger::Async_writer *> Logger::Async_writer::s_crash_writer{
+    nullptr};
+#endif  // !_WIN32
+
 void Logger::attach_log_hook(Log_hook hook, void *user_data, bool catch_all) {
   if (hook) {
     std::lock_guard l{m_mutex_hooks};
@@ -231,22 +584,26 @@ void Logger::do_log(const Log_entry &entry) {
 
 void Logger::do_log(const std::shared_ptr<shcore::Logger> &logger,
                     const Log_entry &entry) {
+  if (const auto async = std::atomic_load(&logger->m_async)) {
+    if (entry.level <= logger->m_log_level) {
+      async->push(format_message(entry));
+    }
+
+    std::lock_guard lh{logger->m_mutex_hooks};
+
+    for (const auto &f : logger->m_hook_list) {
+      if (std::get<2>(f) || entry.level <= logger->m_log_level)
+        std::get<0>(f)(entry, std::get<1>(f));
+    }
+
+    return;
+  }
+
   std::lock_guard lg{g_mutex};
 
   if (entry.level <= logger->m_log_level) {
-#ifdef _WIN32
-    if (logger->m_log_file.is_open()) {
-      const auto s = format_message(entry);
-      logger->m_log_file.write(s.c_str(), s.length());
-      logger->m_log_file.flush();
-    }
-#else
-    if (logger->m_log_file) {
-      const auto s = format_message(entry);
-      fwrite(s.c_str(), s.length(), 1, logger->m_log_file);
-      fflush(logger->m_log_file);
-    }
-#endif
+    const auto s = format_message(entry);
+    logger->write_to_file(s.c_str(), s.length());
   }
 
   std::lock_guard lh{logger->m_mutex_hooks};
@@ -257,6 +614,63 @@ void Logger::do_log(const std::shared_ptr<shcore::Logger> &logger,
   }
 }
 
+void Logger::write_to_file(const char *data, size_t length) {
+#ifdef _WIN32
+  if (m_log_file.is_open()) {
+    m_log_file.write(data, length);
+    m_log_file.flush();
+  }
+#else
+  if (m_log_file) {
+    fwrite(data, length, 1, m_log_file);
+    fflush(m_log_file);
+  }
+#endif
+}
+
+void Logger::start_async(Overflow_policy policy, size_t capacity) {
+  std::lock_guard lg{g_mutex};
+
+  if (std::atomic_load(&m_async)) return;
+
+  std::atomic_store(&m_async,
+                    std::make_shared<Async_writer>(this, policy, capacity));
+}
+
+void Logger::stop_async() {
+  // synchronous writes wait until all pending entries are written out
+  std::lock_guard lg{g_mutex};
+
+  if (const auto async =
+          std::atomic_exchange(&m_async, std::shared_ptr<Async_writer>{})) {
+    async->stop();
+  }
+}
+
+void Logger::flush() {
+  if (const auto async = std::atomic_load(&m_async)) {
+    async->flush();
+  }
+}
+
+uint64_t Logger::dropped_entries() const {
+  if (const auto async = std::atomic_load(&m_async)) {
+    return async->dropped();
+  }
+
+  return 0;
+}
+
+Logger::Overflow_policy Logger::parse_overflow_policy(
+    const std::string &policy) {
+  if (str_caseeq(policy, "block")) return Overflow_policy::BLOCK;
+  if (str_caseeq(policy, "drop")) return Overflow_policy::DROP;
+
+  throw std::invalid_argument(
+      "The overflow policy of the asynchronous logger must be one of: block, "
+      "drop.");
+}
+
 bool Logger::will_log(LOG_LEVEL level) const {
   if (level <= m_log_level) return true;
 
@@ -431,6 +845,10 @@ Logger::Logger(const char *filename, bool use_stderr) : m_dont_log(0) {
 }
 
 Logger::~Logger() {
+  // write out all pending entries and stop the writer thread before the file
+  // is closed, even if some other thread still holds a reference to the writer
+  stop_async();
+
 #ifdef _WIN32
   if (m_log_file.is_open()) {
     m_log_file.close();
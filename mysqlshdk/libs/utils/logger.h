@@ -27,6 +27,7 @@
 #include <time.h>
 #include <atomic>
 #include <cstdarg>
+#include <cstdint>
 #include <fstream>
 #include <list>
 #include <memory>
@@ -77,6 +78,16 @@ class SHCORE_PUBLIC Logger final {
   using Log_hook = void (*)(const Log_entry &entry, void *);
   using Log_level_hook = void (*)(LOG_LEVEL level, void *);
 
+  /**
+   * What to do when the asynchronous log buffer is full.
+   */
+  enum class Overflow_policy {
+    BLOCK,  //< wait until the writer thread makes room
+    DROP,   //< discard the entry and increment the dropped entries counter
+  };
+
+  static constexpr size_t k_default_async_capacity = 8192;
+
   Logger(const Logger &) = delete;
   Logger(Logger &&) = delete;
 
@@ -101,6 +112,39 @@ class SHCORE_PUBLIC Logger final {
 
   void stop_log_to_stderr();
 
+  /**
+   * Switches writes to the log file to the asynchronous mode: entries are
+   * formatted by the calling thread, placed in a lock-free ring buffer and
+   * written in batches by a background thread. Hooks are still called
+   * synchronously.
+   *
+   * @param policy what to do when the buffer is full
+   * @param capacity number of entries in the buffer, rounded up to the power
+   *        of 2
+   */
+  void start_async(Overflow_policy policy = Overflow_policy::BLOCK,
+                   size_t capacity = k_default_async_capacity);
+
+  /**
+   * Writes all pending entries and switches back to the synchronous mode, the
+   * background thread is stopped before this method returns.
+   */
+  void stop_async();
+
+  bool is_async() const { return nullptr != std::atomic_load(&m_async); }
+
+  /**
+   * Blocks until all entries logged so far are written to the log file.
+   */
+  void flush();
+
+  /**
+   * Number of entries discarded due to Overflow_policy::DROP.
+   */
+  uint64_t dropped_entries() const;
+
+  static Overflow_policy parse_overflow_policy(const std::string &policy);
+
 #if __GNUC__ > 2 || (__GNUC__ == 2 && __GNUC_MINOR__ > 4)
   static void log(LOG_LEVEL level, const char *format, ...)
       __attribute__((__format__(__printf__, 2, 3)));
@@ -147,8 +191,12 @@ class SHCORE_PUBLIC Logger final {
   }
 
  private:
+  class Async_writer;
+
   Logger(const char *filename, bool use_stderr);
 
+  void write_to_file(const char *data, size_t length);
+
   static void out_to_stderr(const Log_entry &entry, void *);
 
   static std::string format_message(const Log_entry &entry);
@@ -172,6 +220,8 @@ class SHCORE_PUBLIC Logger final {
 #endif
   std::string m_log_file_name;
 
+  std::shared_ptr<Async_writer> m_async;
+
   mutable std::mutex m_mutex_hooks;
   std::list<std::tuple<Log_hook, void *, bool>> m_hook_list;
   std::list<std::tuple<Log_level_hook, void *>> m_level_hook_list;
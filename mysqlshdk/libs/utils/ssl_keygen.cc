@@ -288,32 +288,55 @@ std::string create_key_pair(const std::string &path,
 }
 
 std::vector<unsigned char> sha256(const char *data, size_t size) {
-  EVP_MD_CTX_ptr mctx(EVP_MD_CTX_new(), ::EVP_MD_CTX_free);
-  const EVP_MD *md = EVP_sha256();
-  int r = EVP_DigestInit_ex(mctx.get(), md, nullptr);
-  if (r != 1) {
-    throw std::runtime_error("SHA256: error initializing encoder.");
+  Sha256 hash;
+  hash.update(data, size);
+  return hash.finish();
+}
+
+struct Sha256::Impl {
+  Impl() : ctx(EVP_MD_CTX_new(), ::EVP_MD_CTX_free) { init(); }
+
+  void init() {
+    if (1 != EVP_DigestInit_ex(ctx.get(), EVP_sha256(), nullptr)) {
+      throw std::runtime_error("SHA256: error initializing encoder.");
+    }
   }
 
-  r = EVP_DigestUpdate(mctx.get(), data, size);
-  if (r != 1) {
+  EVP_MD_CTX_ptr ctx;
+};
+
+Sha256::Sha256() : m_impl(std::make_unique<Impl>()) {}
+
+Sha256::Sha256(Sha256 &&) = default;
+
+Sha256 &Sha256::operator=(Sha256 &&) = default;
+
+Sha256::~Sha256() = default;
+
+void Sha256::update(const char *data, size_t size) {
+  if (1 != EVP_DigestUpdate(m_impl->ctx.get(), data, size)) {
     throw std::runtime_error("SHA256: error while encoding data.");
   }
+}
 
+std::vector<unsigned char> Sha256::finish() {
   std::vector<unsigned char> md_value;
   unsigned int md_len = EVP_MAX_MD_SIZE;
   md_value.resize(md_len);
 
-  r = EVP_DigestFinal_ex(mctx.get(), md_value.data(), &md_len);
-  if (r != 1) {
+  if (1 != EVP_DigestFinal_ex(m_impl->ctx.get(), md_value.data(), &md_len)) {
     throw std::runtime_error("SHA256: error completing encode operation.");
   }
 
   md_value.resize(md_len);
 
+  m_impl->init();
+
   return md_value;
 }
 
+void Sha256::reset() { m_impl->init(); }
+
 namespace restricted {
 
 std::vector<unsigned char> md5(const char *data, size_t size) {
@@ -24,6 +24,7 @@
 #ifndef MYSQLSHDK_LIBS_UTILS_SSL_KEYGEN_H_
 #define MYSQLSHDK_LIBS_UTILS_SSL_KEYGEN_H_
 
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -102,6 +103,43 @@ std::string private_key_fingerprint(const std::string &path);
  */
 std::vector<unsigned char> sha256(const char *data, size_t size);
 
+/**
+ * Computes SHA256 hash of the data which is provided incrementally.
+ */
+class Sha256 final {
+ public:
+  Sha256();
+
+  Sha256(const Sha256 &) = delete;
+  Sha256(Sha256 &&);
+
+  Sha256 &operator=(const Sha256 &) = delete;
+  Sha256 &operator=(Sha256 &&);
+
+  ~Sha256();
+
+  /**
+   * Adds more data to the hash.
+   */
+  void update(const char *data, size_t size);
+
+  /**
+   * Computes the hash of all the data provided so far, and restarts the
+   * computation.
+   */
+  std::vector<unsigned char> finish();
+
+  /**
+   * Discards all the data provided so far.
+   */
+  void reset();
+
+ private:
+  struct Impl;
+
+  std::unique_ptr<Impl> m_impl;
+};
+
 std::vector<unsigned char> hmac_sha256(const std::vector<unsigned char> &key,
                                        const std::string &data);
 
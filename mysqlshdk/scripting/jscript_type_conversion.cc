@@ -234,13 +234,13 @@ Value JScript_type_bridger::v8_value_to_shcore_value(
       const auto lcontext = owner->context();
       v8::Local<v8::Array> pnames(
           jsobject->GetPropertyNames(lcontext).ToLocalChecked());
-      std::shared_ptr<Value::Map_type> map_ptr(new Value::Map_type);
+      Value::Map_type::Builder map(pnames->Length());
       for (int32_t c = pnames->Length(), i = 0; i < c; i++) {
         v8::Local<v8::Value> k(pnames->Get(lcontext, i).ToLocalChecked());
         v8::Local<v8::Value> v(jsobject->Get(lcontext, k).ToLocalChecked());
-        (*map_ptr)[owner->to_string(k)] = v8_value_to_shcore_value(v);
+        map.emplace(owner->to_string(k), v8_value_to_shcore_value(v));
       }
-      return Value(map_ptr);
+      return Value(map.build());
     }
   } else if (value->IsSymbol()) {
     return Value(owner->to_string(value));
@@ -265,7 +265,7 @@ v8::Local<v8::Value> JScript_type_bridger::shcore_value_to_v8_value(
       r = v8::Boolean::New(owner->isolate(), value.value.b);
       break;
     case String:
-      r = owner->v8_string(*value.value.s);
+      r = owner->v8_string(value.value.s);
       break;
     case Integer:
       r = v8::Number::New(owner->isolate(), value.value.i);
@@ -277,19 +277,19 @@ v8::Local<v8::Value> JScript_type_bridger::shcore_value_to_v8_value(
       r = v8::Number::New(owner->isolate(), value.value.d);
       break;
     case Object:
-      r = native_object_to_js(*value.value.o);
+      r = native_object_to_js(value.value.o);
       break;
     case Array:
       // maybe convert fully
-      r = array_wrapper->wrap(*value.value.array);
+      r = array_wrapper->wrap(value.value.array);
       break;
     case Map:
       // maybe convert fully
-      // r = native_map_to_js(*value.value.map);
-      r = map_wrapper->wrap(*value.value.map);
+      // r = native_map_to_js(value.value.map);
+      r = map_wrapper->wrap(value.value.map);
       break;
     case MapRef: {
-      std::shared_ptr<Value::Map_type> map(value.value.mapref->lock());
+      std::shared_ptr<Value::Map_type> map(value.value.mapref.lock());
       if (map) {
         throw std::invalid_argument(
             "Cannot convert internal value to JS: wrapmapref not "
@@ -297,10 +297,10 @@ v8::Local<v8::Value> JScript_type_bridger::shcore_value_to_v8_value(
       }
     } break;
     case shcore::Function:
-      r = function_wrapper->wrap(*value.value.func);
+      r = function_wrapper->wrap(value.value.func);
       break;
     case shcore::Binary:
-      r = owner->v8_array_buffer(*value.value.s);
+      r = owner->v8_array_buffer(value.value.s);
       break;
   }
   return r;
@@ -51,7 +51,7 @@ void Object_registry::add_to_reg_list(
   else if (liter->second.type != Array)
     throw std::invalid_argument("Registry " + list_name + " is not a list");
 
-  (*liter->second.value.array)->push_back(Value(object));
+  liter->second.value.array->push_back(Value(object));
 }
 
 void Object_registry::add_to_reg_list(const std::string &list_name,
@@ -64,7 +64,7 @@ void Object_registry::add_to_reg_list(const std::string &list_name,
   else if (liter->second.type != Array)
     throw std::invalid_argument("Registry " + list_name + " is not a list");
 
-  (*liter->second.value.array)->push_back(value);
+  liter->second.value.array->push_back(value);
 }
 
 void Object_registry::remove_from_reg_list(
@@ -76,8 +76,8 @@ void Object_registry::remove_from_reg_list(
 
   Value &list(liter->second);
   Value::Array_type::iterator iter = std::find(
-      (*list.value.array)->begin(), (*list.value.array)->end(), Value(object));
-  if (iter != (*list.value.array)->end()) (*list.value.array)->erase(iter);
+      list.value.array->begin(), list.value.array->end(), Value(object));
+  if (iter != list.value.array->end()) list.value.array->erase(iter);
 }
 
 void Object_registry::remove_from_reg_list(
@@ -86,7 +86,7 @@ void Object_registry::remove_from_reg_list(
   if (liter != _registry->end() || liter->second.type != Array)
     throw std::invalid_argument("Registry " + list_name + " is not a list");
 
-  (*liter->second.value.array)->erase(iterator);
+  liter->second.value.array->erase(iterator);
 }
 
 std::shared_ptr<Value::Array_type> &Object_registry::get_reg_list(
@@ -95,5 +95,5 @@ std::shared_ptr<Value::Array_type> &Object_registry::get_reg_list(
   if (liter != _registry->end() || liter->second.type != Array)
     throw std::invalid_argument("Registry " + list_name + " is not a list");
 
-  return *liter->second.value.array;
+  return liter->second.value.array;
 }
@@ -2002,7 +2002,7 @@ PyObject *richcompare(dict::Object *self, PyObject *right, int op) {
     return result(false);
   } else {
     static_assert(
-        std::is_same_v<std::map<std::string, Value>,
+        std::is_same_v<std::map<std::string, Value, std::less<>>,
                        std::remove_pointer_t<decltype(l)>::container_type>,
         "This algorithm assumes that items in the map are ordered");
 
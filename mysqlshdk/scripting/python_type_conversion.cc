@@ -145,7 +145,7 @@ Value convert(PyObject *py, Python_context **context, bool is_binary) {
   }
 
   if (PyDict_Check(py)) {
-    auto map = std::make_shared<Value::Map_type>();
+    Value::Map_type::Builder map(PyDict_Size(py));
 
     PyObject *key = nullptr, *value = nullptr;
     Py_ssize_t pos = 0;
@@ -156,10 +156,10 @@ Value convert(PyObject *py, Python_context **context, bool is_binary) {
       // The key may be anything (not necessarily a string) so we get the string
       // representation of whatever it is.
       Python_context::pystring_to_string(key, &key_string, true);
-      (*map)[key_string] = convert(value, context);
+      map.emplace(std::move(key_string), convert(value, context));
     }
 
-    return Value(map);
+    return Value(map.build());
   }
 
   if (PyFunction_Check(py)) {
@@ -254,8 +254,7 @@ py::Release convert(const Value &value, Python_context * /*context*/) {
     case Bool:
       return py::Release{PyBool_FromLong(value.value.b)};
     case String:
-      assert(value.value.s);
-      return py::Release{PyString_FromString(value.value.s->c_str())};
+      return py::Release{PyString_FromString(value.value.s.c_str())};
     case Integer:
       return py::Release{PyLong_FromLongLong(value.value.i)};
       break;
@@ -270,7 +269,7 @@ py::Release convert(const Value &value, Python_context * /*context*/) {
         return py::Release{object->object()};
 
       if (value.as_object()->class_name() != "Date")
-        return wrap(*value.value.o);
+        return wrap(value.value.o);
 
       std::shared_ptr<Date> date = value.as_object<Date>();
 
@@ -311,13 +310,13 @@ py::Release convert(const Value &value, Python_context * /*context*/) {
       return py::Release{PyString_FromString(value.descr().c_str())};
     }
     case Array:
-      return wrap(*value.value.array);
+      return wrap(value.value.array);
     case Map:
-      return wrap(*value.value.map);
+      return wrap(value.value.map);
     case MapRef:
       /*
       {
-      std::shared_ptr<Value::Map_type> map(value.value.mapref->lock());
+      std::shared_ptr<Value::Map_type> map(value.value.mapref.lock());
       if (map)
       {
       std::cout << "wrapmapref not implemented\n";
@@ -326,11 +325,10 @@ py::Release convert(const Value &value, Python_context * /*context*/) {
       */
       return py::Release::incref(Py_None);
     case shcore::Function:
-      return wrap(*value.value.func);
+      return wrap(value.value.func);
     case shcore::Binary:
-      assert(value.value.s);
-      return py::Release{PyBytes_FromStringAndSize(value.value.s->c_str(),
-                                                   value.value.s->size())};
+      return py::Release{PyBytes_FromStringAndSize(value.value.s.c_str(),
+                                                   value.value.s.size())};
   }
 
   return {};
@@ -31,6 +31,7 @@
 #include <iostream>
 #include <limits>
 #include <locale>
+#include <new>
 #include <sstream>
 #include <stdexcept>
 #include "mysqlshdk/libs/utils/dtoa.h"
@@ -226,7 +227,7 @@ void Exception::set_file_context(const std::string &file, size_t line) {
 
 const char *Exception::type() const noexcept {
   if ((*_error)["type"].type == String)
-    return (*_error)["type"].value.s->c_str();
+    return (*_error)["type"].value.s.c_str();
   return "Exception";
 }
 
@@ -354,6 +355,31 @@ std::string type_description(Value_type type) {
 
 // --
 
+std::shared_ptr<Value::Map_type> Value::Map_type::Builder::build() {
+  // stable sort keeps the items with the same key in the order they were added
+  std::stable_sort(
+      m_items.begin(), m_items.end(),
+      [](const auto &l, const auto &r) { return l.first < r.first; });
+
+  auto map = std::make_shared<Map_type>();
+  auto &items = map->_map;
+
+  for (auto &item : m_items) {
+    if (!items.empty() && items.rbegin()->first == item.first) {
+      // last value of a repeated key is used
+      items.rbegin()->second = std::move(item.second);
+    } else {
+      // items are sorted, hint makes each insertion constant time
+      items.emplace_hint(items.end(), std::move(item.first),
+                         std::move(item.second));
+    }
+  }
+
+  m_items.clear();
+
+  return map;
+}
+
 Value_type Value::Map_type::get_type(const std::string &k) const {
   const_iterator iter = find(k);
   if (iter == end()) return Undefined;
@@ -427,17 +453,17 @@ void Value::Map_type::merge_contents(std::shared_ptr<Map_type> source,
 
 Value::Value(const std::string &s, bool binary)
     : type(binary ? Binary : String) {
-  value.s = new std::string(s);
+  new (&value.s) std::string(s);
 }
 
 Value::Value(std::string &&s, bool binary) : type(binary ? Binary : String) {
-  value.s = new std::string(std::move(s));
+  new (&value.s) std::string(std::move(s));
 }
 
 Value::Value(const char *s) {
   if (s) {
     type = String;
-    value.s = new std::string(s);
+    new (&value.s) std::string(s);
   } else {
     type = shcore::Null;
   }
@@ -446,14 +472,14 @@ Value::Value(const char *s) {
 Value::Value(const char *s, size_t n, bool binary) {
   if (s) {
     type = binary ? Binary : String;
-    value.s = new std::string(s, n);
+    new (&value.s) std::string(s, n);
   } else {
     type = shcore::Null;
   }
 }
 
 Value::Value(std::string_view s, bool binary) : type(binary ? Binary : String) {
-  value.s = new std::string(s);
+  new (&value.s) std::string(s);
 }
 
 Value::Value(std::wstring_view s)
@@ -482,7 +508,7 @@ Value::Value(bool b) : type(Bool) { value.b = b; }
 
 Value::Value(const std::shared_ptr<Function_base> &f) : type(Function) {
   if (f) {
-    value.func = new std::shared_ptr<Function_base>(f);
+    new (&value.func) std::shared_ptr<Function_base>(f);
   } else {
     type = shcore::Null;
   }
@@ -490,7 +516,7 @@ Value::Value(const std::shared_ptr<Function_base> &f) : type(Function) {
 
 Value::Value(std::shared_ptr<Function_base> &&f) : type(Function) {
   if (f) {
-    value.func = new std::shared_ptr<Function_base>(std::move(f));
+    new (&value.func) std::shared_ptr<Function_base>(std::move(f));
   } else {
     type = shcore::Null;
   }
@@ -498,7 +524,7 @@ Value::Value(std::shared_ptr<Function_base> &&f) : type(Function) {
 
 Value::Value(const std::shared_ptr<Object_bridge> &n) : type(Object) {
   if (n) {
-    value.o = new std::shared_ptr<Object_bridge>(n);
+    new (&value.o) std::shared_ptr<Object_bridge>(n);
   } else {
     type = shcore::Null;
   }
@@ -506,7 +532,7 @@ Value::Value(const std::shared_ptr<Object_bridge> &n) : type(Object) {
 
 Value::Value(std::shared_ptr<Object_bridge> &&n) : type(Object) {
   if (n) {
-    value.o = new std::shared_ptr<Object_bridge>(std::move(n));
+    new (&value.o) std::shared_ptr<Object_bridge>(std::move(n));
   } else {
     type = shcore::Null;
   }
@@ -514,7 +540,7 @@ Value::Value(std::shared_ptr<Object_bridge> &&n) : type(Object) {
 
 Value::Value(const Map_type_ref &n) : type(Map) {
   if (n) {
-    value.map = new std::shared_ptr<Map_type>(n);
+    new (&value.map) std::shared_ptr<Map_type>(n);
   } else {
     type = shcore::Null;
   }
@@ -522,23 +548,23 @@ Value::Value(const Map_type_ref &n) : type(Map) {
 
 Value::Value(Map_type_ref &&n) : type(Map) {
   if (n) {
-    value.map = new std::shared_ptr<Map_type>(std::move(n));
+    new (&value.map) std::shared_ptr<Map_type>(std::move(n));
   } else {
     type = shcore::Null;
   }
 }
 
 Value::Value(const std::weak_ptr<Map_type> &n) : type(MapRef) {
-  value.mapref = new std::weak_ptr<Map_type>(n);
+  new (&value.mapref) std::weak_ptr<Map_type>(n);
 }
 
 Value::Value(std::weak_ptr<Map_type> &&n) : type(MapRef) {
-  value.mapref = new std::weak_ptr<Map_type>(std::move(n));
+  new (&value.mapref) std::weak_ptr<Map_type>(std::move(n));
 }
 
 Value::Value(const Array_type_ref &n) : type(Array) {
   if (n) {
-    value.array = new std::shared_ptr<Array_type>(n);
+    new (&value.array) std::shared_ptr<Array_type>(n);
   } else {
     type = shcore::Null;
   }
@@ -546,7 +572,7 @@ Value::Value(const Array_type_ref &n) : type(Array) {
 
 Value::Value(Array_type_ref &&n) : type(Array) {
   if (n) {
-    value.array = new std::shared_ptr<Array_type>(std::move(n));
+    new (&value.array) std::shared_ptr<Array_type>(std::move(n));
   } else {
     type = shcore::Null;
   }
@@ -575,53 +601,26 @@ Value &Value::operator=(const Value &other) {
         break;
       case Binary:
       case String:
-        *value.s = *other.value.s;
+        value.s = other.value.s;
         break;
       case Object:
-        *value.o = *other.value.o;
+        value.o = other.value.o;
         break;
       case Array:
-        *value.array = *other.value.array;
+        value.array = other.value.array;
         break;
       case Map:
-        *value.map = *other.value.map;
+        value.map = other.value.map;
         break;
       case MapRef:
-        *value.mapref = *other.value.mapref;
+        value.mapref = other.value.mapref;
         break;
       case Function:
-        *value.func = *other.value.func;
+        value.func = other.value.func;
         break;
     }
   } else {
-    switch (type) {
-      case Undefined:
-      case shcore::Null:
-      case Bool:
-      case Integer:
-      case UInteger:
-      case Float:
-        break;
-      case Binary:
-      case String:
-        delete value.s;
-        break;
-      case Object:
-        delete value.o;
-        break;
-      case Array:
-        delete value.array;
-        break;
-      case Map:
-        delete value.map;
-        break;
-      case MapRef:
-        delete value.mapref;
-        break;
-      case Function:
-        delete value.func;
-        break;
-    }
+    destroy();
     type = other.type;
     switch (type) {
       case Undefined:
@@ -641,22 +640,22 @@ Value &Value::operator=(const Value &other) {
         break;
       case Binary:
       case String:
-        value.s = new std::string(*other.value.s);
+        new (&value.s) std::string(other.value.s);
         break;
       case Object:
-        value.o = new std::shared_ptr<Object_bridge>(*other.value.o);
+        new (&value.o) std::shared_ptr<Object_bridge>(other.value.o);
         break;
       case Array:
-        value.array = new std::shared_ptr<Array_type>(*other.value.array);
+        new (&value.array) std::shared_ptr<Array_type>(other.value.array);
         break;
       case Map:
-        value.map = new std::shared_ptr<Map_type>(*other.value.map);
+        new (&value.map) std::shared_ptr<Map_type>(other.value.map);
         break;
       case MapRef:
-        value.mapref = new std::weak_ptr<Map_type>(*other.value.mapref);
+        new (&value.mapref) std::weak_ptr<Map_type>(other.value.mapref);
         break;
       case Function:
-        value.func = new std::shared_ptr<Function_base>(*other.value.func);
+        new (&value.func) std::shared_ptr<Function_base>(other.value.func);
         break;
     }
   }
@@ -666,85 +665,88 @@ Value &Value::operator=(const Value &other) {
 Value &Value::operator=(Value &&other) noexcept {
   if (this == &other) return *this;
 
+  destroy();
+  type = other.type;
+
   switch (type) {
     case Undefined:
     case shcore::Null:
+      break;
     case Bool:
+      value.b = other.value.b;
+      break;
     case Integer:
+      value.i = other.value.i;
+      break;
     case UInteger:
+      value.ui = other.value.ui;
+      break;
     case Float:
+      value.d = other.value.d;
       break;
     case Binary:
     case String:
-      delete value.s;
-      value.s = nullptr;
+      new (&value.s) std::string(std::move(other.value.s));
       break;
     case Object:
-      delete value.o;
-      value.s = nullptr;
+      new (&value.o) std::shared_ptr<Object_bridge>(std::move(other.value.o));
       break;
     case Array:
-      delete value.array;
-      value.s = nullptr;
+      new (&value.array)
+          std::shared_ptr<Array_type>(std::move(other.value.array));
       break;
     case Map:
-      delete value.map;
-      value.s = nullptr;
+      new (&value.map) std::shared_ptr<Map_type>(std::move(other.value.map));
       break;
     case MapRef:
-      delete value.mapref;
-      value.s = nullptr;
+      new (&value.mapref)
+          std::weak_ptr<Map_type>(std::move(other.value.mapref));
       break;
     case Function:
-      delete value.func;
-      value.s = nullptr;
+      new (&value.func)
+          std::shared_ptr<Function_base>(std::move(other.value.func));
       break;
   }
 
-  type = Undefined;
-  std::swap(type, other.type);
+  other.destroy();
+  return *this;
+}
 
+void Value::destroy() noexcept {
   switch (type) {
     case Undefined:
     case shcore::Null:
-      break;
     case Bool:
-      std::swap(value.b, other.value.b);
-      break;
     case Integer:
-      std::swap(value.i, other.value.i);
-      break;
     case UInteger:
-      std::swap(value.ui, other.value.ui);
-      break;
     case Float:
-      std::swap(value.d, other.value.d);
       break;
     case Binary:
     case String:
-      std::swap(value.s, other.value.s);
+      value.s.~basic_string();
       break;
     case Object:
-      std::swap(value.o, other.value.o);
+      value.o.~shared_ptr();
       break;
     case Array:
-      std::swap(value.array, other.value.array);
+      value.array.~shared_ptr();
       break;
     case Map:
-      std::swap(value.map, other.value.map);
+      value.map.~shared_ptr();
       break;
     case MapRef:
-      std::swap(value.mapref, other.value.mapref);
+      value.mapref.~weak_ptr();
       break;
     case Function:
-      std::swap(value.func, other.value.func);
+      value.func.~shared_ptr();
       break;
   }
-  return *this;
+
+  type = Undefined;
 }
 
 Value Value::parse_map(const char **pc) {
-  Map_type_ref map(new Map_type());
+  Map_type::Builder map;
 
   // Skips the opening {
   ++*pc;
@@ -778,7 +780,7 @@ Value Value::parse_map(const char **pc) {
 
       value = parse(pc);
 
-      (*map)[key.get_string()] = value;
+      map.emplace(key.get_string(), std::move(value));
 
       skip_whitespace(pc);
 
@@ -797,7 +799,7 @@ Value Value::parse_map(const char **pc) {
     }
   }
 
-  return Value(map);
+  return Value(map.build());
 }
 
 Value Value::parse_array(const char **pc) {
@@ -1149,17 +1151,17 @@ bool Value::operator==(const Value &other) const {
         return value.d == other.value.d;
       case Binary:
       case String:
-        return *value.s == *other.value.s;
+        return value.s == other.value.s;
       case Object:
-        return **value.o == **other.value.o;
+        return *value.o == *other.value.o;
       case Array:
-        return **value.array == **other.value.array;
+        return *value.array == *other.value.array;
       case Map:
-        return **value.map == **other.value.map;
+        return *value.map == *other.value.map;
       case MapRef:
-        return *value.mapref->lock() == *other.value.mapref->lock();
+        return *value.mapref.lock() == *other.value.mapref.lock();
       case Function:
-        return **value.func == **other.value.func;
+        return *value.func == *other.value.func;
     }
   } else {
     // with type conversion
@@ -1245,15 +1247,15 @@ bool Value::operator<(const Value &other) const {
         return value.d < other.value.d;
       case Binary:
       case String:
-        return *value.s < *other.value.s;
+        return value.s < other.value.s;
       case Object:
-        return **value.o < **other.value.o;
+        return *value.o < *other.value.o;
       case Array:
-        return **value.array < **other.value.array;
+        return *value.array < *other.value.array;
       case Map:
-        return **value.map < **other.value.map;
+        return *value.map < *other.value.map;
       case MapRef:
-        return *value.mapref->lock() < *other.value.mapref->lock();
+        return *value.mapref.lock() < *other.value.mapref.lock();
       case Function:
         // NOTE: not implemented, it's not possible to order functions
         return false;
@@ -1344,18 +1346,18 @@ bool Value::operator<=(const Value &other) const {
         return value.d <= other.value.d;
       case Binary:
       case String:
-        return *value.s <= *other.value.s;
+        return value.s <= other.value.s;
       case Object:
-        return **value.o <= **other.value.o;
+        return *value.o <= *other.value.o;
       case Array:
-        return **value.array <= **other.value.array;
+        return *value.array <= *other.value.array;
       case Map:
-        return **value.map <= **other.value.map;
+        return *value.map <= *other.value.map;
       case MapRef:
-        return *value.mapref->lock() <= *other.value.mapref->lock();
+        return *value.mapref.lock() <= *other.value.mapref.lock();
       case Function:
         // NOTE: not implemented, it's not possible to order functions
-        return **value.func == **other.value.func;
+        return *value.func == *other.value.func;
     }
   } else {
     // with type conversion
@@ -1474,20 +1476,20 @@ std::string &Value::append_descr(std::string &s_out, int indent,
       break;
     case String:
       if (quote_strings) {
-        s_out += quote_string(*value.s, quote_strings);
+        s_out += quote_string(value.s, quote_strings);
       } else {
-        s_out += *value.s;
+        s_out += value.s;
       }
       break;
     case Object:
-      if (!value.o || !*value.o)
+      if (!value.o)
         throw Exception::value_error("Invalid object value encountered");
       as_object()->append_descr(s_out, indent, quote_strings);
       break;
     case Array: {
-      if (!value.array || !*value.array)
+      if (!value.array)
         throw Exception::value_error("Invalid array value encountered");
-      Array_type *vec = value.array->get();
+      Array_type *vec = value.array.get();
       Array_type::iterator myend = vec->end(), mybegin = vec->begin();
       s_out += "[";
       for (Array_type::iterator iter = mybegin; iter != myend; ++iter) {
@@ -1505,9 +1507,9 @@ std::string &Value::append_descr(std::string &s_out, int indent,
       s_out += "]";
     } break;
     case Map: {
-      if (!value.map || !*value.map)
+      if (!value.map)
         throw Exception::value_error("Invalid map value encountered");
-      Map_type *map = value.map->get();
+      Map_type *map = value.map.get();
       Map_type::iterator myend = map->end(), mybegin = map->begin();
       s_out += "{";
 
@@ -1531,10 +1533,10 @@ std::string &Value::append_descr(std::string &s_out, int indent,
       s_out.append("mapref");
       break;
     case Function:
-      value.func->get()->append_descr(&s_out, indent, quote_strings);
+      value.func->append_descr(&s_out, indent, quote_strings);
       break;
     case Binary:
-      s_out += shcore::string_to_hex(*value.s);
+      s_out += shcore::string_to_hex(value.s);
       break;
   }
   return s_out;
@@ -1568,7 +1570,7 @@ std::string &Value::append_repr(std::string &s_out) const {
       s_out += str_format("%g", value.d);
     } break;
     case String: {
-      std::string &s = *value.s;
+      const std::string &s = value.s;
       s_out += "\"";
       for (size_t i = 0; i < s.length(); i++) {
         unsigned char c = s[i];
@@ -1619,10 +1621,10 @@ std::string &Value::append_repr(std::string &s_out) const {
       s_out += "\"";
     } break;
     case Object:
-      s_out = (*value.o)->append_repr(s_out);
+      s_out = value.o->append_repr(s_out);
       break;
     case Array: {
-      Array_type *vec = value.array->get();
+      Array_type *vec = value.array.get();
       Array_type::iterator myend = vec->end(), mybegin = vec->begin();
       s_out += "[";
       for (Array_type::iterator iter = mybegin; iter != myend; ++iter) {
@@ -1632,7 +1634,7 @@ std::string &Value::append_repr(std::string &s_out) const {
       s_out += "]";
     } break;
     case Map: {
-      Map_type *map = value.map->get();
+      Map_type *map = value.map.get();
       Map_type::iterator myend = map->end(), mybegin = map->begin();
       s_out += "{";
       for (Map_type::iterator iter = mybegin; iter != myend; ++iter) {
@@ -1647,45 +1649,16 @@ std::string &Value::append_repr(std::string &s_out) const {
     case MapRef:
       break;
     case Function:
-      value.func->get()->append_repr(&s_out);
+      value.func->append_repr(&s_out);
       break;
     case Binary:
-      s_out += shcore::string_to_hex(*value.s);
+      s_out += shcore::string_to_hex(value.s);
       break;
   }
   return s_out;
 }
 
-Value::~Value() noexcept {
-  switch (type) {
-    case Undefined:
-    case shcore::Null:
-    case Bool:
-    case Integer:
-    case UInteger:
-    case Float:
-      break;
-    case Binary:
-    case String:
-      delete value.s;
-      break;
-    case Object:
-      delete value.o;
-      break;
-    case Array:
-      delete value.array;
-      break;
-    case Map:
-      delete value.map;
-      break;
-    case MapRef:
-      delete value.mapref;
-      break;
-    case Function:
-      delete value.func;
-      break;
-  }
-}
+Value::~Value() noexcept { destroy(); }
 
 inline Exception type_conversion_error(Value_type from, Value_type expected) {
   return Exception::type_error("Invalid typecast: " + type_name(expected) +
@@ -1718,7 +1691,7 @@ bool Value::as_bool() const {
       return value.d != 0.0;
     case String:
       try {
-        return lexical_cast<bool>(*value.s);
+        return lexical_cast<bool>(value.s);
       } catch (...) {
       }
       break;
@@ -1747,7 +1720,7 @@ int64_t Value::as_int() const {
       return value.b ? 1 : 0;
     case String:
       try {
-        return lexical_cast<int64_t>(*value.s);
+        return lexical_cast<int64_t>(value.s);
       } catch (...) {
       }
       break;
@@ -1775,7 +1748,7 @@ uint64_t Value::as_uint() const {
       return value.b ? 1 : 0;
     case String:
       try {
-        return lexical_cast<uint64_t>(*value.s);
+        return lexical_cast<uint64_t>(value.s);
       } catch (...) {
       }
       break;
@@ -1805,7 +1778,7 @@ double Value::as_double() const {
       return value.b ? 1.0 : 0.0;
     case String:
       try {
-        return lexical_cast<double>(*value.s);
+        return lexical_cast<double>(value.s);
       } catch (...) {
       }
       break;
@@ -1826,7 +1799,7 @@ std::string Value::as_string() const {
     case Bool:
       return lexical_cast<std::string>(value.b);
     case String:
-      return *value.s;
+      return value.s;
     default:
       break;
   }
@@ -2002,13 +1975,13 @@ std::string Value::yaml(int init_indent) const {
       return string2yaml(descr(), init_indent);
 
     case Value_type::String:
-      return string2yaml(*value.s, init_indent);
+      return string2yaml(value.s, init_indent);
 
     case Value_type::Array: {
       std::string array;
       bool first_item = true;
 
-      for (const auto &v : **value.array) {
+      for (const auto &v : *value.array) {
         if (first_item) {
           first_item = false;
         } else {
@@ -2027,13 +2000,13 @@ std::string Value::yaml(int init_indent) const {
     }
 
     case Value_type::Map:
-      return map2yaml(*value.map, init_indent);
+      return map2yaml(value.map, init_indent);
 
     case Value_type::MapRef:
-      return map2yaml(value.mapref->lock(), init_indent);
+      return map2yaml(value.mapref.lock(), init_indent);
     case Value_type::Binary:
       // TODO(rennox): implement binary
-      return string2yaml(*value.s, init_indent);
+      return string2yaml(value.s, init_indent);
   }
 
   throw std::logic_error("Type '" + type_name(type) + "' was not handled.");
@@ -2046,7 +2019,7 @@ const std::string &Argument_list::string_at(unsigned int i) const {
     throw Exception::argument_error("Insufficient number of arguments");
   switch (at(i).type) {
     case String:
-      return *at(i).value.s;
+      return at(i).value.s;
     default:
       throw Exception::type_error(
           str_format("Argument #%u is expected to be a string", (i + 1)));
@@ -2104,7 +2077,7 @@ std::shared_ptr<Object_bridge> Argument_list::object_at(unsigned int i) const {
   if (at(i).type != Object)
     throw Exception::type_error(
         str_format("Argument #%u is expected to be an object", (i + 1)));
-  return *at(i).value.o;
+  return at(i).value.o;
 }
 
 std::shared_ptr<Value::Map_type> Argument_list::map_at(unsigned int i) const {
@@ -2113,7 +2086,7 @@ std::shared_ptr<Value::Map_type> Argument_list::map_at(unsigned int i) const {
   if (at(i).type != Map)
     throw Exception::type_error(
         str_format("Argument #%u is expected to be a map", (i + 1)));
-  return *at(i).value.map;
+  return at(i).value.map;
 }
 
 std::shared_ptr<Value::Array_type> Argument_list::array_at(
@@ -2123,7 +2096,7 @@ std::shared_ptr<Value::Array_type> Argument_list::array_at(
   if (at(i).type != Array)
     throw Exception::type_error(
         str_format("Argument #%u is expected to be an array", (i + 1)));
-  return *at(i).value.array;
+  return at(i).value.array;
 }
 
 void Argument_list::ensure_count(unsigned int c, const char *context) const {
@@ -2163,7 +2136,7 @@ const std::string &Argument_map::string_at(const std::string &key) const {
   const Value &v(at(key));
   switch (v.type) {
     case String:
-      return *v.value.s;
+      return v.value.s;
     default:
       throw Exception::type_error(std::string("Argument ")
                                       .append(key)
@@ -2213,7 +2186,7 @@ std::shared_ptr<Object_bridge> Argument_map::object_at(
   if (value.type != Object)
     throw Exception::type_error("Argument '" + key +
                                 "' is expected to be an object");
-  return *value.value.o;
+  return value.value.o;
 }
 
 std::shared_ptr<Value::Map_type> Argument_map::map_at(
@@ -2222,7 +2195,7 @@ std::shared_ptr<Value::Map_type> Argument_map::map_at(
   if (value.type != Map)
     throw Exception::type_error("Argument '" + key +
                                 "' is expected to be a map");
-  return *value.value.map;
+  return value.value.map;
 }
 
 std::shared_ptr<Value::Array_type> Argument_map::array_at(
@@ -2231,7 +2204,7 @@ std::shared_ptr<Value::Array_type> Argument_map::array_at(
   if (value.type != Array)
     throw Exception::type_error("Argument '" + key +
                                 "' is expected to be an array");
-  return *value.value.array;
+  return value.value.array;
 }
 
 bool Argument_map::comp(const std::string &lhs, const std::string &rhs) {
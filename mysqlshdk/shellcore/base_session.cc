@@ -80,7 +80,7 @@ bool Query_attribute_store::set(const std::string &name,
 
   // Validates the string value lengths
   if (value.type == shcore::Value_type::String &&
-      value.value.s->size() > MAX_QUERY_ATTRIBUTE_LENGTH) {
+      value.value.s.size() > MAX_QUERY_ATTRIBUTE_LENGTH) {
     m_invalid_value_length.push_back(name);
     return false;
   }
@@ -648,6 +648,17 @@ Shell_options::Shell_options(
           throw std::invalid_argument(
                     "Value for --interactive if any, must be full");
         }
+      })
+    (cmdline("--log-async[=block|drop]"),
+      "Write the Shell log file using a background thread, so that threads "
+      "which log do not wait for the disk I/O. When the log buffer is full, "
+      "block (default) - waits for the space in the buffer; drop - discards "
+      "the entry and reports number of dropped entries in the log file.",
+      [this](const std::string&, const char* value) {
+        storage.log_async = true;
+        storage.log_async_overflow =
+            !value || !value[0] ? shcore::Logger::Overflow_policy::BLOCK
+                                : shcore::Logger::parse_overflow_policy(value);
       });
 
 
@@ -732,6 +732,10 @@ int main(int argc, char **argv) {
     logger = shcore::Logger::create_instance(
         options.log_file.empty() ? nullptr : options.log_file.c_str(),
         options.log_to_stderr, options.log_level);
+
+    if (options.log_async) {
+      logger->start_async(options.log_async_overflow);
+    }
   } catch (const std::exception &e) {
     fprintf(stderr, "%s\n", e.what());
     exit(1);
@@ -1020,6 +1020,116 @@ TEST_F(Compatibility_test, create_table_combo) {
   EXPECT_UNCHANGED(1);
 }
 
+TEST_F(Compatibility_test, create_table_statement) {
+  const auto single_pass = [](const std::string &ct) {
+    Create_table_statement statement{ct};
+    statement.check_data_index_dir_option(true);
+    statement.check_encryption_option(true);
+    statement.check_engine_option("InnoDB", true);
+    statement.check_fixed_row_format(true);
+    statement.check_tablespace_option({"innodb_"}, true);
+    return statement.rewrite();
+  };
+
+  // last statement is not a CREATE TABLE
+  std::vector<std::string> statements{multiline.begin(),
+                                      std::prev(multiline.end())};
+  statements.insert(statements.end(), rogue.begin(), rogue.end());
+
+  const std::vector<std::string> expected = {
+      "CREATE TABLE t(i int)\n"
+      "/* ENCRYPTION = 'N'*/  \n"
+      "/* DATA DIRECTORY = '\\tmp' INDEX DIRECTORY = '\\tmp',*/ \n"
+      "ENGINE = InnoDB",
+      "CREATE TABLE t (i int PRIMARY KEY) ENGINE = InnoDB\n"
+      "  /* DATA DIRECTORY = '/tmp'*/ \n"
+      "  /* ENCRYPTION = 'y'*/ \n"
+      "  PARTITION BY LIST (i) (\n"
+      "    PARTITION p0 VALUES IN (0) ENGINE = InnoDB,\n"
+      "    PARTITION p1 VALUES IN (1)\n"
+      "    /* DATA DIRECTORY = '/tmp',*/ \n"
+      "    ENGINE = InnoDB\n"
+      "  )",
+      "CREATE TABLE `tmq` (\n"
+      "  `i` int(11) DEFAULT NULL\n"
+      ") ENGINE=InnoDB DEFAULT CHARSET=latin1 /* DATA DIRECTORY='/tmp/' INDEX "
+      "DIRECTORY='/tmp/'*/",
+      "CREATE TABLE `tmq` (\n"
+      "  `i` int(11) DEFAULT NULL\n"
+      ")  ENGINE=InnoDB DEFAULT CHARSET=latin1 /* ENCRYPTION='N'*/",
+      "CREATE TABLE `tmq` (\n"
+      "  `i` int(11) NOT NULL,\n"
+      "  PRIMARY KEY (`i`)\n"
+      ") ENGINE=InnoDB DEFAULT CHARSET=latin1\n"
+      "/*!50100 PARTITION BY LIST (i)\n"
+      "(PARTITION p0 VALUES IN (0) ENGINE = InnoDB,\n"
+      " PARTITION p1 VALUES IN (1) -- DATA DIRECTORY = '/tmp'\n"
+      " ENGINE = InnoDB) */",
+      "CREATE TABLE `tmq` (\n"
+      "  `i` int NOT NULL,\n"
+      "  PRIMARY KEY (`i`)\n"
+      ") ENGINE=InnoDB DEFAULT CHARSET=utf8mb4 COLLATE=utf8mb4_0900_ai_ci\n"
+      "/*!50100 PARTITION BY LIST (`i`)\n"
+      "(PARTITION p0 VALUES IN (0) -- DATA DIRECTORY = '/tmp/'\n"
+      " ENGINE = InnoDB,\n"
+      " PARTITION p1 VALUES IN (1) -- DATA DIRECTORY = '/tmp/'\n"
+      " ENGINE = InnoDB) */",
+      "CREATE TABLE `tmq` (\n"
+      "  `i` int(11) NOT NULL,\n"
+      "  PRIMARY KEY (`i`)\n"
+      ") ENGINE=InnoDB DEFAULT CHARSET=latin1\n"
+      "/*!50100 PARTITION BY LIST (i)\n"
+      "(PARTITION p0 VALUES IN (0)  ENGINE = InnoDB,\n"
+      " PARTITION p1 VALUES IN (1)  ENGINE = InnoDB) */",
+      "CREATE TABLE `rogue` (\n"
+      "  `data` int DEFAULT NULL,\n"
+      "  `index` int DEFAULT NULL,\n"
+      "  `directory` int DEFAULT NULL,\n"
+      "  `encryption` int DEFAULT NULL,\n"
+      "  `engine` int DEFAULT NULL,\n"
+      "  `tablespace` int DEFAULT NULL,\n"
+      "  `collate` int DEFAULT NULL,\n"
+      "  `charset` int DEFAULT NULL,\n"
+      "  `character` int DEFAULT NULL,\n"
+      "  `definer` int DEFAULT NULL\n"
+      ") ENGINE=InnoDB DEFAULT CHARSET=utf8mb4 COLLATE=utf8mb4_0900_ai_ci",
+      "create table rogue (data int, `index` int, directory int, encryption "
+      "int, engine int, tablespace int, `collate` int, charset int, "
+      "`character` int, definer int);"};
+
+  ASSERT_EQ(expected.size(), statements.size());
+
+  for (std::size_t i = 0; i < statements.size(); ++i) {
+    SCOPED_TRACE(statements[i]);
+    EXPECT_EQ(expected[i], single_pass(statements[i]));
+  }
+
+  EXPECT_EQ(
+      "CREATE TABLE t (a int) COMMENT = 'tmp' ENGINE = InnoDB",
+      single_pass(
+          "CREATE TABLE t (a int) COMMENT = 'tmp' ENGINE = MyISAM, "
+          "ROW_FORMAT FIXED"));
+
+  // changes which overlap
+  EXPECT_EQ(
+      "CREATE TABLE t(i int) /* ENCRYPTION = 'N'*/  /* DATA DIRECTORY = "
+      "'/tmp',*/  ENGINE = InnoDB;",
+      single_pass("CREATE TABLE t(i int) ENCRYPTION = 'N' DATA DIRECTORY = "
+                  "'/tmp', /*!50100 TABLESPACE `t s 1` */ ENGINE = MyISAM;"));
+
+  {
+    // checks without fixes do not modify the statement
+    Create_table_statement statement{multiline[0]};
+    EXPECT_TRUE(statement.check_data_index_dir_option(false));
+    EXPECT_TRUE(statement.check_encryption_option(false));
+    EXPECT_EQ("MyISAM", statement.check_engine_option("InnoDB", false));
+    EXPECT_FALSE(statement.check_fixed_row_format(false));
+    EXPECT_FALSE(statement.check_tablespace_option({"innodb_"}, false));
+    EXPECT_FALSE(statement.modified());
+    EXPECT_EQ(multiline[0], statement.rewrite());
+  }
+}
+
 TEST_F(Compatibility_test, check_create_table_for_indexes) {
   const auto EXPECT_STMTS = [](const std::string &sql, const std::string &table,
                                bool fulltext_only,
@@ -22,11 +22,16 @@
  */
 
 #include <gtest/gtest_prod.h>
+#include <algorithm>
 #include <cstdlib>
+#include <mutex>
+#include <string>
+#include <vector>
 #include "modules/util/common/dump/utils.h"
 #include "unittest/gtest_clean.h"
 
 #include "modules/util/load/dump_reader.h"
+#include "unittest/modules/dummy_dumpdir.h"
 
 namespace mysqlsh {
 namespace dump {
@@ -378,4 +383,279 @@ TEST_F(Dump_scheduler, load_scheduler) {
     test_scheduling(Dump_reader::schedule_chunk_proportionally, tables, 16);
   }
 }
+
+TEST_F(Dump_scheduler, deferred_indexes) {
+  Load_dump_options options;
+  Dump_reader reader{
+      std::make_unique<tests::Dummy_dump_directory>("dump", nullptr, 0),
+      options};
+
+  const auto schema = std::make_shared<Dump_reader::Schema_info>();
+  schema->name = "myschema";
+  reader.m_contents.schemas.emplace(schema->name, schema);
+
+  const auto add_table = [&](const std::string &name, size_t chunks,
+                             size_t size) {
+    auto table = std::make_shared<Dump_reader::Table_info>(
+        make_table(name, chunks, 1, 1));
+
+    for (auto &di : table->data_info) {
+      di.owner = table.get();
+    }
+
+    schema->tables.emplace(name, table);
+    reader.m_contents.table_data_size[schema->name][name] = size;
+
+    compatibility::Deferred_statements stmts;
+    stmts.index_info.regular.emplace_back("KEY `idx` (`data`)");
+    reader.add_deferred_statements(schema->name, name, std::move(stmts));
+  };
+
+  std::string schema_name;
+  std::string table_name;
+  compatibility::Deferred_statements::Index_info *indexes = nullptr;
+
+  const auto next_index = [&]() -> std::string {
+    if (reader.next_deferred_index(&schema_name, &table_name, &indexes)) {
+      EXPECT_EQ("myschema", schema_name);
+      EXPECT_NE(nullptr, indexes);
+      return table_name;
+    }
+
+    return {};
+  };
+
+  add_table("small", 1, 100);
+  add_table("big", 2, 1000);
+  add_table("medium", 1, 500);
+
+  // data is not loaded yet
+  EXPECT_EQ("", next_index());
+
+  reader.on_chunk_loaded("myschema", "small", "");
+  reader.on_chunk_loaded("myschema", "big", "");
+
+  // big table still has data to be loaded
+  EXPECT_EQ("small", next_index());
+  EXPECT_EQ("", next_index());
+
+  reader.on_chunk_loaded("myschema", "medium", "");
+  reader.on_chunk_loaded("myschema", "big", "");
+
+  // the biggest table goes first
+  EXPECT_EQ("big", next_index());
+  EXPECT_EQ("medium", next_index());
+  EXPECT_EQ("", next_index());
+
+  // data is not loaded
+  options.set_load_data(false);
+  add_table("no_data", 1, 100);
+  EXPECT_EQ("no_data", next_index());
+  EXPECT_EQ("", next_index());
+}
+
+namespace {
+
+using mysqlshdk::storage::IDirectory;
+
+// Mocks a remote directory, records the patterns which were used to list it
+class Listed_dump_directory : public IDirectory {
+ public:
+  explicit Listed_dump_directory(bool prefix_filtering)
+      : m_prefix_filtering(prefix_filtering) {}
+
+  bool exists() const override { return true; }
+
+  void create() override {}
+
+  mysqlshdk::Masked_string full_path() const override { return "dump"; }
+
+  std::unordered_set<File_info> list_files(bool) const override {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_full_listings;
+    return {m_files.begin(), m_files.end()};
+  }
+
+  std::unordered_set<File_info> filter_files(
+      const std::string &pattern) const override {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::unordered_set<File_info> filtered_files;
+
+    for (const auto &f : m_files) {
+      if (shcore::match_glob(pattern, f.name())) {
+        filtered_files.emplace(f);
+      }
+    }
+
+    return filtered_files;
+  }
+
+  void for_each_file(
+      const std::string &pattern,
+      const std::function<void(File_info &&)> &callback) const override {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_patterns.emplace_back(pattern);
+    }
+
+    IDirectory::for_each_file(pattern, callback);
+  }
+
+  bool supports_prefix_filtering() const override {
+    return m_prefix_filtering;
+  }
+
+  std::unique_ptr<mysqlshdk::storage::IFile> file(
+      const std::string &,
+      const mysqlshdk::storage::File_options & = {}) const override {
+    throw std::logic_error("bad call");
+  }
+
+  bool is_local() const override { return false; }
+
+  std::string join_path(const std::string &a,
+                        const std::string &b) const override {
+    return shcore::path::join_path(a, b);
+  }
+
+  void add_file(const std::string &name) { m_files.emplace_back(name, 1); }
+
+  void remove_file(const std::string &name) {
+    m_files.erase(std::remove_if(m_files.begin(), m_files.end(),
+                                 [&name](const File_info &f) {
+                                   return f.name() == name;
+                                 }),
+                  m_files.end());
+  }
+
+  std::vector<std::string> patterns() {
+    auto patterns = std::move(m_patterns);
+    m_patterns.clear();
+    std::sort(patterns.begin(), patterns.end());
+    return patterns;
+  }
+
+  int full_listings() const { return m_full_listings; }
+
+ private:
+  bool m_prefix_filtering;
+  std::vector<File_info> m_files;
+  mutable std::mutex m_mutex;
+  mutable std::vector<std::string> m_patterns;
+  mutable int m_full_listings = 0;
+};
+
+std::vector<std::string> names(const Dump_reader::Files &files) {
+  std::vector<std::string> result;
+
+  for (const auto &f : files) {
+    result.emplace_back(f.name());
+  }
+
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+std::shared_ptr<Dump_reader::Schema_info> make_schema(const std::string &name,
+                                                      bool all_files_found) {
+  const auto schema = std::make_shared<Dump_reader::Schema_info>();
+  schema->name = name;
+  schema->basename = name;
+  schema->files_prefix = name;
+  schema->has_sql = false;
+  schema->md_done = all_files_found;
+  return schema;
+}
+
+}  // namespace
+
+TEST(Dump_reader, list_files_all) {
+  Load_dump_options options;
+  auto dir_ptr = std::make_unique<Listed_dump_directory>(false);
+  const auto dir = dir_ptr.get();
+  Dump_reader reader{std::move(dir_ptr), options};
+
+  const auto add_schema = [&reader](const std::string &name,
+                                    bool all_files_found) {
+    const auto schema = make_schema(name, all_files_found);
+    reader.m_contents.schemas.emplace(name, schema);
+    return schema;
+  };
+
+  dir->add_file("@.json");
+  dir->add_file("s1.json");
+
+  add_schema("s1", false);
+
+  EXPECT_EQ(std::vector<std::string>({"@.json", "s1.json"}),
+            names(reader.list_files()));
+  EXPECT_EQ(1, dir->full_listings());
+
+  // each scan lists the whole directory, the previous result is replaced
+  dir->remove_file("s1.json");
+  dir->add_file("s1@t1@@0.tsv.zst");
+
+  EXPECT_EQ(std::vector<std::string>({"@.json", "s1@t1@@0.tsv.zst"}),
+            names(reader.list_files()));
+  EXPECT_EQ(2, dir->full_listings());
+  EXPECT_TRUE(dir->patterns().empty());
+}
+
+TEST(Dump_reader, list_files_prefix) {
+  Load_dump_options options;
+  auto dir_ptr = std::make_unique<Listed_dump_directory>(true);
+  const auto dir = dir_ptr.get();
+  Dump_reader reader{std::move(dir_ptr), options};
+
+  const auto add_schema = [&reader](const std::string &name,
+                                    bool all_files_found) {
+    const auto schema = make_schema(name, all_files_found);
+    reader.m_contents.schemas.emplace(name, schema);
+    return schema;
+  };
+
+  dir->add_file("@.json");
+  dir->add_file("s1.json");
+  dir->add_file("s2.json");
+
+  // schemas are not known yet, only the global files are listed
+  EXPECT_EQ(std::vector<std::string>({"@.json"}), names(reader.list_files()));
+  EXPECT_EQ(std::vector<std::string>({"@.*"}), dir->patterns());
+
+  const auto s1 = add_schema("s1", false);
+  add_schema("s2", true);
+  dir->add_file("s1@t1@@0.tsv.zst");
+  dir->add_file("s2@t2@@0.tsv.zst");
+  dir->add_file("@.done.json");
+
+  // only the schemas which were not fully scanned are listed
+  EXPECT_EQ(std::vector<std::string>({"@.done.json", "@.json", "s1.json",
+                                      "s1@t1@@0.tsv.zst"}),
+            names(reader.list_files()));
+  EXPECT_EQ(std::vector<std::string>({"@.*", "s1*"}), dir->patterns());
+
+  // files found by the previous scans are kept, even if they are no longer
+  // listed
+  s1->md_done = true;
+  dir->remove_file("s1@t1@@0.tsv.zst");
+
+  EXPECT_EQ(std::vector<std::string>({"@.done.json", "@.json", "s1.json",
+                                      "s1@t1@@0.tsv.zst"}),
+            names(reader.list_files()));
+  EXPECT_EQ(std::vector<std::string>({"@.*"}), dir->patterns());
+
+  // prefixes covered by other prefixes are not listed
+  add_schema("s", false);
+  add_schema("s3", false);
+  dir->add_file("s3.json");
+
+  EXPECT_EQ(std::vector<std::string>({"@.done.json", "@.json", "s1.json",
+                                      "s1@t1@@0.tsv.zst", "s2.json",
+                                      "s2@t2@@0.tsv.zst", "s3.json"}),
+            names(reader.list_files()));
+  EXPECT_EQ(std::vector<std::string>({"@.*", "s*"}), dir->patterns());
+
+  EXPECT_EQ(0, dir->full_listings());
+}
+
 }  // namespace mysqlsh
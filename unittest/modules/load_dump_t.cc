@@ -534,10 +534,12 @@ class Load_dump_mocked : public Shell_core_test_wrapper {
     if (Version(m_version) >= Version(8, 0, 27)) {
       mock_main_session
           ->expect_query(
-              "SELECT GREATEST(@@innodb_parallel_read_threads, "
-              "@@innodb_ddl_threads)")
-          .then({"a"})
-          .add_row({"4"});
+              "SELECT @@innodb_parallel_read_threads, @@innodb_ddl_threads, "
+              "@@innodb_ddl_buffer_size")
+          .then({"a", "b", "c"})
+          .add_row({std::to_string(m_parallel_read_threads),
+                    std::to_string(m_ddl_threads),
+                    std::to_string(m_ddl_buffer_size)});
     }
 
     if (Version(m_version) >= Version(8, 0, 16)) {
@@ -630,6 +632,10 @@ class Load_dump_mocked : public Shell_core_test_wrapper {
   std::string m_version = "8.0.20";
   mysqlshdk::null_bool m_auto_generate_pk_value;
   bool m_create_invisible_pks = false;
+
+  uint64_t m_parallel_read_threads = 4;
+  uint64_t m_ddl_threads = 4;
+  uint64_t m_ddl_buffer_size = 1048576;
 };
 
 TEST_F(Load_dump_mocked, chunk_scheduling_more_threads) {
@@ -761,4 +767,171 @@ TEST_F(Load_dump_mocked, bug_34110375) {
   load_dump(4, false, "createInvisiblePKs", m_create_invisible_pks);
 }
 
+TEST_F(Load_dump_mocked, index_recreation_weight) {
+  constexpr uint64_t k_mib = 1024 * 1024;
+  m_version = "8.0.30";
+  m_parallel_read_threads = 4;
+  m_ddl_threads = 4;
+
+  {
+    Load_dump_options options;
+    options.set_session(make_mock_main_session());
+
+    // size is not known, global values are used
+    EXPECT_EQ(4, Dump_loader::index_recreation_weight(options, 0, 8));
+    EXPECT_EQ(2, Dump_loader::index_recreation_weight(options, 0, 2));
+
+    // small tables use a single thread
+    EXPECT_EQ(1, Dump_loader::index_recreation_weight(options, 1, 8));
+    EXPECT_EQ(1, Dump_loader::index_recreation_weight(options, 10 * k_mib, 8));
+    EXPECT_EQ(2, Dump_loader::index_recreation_weight(options, 20 * k_mib, 8));
+
+    // big tables use all the idle threads, even more than the global values
+    EXPECT_EQ(8,
+              Dump_loader::index_recreation_weight(options, 1024 * k_mib, 8));
+    EXPECT_EQ(3,
+              Dump_loader::index_recreation_weight(options, 1024 * k_mib, 3));
+    EXPECT_EQ(16,
+              Dump_loader::index_recreation_weight(options, 1024 * k_mib, 16));
+
+    // there's always at least one thread
+    EXPECT_EQ(1,
+              Dump_loader::index_recreation_weight(options, 1024 * k_mib, 0));
+  }
+
+  {
+    // DDL threads are configured by the user, server uses the global values
+    Load_dump_options options;
+    Load_dump_options::options().unpack(
+        shcore::make_dict("sessionInitSql",
+                          shcore::make_array("SET innodb_ddl_threads=8")),
+        &options);
+    options.set_session(make_mock_main_session());
+
+    EXPECT_EQ(4, Dump_loader::index_recreation_weight(options, 0, 8));
+    EXPECT_EQ(1, Dump_loader::index_recreation_weight(options, 1, 8));
+    EXPECT_EQ(4,
+              Dump_loader::index_recreation_weight(options, 1024 * k_mib, 8));
+  }
+
+  {
+    // server does not support parallel index creation
+    m_version = "8.0.26";
+
+    Load_dump_options options;
+    options.set_session(make_mock_main_session());
+
+    EXPECT_EQ(1, Dump_loader::index_recreation_weight(options, 0, 8));
+    EXPECT_EQ(1,
+              Dump_loader::index_recreation_weight(options, 1024 * k_mib, 8));
+  }
+}
+
+TEST_F(Load_dump_mocked, index_recreation_task) {
+  constexpr uint64_t k_mib = 1024 * 1024;
+  m_version = "8.0.30";
+  m_parallel_read_threads = 4;
+  m_ddl_threads = 4;
+  m_ddl_buffer_size = 1048576;
+
+  Load_dump_options options;
+  options.set_session(make_mock_main_session());
+
+  compatibility::Deferred_statements::Index_info indexes;
+  Dump_loader::Worker::Index_recreation_task task{"s", "t", &indexes, options,
+                                                  1024 * k_mib};
+
+  // all loader threads are idle, server uses all of them
+  task.fit_weight(8);
+  EXPECT_EQ(8, task.weight());
+  EXPECT_EQ(
+      "SET @@SESSION.innodb_ddl_threads=8, "
+      "@@SESSION.innodb_parallel_read_threads=8, "
+      "@@SESSION.innodb_ddl_buffer_size=2097152",
+      task.ddl_threads_statement());
+
+  // some of the threads are busy, server uses the global values
+  task.fit_weight(2);
+  EXPECT_EQ(2, task.weight());
+  EXPECT_EQ("", task.ddl_threads_statement());
+
+  // small table
+  Dump_loader::Worker::Index_recreation_task small{"s", "t", &indexes, options,
+                                                   k_mib};
+  small.fit_weight(8);
+  EXPECT_EQ(1, small.weight());
+  EXPECT_EQ("", small.ddl_threads_statement());
+}
+
+TEST_F(Load_dump_mocked, ddl_threads_statement) {
+  m_version = "8.0.30";
+  m_parallel_read_threads = 4;
+  m_ddl_threads = 2;
+  m_ddl_buffer_size = 1048576;
+
+  {
+    Load_dump_options options;
+    options.set_session(make_mock_main_session());
+
+    EXPECT_EQ(4, options.threads_per_add_index());
+    EXPECT_TRUE(options.adjust_ddl_threads());
+
+    // global values are never decreased
+    EXPECT_EQ("", Dump_loader::ddl_threads_statement(options, 1));
+    EXPECT_EQ("", Dump_loader::ddl_threads_statement(options, 2));
+
+    // number of threads reserved by the scheduler, DDL buffer keeps the
+    // per-thread share of the global value
+    EXPECT_EQ(
+        "SET @@SESSION.innodb_ddl_threads=4, "
+        "@@SESSION.innodb_parallel_read_threads=4, "
+        "@@SESSION.innodb_ddl_buffer_size=2097152",
+        Dump_loader::ddl_threads_statement(options, 4));
+    EXPECT_EQ(
+        "SET @@SESSION.innodb_ddl_threads=8, "
+        "@@SESSION.innodb_parallel_read_threads=8, "
+        "@@SESSION.innodb_ddl_buffer_size=4194304",
+        Dump_loader::ddl_threads_statement(options, 8));
+  }
+
+  m_parallel_read_threads = 1;
+  m_ddl_threads = 4;
+
+  {
+    Load_dump_options options;
+    options.set_session(make_mock_main_session());
+
+    EXPECT_EQ("", Dump_loader::ddl_threads_statement(options, 1));
+    EXPECT_EQ(
+        "SET @@SESSION.innodb_ddl_threads=4, "
+        "@@SESSION.innodb_parallel_read_threads=4, "
+        "@@SESSION.innodb_ddl_buffer_size=1048576",
+        Dump_loader::ddl_threads_statement(options, 4));
+  }
+
+  {
+    // DDL threads are configured by the user
+    Load_dump_options options;
+    Load_dump_options::options().unpack(
+        shcore::make_dict("sessionInitSql",
+                          shcore::make_array("SET innodb_ddl_threads=8")),
+        &options);
+    options.set_session(make_mock_main_session());
+
+    EXPECT_FALSE(options.adjust_ddl_threads());
+    EXPECT_EQ("", Dump_loader::ddl_threads_statement(options, 8));
+  }
+
+  {
+    // server does not support parallel index creation
+    m_version = "8.0.26";
+
+    Load_dump_options options;
+    options.set_session(make_mock_main_session());
+
+    EXPECT_EQ(1, options.threads_per_add_index());
+    EXPECT_EQ("", Dump_loader::ddl_threads_statement(options, 1));
+  }
+}
+
 }  // namespace mysqlsh
@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "unittest/gprod_clean.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "modules/util/dump/text_dump_writer.h"
+#include "modules/util/import_table/dialect.h"
+#include "modules/util/import_table/load_data.h"
+#include "modules/util/import_table/scanner.h"
+#include "mysqlshdk/libs/storage/backend/in_memory/virtual_file.h"
+#include "mysqlshdk/libs/storage/backend/in_memory/virtual_fs.h"
+#include "mysqlshdk/libs/storage/backend/memory_file.h"
+#include "mysqlshdk/libs/storage/compressed_file.h"
+#include "unittest/gtest_clean.h"
+#include "unittest/modules/util/dump/synthetic_tables.h"
+#include "unittest/test_utils/benchmark.h"
+
+namespace tests {
+
+/**
+ * Benchmarks of the hot loops of dump and load, executed without a server on
+ * synthetic workloads. Each stage reports its throughput.
+ */
+
+namespace {
+
+using mysqlsh::import_table::Dialect;
+using mysqlshdk::storage::Compression;
+using mysqlshdk::storage::Mode;
+using mysqlshdk::storage::backend::Memory_file;
+
+constexpr std::size_t k_net_buffer_size = 65536;
+
+Dialect dialect() { return Dialect::default_(); }
+
+/**
+ * Encodes the table using the Text_dump_writer, returns number of data bytes
+ * written.
+ */
+uint64_t encode(const Synthetic_table &table,
+                mysqlshdk::storage::IFile *output) {
+  mysqlsh::dump::Text_dump_writer writer{dialect()};
+  mysqlsh::dump::Dump_write_result result;
+
+  writer.set_output_file(output);
+  writer.open();
+
+  result += writer.write_preamble(table.columns, table.pre_encoded_columns);
+
+  for (const auto &row : table.rows) {
+    result += writer.write_row(row.get());
+  }
+
+  result += writer.write_postamble();
+  writer.close();
+
+  return result.data_bytes();
+}
+
+std::string encode(const Synthetic_table &table) {
+  Memory_file file{"-"};
+  file.open(Mode::WRITE);
+  encode(table, &file);
+  file.close();
+
+  return file.content();
+}
+
+std::string compress(const std::string &data, Compression compression) {
+  auto file =
+      mysqlshdk::storage::make_file(std::make_unique<Memory_file>("-"),
+                                    compression);
+  file->open(Mode::WRITE);
+  file->write(data.data(), data.length());
+  file->close();
+
+  return static_cast<Memory_file *>(
+             static_cast<mysqlshdk::storage::Compressed_file *>(file.get())
+                 ->file())
+      ->content();
+}
+
+uint64_t decompress(const std::string &data, Compression compression) {
+  auto memory = std::make_unique<Memory_file>("-");
+  memory->set_content(data);
+
+  auto file = mysqlshdk::storage::make_file(std::move(memory), compression);
+  file->open(Mode::READ);
+
+  std::string buffer(k_net_buffer_size, '\0');
+  uint64_t total = 0;
+  ssize_t bytes;
+
+  while ((bytes = file->read(&buffer[0], buffer.length())) > 0) {
+    total += bytes;
+  }
+
+  file->close();
+
+  return total;
+}
+
+uint64_t scan(const std::string &data) {
+  mysqlsh::import_table::Scanner scanner{dialect(), 0};
+
+  for (std::size_t offset = 0; offset < data.length();
+       offset += k_net_buffer_size) {
+    scanner.scan(data.data() + offset,
+                 std::min(k_net_buffer_size, data.length() - offset));
+  }
+
+  return data.length();
+}
+
+uint64_t transaction_buffer(const std::string &data) {
+  Memory_file file{"-"};
+  file.set_content(data);
+  file.open(Mode::READ);
+
+  mysqlsh::import_table::Transaction_options options;
+  options.max_trx_size = 1024 * 1024;
+  mysqlsh::import_table::Transaction_buffer buffer{dialect(), &file, options};
+
+  std::string net_buffer(k_net_buffer_size, '\0');
+  uint64_t total = 0;
+  bool has_more = true;
+
+  while (has_more) {
+    int bytes;
+
+    while ((bytes = buffer.read(&net_buffer[0], net_buffer.length())) > 0) {
+      total += bytes;
+
+      if (buffer.flush_pending()) {
+        break;
+      }
+    }
+
+    buffer.flush_done(&has_more);
+  }
+
+  EXPECT_EQ(data.length(), total);
+
+  return total;
+}
+
+uint64_t virtual_file(mysqlshdk::storage::in_memory::Virtual_fs *fs,
+                      const std::string &data) {
+  mysqlshdk::storage::in_memory::Virtual_file file{"bench/data.tsv", fs};
+
+  file.open(Mode::WRITE);
+  file.write(data.data(), data.length());
+  file.close();
+
+  file.open(Mode::READ);
+
+  std::string buffer(k_net_buffer_size, '\0');
+  uint64_t total = 0;
+  ssize_t bytes;
+
+  while ((bytes = file.read(&buffer[0], buffer.length())) > 0) {
+    total += bytes;
+  }
+
+  file.close();
+  file.remove();
+
+  EXPECT_EQ(data.length(), total);
+
+  return total;
+}
+
+void benchmark_stages(const std::vector<Synthetic_table> &tables,
+                      int iterations = 5) {
+  const std::string name = 1 == tables.size() ? tables[0].name : "many_tiny";
+  const auto stage = [&name](const char *s) { return name + ", " + s; };
+
+  benchmark_throughput(stage("encode"), iterations, [&tables]() {
+    uint64_t bytes = 0;
+
+    for (const auto &table : tables) {
+      Memory_file file{"-"};
+      file.open(Mode::WRITE);
+      bytes += encode(table, &file);
+      file.close();
+    }
+
+    return bytes;
+  });
+
+  std::string data;
+
+  for (const auto &table : tables) {
+    data += encode(table);
+  }
+
+  for (const auto compression : {Compression::ZSTD, Compression::GZIP}) {
+    const auto c = mysqlshdk::storage::to_string(compression);
+
+    benchmark_throughput(stage(("compress " + c).c_str()), iterations,
+                         [&data, compression]() {
+                           compress(data, compression);
+                           return data.length();
+                         });
+
+    const auto compressed = compress(data, compression);
+
+    benchmark_throughput(
+        stage(("decompress " + c).c_str()), iterations,
+        [&compressed, compression]() {
+          return decompress(compressed, compression);
+        });
+  }
+
+  benchmark_throughput(stage("scan"), iterations,
+                       [&data]() { return scan(data); });
+
+  benchmark_throughput(stage("transaction buffer"), iterations,
+                       [&data]() { return transaction_buffer(data); });
+
+  mysqlshdk::storage::in_memory::Virtual_fs fs{1024 * 1024};
+  fs.create_directory("bench");
+
+  benchmark_throughput(stage("virtual file"), iterations,
+                       [&fs, &data]() { return virtual_file(&fs, data); });
+}
+
+void benchmark_stages(Synthetic_table &&table, int iterations = 5) {
+  std::vector<Synthetic_table> tables;
+  tables.emplace_back(std::move(table));
+  benchmark_stages(tables, iterations);
+}
+
+}  // namespace
+
+TEST(Dump_load_benchmark, DISABLED_benchmark_narrow_rows) {
+  benchmark_stages(synthetic::narrow_rows(500000));
+}
+
+TEST(Dump_load_benchmark, DISABLED_benchmark_wide_rows) {
+  benchmark_stages(synthetic::wide_rows(50000));
+}
+
+TEST(Dump_load_benchmark, DISABLED_benchmark_blob_rows) {
+  benchmark_stages(synthetic::blob_rows(5000));
+}
+
+TEST(Dump_load_benchmark, DISABLED_benchmark_skewed_keys) {
+  benchmark_stages(synthetic::skewed_keys(500000));
+}
+
+TEST(Dump_load_benchmark, DISABLED_benchmark_composite_string_pk) {
+  benchmark_stages(synthetic::composite_string_pk(200000));
+}
+
+TEST(Dump_load_benchmark, DISABLED_benchmark_many_tiny_tables) {
+  benchmark_stages(synthetic::many_tiny_tables(10000));
+}
+
+}  // namespace tests
@@ -21,6 +21,12 @@
 
 #include "unittest/mysqlshdk/libs/oci/oci_tests.h"
 
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
 #include "modules/util/dump/dump_manifest.h"
 #include "mysqlshdk/libs/utils/utils_time.h"
 
@@ -30,6 +36,7 @@ using mysqlsh::dump::Dump_manifest_read_config;
 using mysqlsh::dump::Dump_manifest_reader;
 using mysqlsh::dump::Dump_manifest_write_config;
 using mysqlsh::dump::Dump_manifest_writer;
+using mysqlsh::dump::Manifest_writer;
 using mysqlshdk::oci::Oci_bucket;
 using mysqlshdk::storage::Mode;
 
@@ -103,6 +110,66 @@ bool manifest_object_exists(
   return false;
 }
 
+mysqlshdk::oci::PAR fake_par(std::size_t index) {
+  mysqlshdk::oci::PAR par;
+
+  par.object_name = "object-" + std::to_string(index);
+  par.id = "par-id-" + std::to_string(index);
+  par.name = "par-" + par.object_name;
+  par.access_uri = "/p/fake/n/namespace/b/bucket/o/" + par.object_name;
+  par.size = index;
+
+  return par;
+}
+
+shcore::Dictionary_t to_manifest_entry(const mysqlshdk::oci::PAR &par) {
+  return shcore::make_dict("parId", par.id, "parUrl", par.access_uri,
+                           "objectName", par.object_name, "objectSize",
+                           static_cast<uint64_t>(par.size));
+}
+
+shcore::Dictionary_t get_manifest(mysqlshdk::oci::Oci_bucket *bucket,
+                                  const std::string &name = "@.manifest.json") {
+  mysqlshdk::rest::String_buffer data;
+  bucket->get_object(name, &data);
+  return shcore::Value::parse(std::string{data.data(), data.size()}).as_map();
+}
+
+void put_manifest(mysqlshdk::oci::Oci_bucket *bucket, const std::string &name,
+                  const shcore::Dictionary_t &manifest) {
+  const auto data = shcore::Value(manifest).json();
+  bucket->put_object(name, data.c_str(), data.size());
+}
+
+// verifies that the given manifest contains PARs of the objects in the range
+// [first, last)
+void check_manifest_contents(const shcore::Array_t &contents,
+                             std::size_t first, std::size_t last) {
+  ASSERT_EQ(last - first, contents->size());
+
+  for (auto i = first; i < last; ++i) {
+    SCOPED_TRACE(i);
+
+    const auto entry = contents->at(i - first).as_map();
+    const auto par = fake_par(i);
+
+    EXPECT_EQ(par.object_name, entry->get_string("objectName"));
+    EXPECT_EQ(par.id, entry->get_string("parId"));
+    EXPECT_EQ(par.access_uri, entry->get_string("parUrl"));
+    EXPECT_EQ(par.size, entry->get_uint("objectSize"));
+  }
+}
+
+bool has_file(
+    const std::unordered_set<mysqlshdk::storage::IDirectory::File_info> &files,
+    const std::string &name) {
+  for (const auto &file : files) {
+    if (name == file.name()) return true;
+  }
+
+  return false;
+}
+
 ::testing::AssertionResult wait_for_manifest(
     Oci_bucket *bucket, mysqlshdk::oci::Object_details *manifest) {
   int retries = 0;
@@ -305,4 +372,278 @@ TEST_F(Oci_os_tests, dump_manifest_read_mode) {
                     "Unknown object in manifest");
 }
 
+TEST_F(Oci_os_tests, dump_manifest_write_segments) {
+  SKIP_IF_NO_OCI_CONFIGURATION;
+
+  const auto config = get_config();
+  Oci_bucket bucket(config);
+
+  shcore::Scoped_callback cleanup([this, &bucket]() { clean_bucket(bucket); });
+
+  const auto write_pars = [&config](std::size_t count) {
+    Manifest_writer writer(config, "");
+
+    for (std::size_t i = 0; i < count; ++i) {
+      writer.add_par(fake_par(i));
+    }
+
+    writer.finalize();
+  };
+
+  {
+    SCOPED_TRACE("not enough PARs to write a segment");
+
+    write_pars(999);
+
+    const auto manifest = get_manifest(&bucket);
+    EXPECT_FALSE(manifest->has_key("segments"));
+    check_manifest_contents(manifest->get_array("contents"), 0, 999);
+    EXPECT_TRUE(bucket.list_objects("@.manifest.0.json").empty());
+
+    clean_bucket(bucket);
+  }
+
+  {
+    SCOPED_TRACE("exactly one segment");
+
+    write_pars(1000);
+
+    const auto manifest = get_manifest(&bucket);
+    ASSERT_TRUE(manifest->has_key("segments"));
+
+    const auto segments = manifest->get_array("segments");
+    ASSERT_EQ(1, segments->size());
+    EXPECT_EQ("@.manifest.0.json",
+              segments->at(0).as_map()->get_string("objectName"));
+    EXPECT_TRUE(manifest->get_array("contents")->empty());
+
+    check_manifest_contents(
+        get_manifest(&bucket, "@.manifest.0.json")->get_array("contents"), 0,
+        1000);
+
+    clean_bucket(bucket);
+  }
+
+  {
+    SCOPED_TRACE("segments and remaining PARs");
+
+    write_pars(2500);
+
+    const auto manifest = get_manifest(&bucket);
+    ASSERT_TRUE(manifest->has_key("segments"));
+
+    const auto segments = manifest->get_array("segments");
+    ASSERT_EQ(2, segments->size());
+
+    const auto objects = bucket.list_objects("@.manifest.");
+
+    for (std::size_t i = 0; i < segments->size(); ++i) {
+      const auto segment = segments->at(i).as_map();
+      const auto name = "@.manifest." + std::to_string(i) + ".json";
+
+      EXPECT_EQ(name, segment->get_string("objectName"));
+      EXPECT_TRUE(bucket_object_exists(name, segment->get_int("objectSize"),
+                                       objects));
+      check_manifest_contents(
+          get_manifest(&bucket, name)->get_array("contents"), i * 1000,
+          (i + 1) * 1000);
+    }
+
+    // segments are not repeated in the main manifest
+    check_manifest_contents(manifest->get_array("contents"), 2000, 2500);
+  }
+}
+
+TEST_F(Oci_os_tests, dump_manifest_write_pending_pars) {
+  SKIP_IF_NO_OCI_CONFIGURATION;
+
+  const auto config = get_config();
+  Oci_bucket bucket(config);
+
+  shcore::Scoped_callback cleanup([this, &bucket]() { clean_bucket(bucket); });
+
+  constexpr std::size_t k_count = 20;
+  std::vector<std::unique_ptr<mysqlshdk::storage::IFile>> files;
+
+  {
+    Dump_manifest_writer manifest(config);
+
+    for (std::size_t i = 0; i < k_count; ++i) {
+      auto file = manifest.file(fake_par(i).object_name);
+      file->open(Mode::WRITE);
+      file->write("data", 4);
+      files.emplace_back(std::move(file));
+    }
+
+    // manifest is finalized here, while PARs of the objects are still being
+    // created
+  }
+
+  // objects are closed after the manifest was finalized, their PARs are still
+  // written to the manifest
+  for (auto &file : files) {
+    EXPECT_NO_THROW(file->close());
+  }
+
+  // releases the last reference to the manifest writer
+  files.clear();
+
+  const auto content = get_manifest_content(&bucket);
+  EXPECT_EQ(k_count, content->size());
+
+  for (std::size_t i = 0; i < k_count; ++i) {
+    const auto name = fake_par(i).object_name;
+    EXPECT_TRUE(std::any_of(content->begin(), content->end(),
+                            [&name](const shcore::Value &v) {
+                              return name == v.as_map()->get_string(
+                                                 "objectName");
+                            }))
+        << name;
+  }
+
+  {
+    Dump_manifest_writer manifest(config);
+    auto file = manifest.file("orphan");
+    file->open(Mode::WRITE);
+
+    // object is discarded without being closed, the writer is destroyed while
+    // its PAR may still be pending, this must not block or crash
+  }
+
+  EXPECT_EQ(k_count, get_manifest_content(&bucket)->size());
+}
+
+TEST_F(Oci_os_tests, dump_manifest_read_segments) {
+  SKIP_IF_NO_OCI_CONFIGURATION;
+
+  const auto config = get_config();
+  Oci_bucket bucket(config);
+
+  shcore::Scoped_callback cleanup([this, &bucket]() { clean_bucket(bucket); });
+
+  {
+    Manifest_writer writer(config, "");
+
+    for (std::size_t i = 0; i < 1500; ++i) {
+      writer.add_par(fake_par(i));
+    }
+
+    writer.finalize();
+  }
+
+  const auto time = shcore::future_time_rfc3339(std::chrono::hours(24));
+  const auto manifest_par = bucket.create_pre_authenticated_request(
+      mysqlshdk::oci::PAR_access_type::OBJECT_READ, time, "par-manifest",
+      "@.manifest.json");
+
+  Dump_manifest_reader reader(std::make_shared<Dump_manifest_read_config>(
+      config->service_endpoint() + manifest_par.access_uri));
+
+  auto files = reader.list_files();
+  EXPECT_EQ(1500, files.size());
+  EXPECT_TRUE(has_file(files, "object-0"));
+  EXPECT_TRUE(has_file(files, "object-999"));
+  EXPECT_TRUE(has_file(files, "object-1499"));
+
+  // segments are read just once, if reader tried to read this one again, it
+  // would fail
+  bucket.delete_object("@.manifest.0.json");
+
+  // dump continues: next segment is written and the main manifest is updated,
+  // this time it contains the @.done.json file
+  auto manifest = get_manifest(&bucket);
+
+  {
+    auto contents = shcore::make_array();
+
+    for (std::size_t i = 1000; i < 2000; ++i) {
+      contents->emplace_back(to_manifest_entry(fake_par(i)));
+    }
+
+    constexpr auto k_segment = "@.manifest.1.json";
+    const auto segment = shcore::make_dict("contents", contents);
+    put_manifest(&bucket, k_segment, segment);
+
+    auto par = bucket.create_pre_authenticated_request(
+        mysqlshdk::oci::PAR_access_type::OBJECT_READ, time, "par-segment",
+        k_segment);
+    par.size = shcore::Value(segment).json().size();
+
+    manifest->get_array("segments")->emplace_back(to_manifest_entry(par));
+  }
+
+  {
+    auto contents = shcore::make_array();
+
+    for (std::size_t i = 2000; i <= 2500; ++i) {
+      contents->emplace_back(to_manifest_entry(fake_par(i)));
+    }
+
+    auto done = fake_par(2501);
+    done.object_name = "@.done.json";
+    contents->emplace_back(to_manifest_entry(done));
+
+    manifest->set("contents", shcore::Value(contents));
+  }
+
+  put_manifest(&bucket, "@.manifest.json", manifest);
+
+  EXPECT_NO_THROW(files = reader.list_files());
+  EXPECT_EQ(2502, files.size());
+  EXPECT_TRUE(has_file(files, "object-0"));
+  EXPECT_TRUE(has_file(files, "object-1500"));
+  EXPECT_TRUE(has_file(files, "object-2500"));
+  EXPECT_TRUE(has_file(files, "@.done.json"));
+
+  // manifest is complete, it's no longer read
+  bucket.delete_object("@.manifest.json");
+  EXPECT_NO_THROW(files = reader.list_files());
+  EXPECT_EQ(2502, files.size());
+}
+
+TEST_F(Oci_os_tests, dump_manifest_read_legacy) {
+  SKIP_IF_NO_OCI_CONFIGURATION;
+
+  const auto config = get_config();
+  Oci_bucket bucket(config);
+
+  shcore::Scoped_callback cleanup([this, &bucket]() { clean_bucket(bucket); });
+
+  // manifest written by the previous versions: single file, no segments
+  const auto time = shcore::future_time_rfc3339(std::chrono::hours(24));
+  const auto now = shcore::current_time_rfc3339();
+  auto contents = shcore::make_array();
+
+  for (std::size_t i = 1; i <= 3; ++i) {
+    contents->emplace_back(to_manifest_entry(fake_par(i)));
+  }
+
+  auto done = fake_par(4);
+  done.object_name = "@.done.json";
+  contents->emplace_back(to_manifest_entry(done));
+
+  put_manifest(&bucket, "@.manifest.json",
+               shcore::make_dict("contents", contents, "expireTime", time,
+                                 "lastUpdate", now, "startTime", now,
+                                 "endTime", now));
+
+  const auto manifest_par = bucket.create_pre_authenticated_request(
+      mysqlshdk::oci::PAR_access_type::OBJECT_READ, time, "par-manifest",
+      "@.manifest.json");
+
+  Dump_manifest_reader reader(std::make_shared<Dump_manifest_read_config>(
+      config->service_endpoint() + manifest_par.access_uri));
+
+  const auto files = reader.list_files();
+  EXPECT_EQ(4, files.size());
+  EXPECT_TRUE(has_file(files, "object-1"));
+  EXPECT_TRUE(has_file(files, "object-2"));
+  EXPECT_TRUE(has_file(files, "object-3"));
+  EXPECT_TRUE(has_file(files, "@.done.json"));
+
+  EXPECT_EQ(2, reader.file("object-2")->file_size());
+  EXPECT_THROW_LIKE(reader.file("object-5"), shcore::Exception,
+                    "Unknown object in manifest");
+}
+
 }  // namespace testing
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "unittest/gprod_clean.h"
+
+#include "modules/util/common/dump/json_metadata.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
+
+#include "mysqlshdk/libs/storage/backend/memory_file.h"
+
+#include "unittest/gtest_clean.h"
+
+namespace mysqlsh {
+namespace dump {
+namespace common {
+
+using mysqlshdk::storage::backend::Memory_file;
+
+TEST(Json_metadata_test, writer) {
+  auto file = std::make_unique<Memory_file>("test.json");
+  const auto memory_file = file.get();
+
+  Json_file_writer writer{std::move(file)};
+  const std::vector<std::string> tables = {"t1", "t\"2"};
+
+  writer.start_object();
+  writer.member("schema", "sakila");
+  writer.member("includesDdl", true);
+  writer.member("dataBytes", static_cast<uint64_t>(1234567890123));
+  writer.array("tables", tables,
+               [](Json_file_writer *w, const std::string &t) { w->value(t); });
+  writer.key("basenames");
+  writer.start_object();
+  writer.member("t1", "sakila@t1");
+  writer.end_object();
+  writer.end_object();
+  writer.close();
+
+  // output is the same as the one produced by serializing a document
+  rapidjson::Document doc;
+  doc.Parse(memory_file->content().c_str());
+  ASSERT_FALSE(doc.HasParseError());
+
+  rapidjson::StringBuffer buffer;
+  rapidjson::PrettyWriter<rapidjson::StringBuffer> doc_writer{buffer};
+  doc.Accept(doc_writer);
+
+  EXPECT_EQ(std::string(buffer.GetString(), buffer.GetSize()),
+            memory_file->content());
+
+  EXPECT_EQ("sakila", std::string(doc["schema"].GetString()));
+  EXPECT_TRUE(doc["includesDdl"].GetBool());
+  EXPECT_EQ(1234567890123u, doc["dataBytes"].GetUint64());
+  EXPECT_EQ("t\"2", std::string(doc["tables"][1].GetString()));
+  EXPECT_EQ("sakila@t1", std::string(doc["basenames"]["t1"].GetString()));
+}
+
+TEST(Json_metadata_test, reader) {
+  const Json_metadata md{R"({
+    "schema": "sakila",
+    "includesDdl": false,
+    "dataBytes": 1234567890123,
+    "tables": ["t1", "t2"],
+    "views": null,
+    "options": {"fieldsTerminatedBy": "\t", "threads": 4, "nested": {"a": [1]}}
+})"};
+
+  EXPECT_TRUE(md.has("schema"));
+  EXPECT_FALSE(md.has("missing"));
+
+  EXPECT_EQ("sakila", md.get_string("schema"));
+  EXPECT_EQ("default", md.get_string("missing", "default"));
+
+  EXPECT_FALSE(md.get_bool("includesDdl", true));
+  EXPECT_TRUE(md.get_bool("includesData", true));
+
+  EXPECT_EQ(1234567890123u, md.get_uint("dataBytes"));
+  EXPECT_THROW(md.get_uint("missing"), std::invalid_argument);
+
+  const auto tables = md.get_array("tables");
+  ASSERT_NE(nullptr, tables);
+  ASSERT_EQ(2u, tables->Size());
+  EXPECT_EQ("t2", Json_metadata::as_string((*tables)[1]));
+
+  EXPECT_EQ(nullptr, md.get_array("views"));
+  EXPECT_EQ(nullptr, md.get_array("events"));
+  EXPECT_EQ(nullptr, md.get_object("basenames"));
+
+  const auto options = md.get_map("options");
+  ASSERT_NE(nullptr, options);
+  EXPECT_EQ("\t", options->get_string("fieldsTerminatedBy"));
+  EXPECT_EQ(4, options->get_int("threads"));
+  EXPECT_EQ(1, options->get_map("nested")->get_array("a")->at(0).as_int());
+
+  // type mismatch
+  EXPECT_THROW(md.get_bool("schema", false), std::invalid_argument);
+  EXPECT_THROW(md.get_string("dataBytes"), std::invalid_argument);
+  EXPECT_THROW(md.get_array("schema"), std::invalid_argument);
+  EXPECT_THROW(md.get_object("tables"), std::invalid_argument);
+}
+
+TEST(Json_metadata_test, invalid) {
+  EXPECT_THROW(Json_metadata{"{"}, std::invalid_argument);
+  EXPECT_THROW(Json_metadata{"[]"}, std::invalid_argument);
+  EXPECT_NO_THROW(Json_metadata{"{}"});
+}
+
+}  // namespace common
+}  // namespace dump
+}  // namespace mysqlsh
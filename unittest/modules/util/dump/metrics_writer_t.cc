@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "unittest/gprod_clean.h"
+
+#include "modules/util/common/dump/metrics_writer.h"
+
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
+#include "unittest/gtest_clean.h"
+
+namespace mysqlsh {
+namespace dump {
+namespace common {
+
+using Type = Metrics_writer::Type;
+using Sample = Metrics_writer::Sample;
+
+TEST(Metrics_writer_test, format) {
+  uint64_t rows = 0;
+
+  Metrics_writer writer{"unused"};
+  writer.add(Type::COUNTER, "rows_total", "Number of rows.",
+             [&rows]() { return static_cast<double>(rows); });
+  writer.add(Type::GAUGE, "ratio", "Compression ratio.", []() { return 2.5; });
+  writer.add(Type::COUNTER, "busy_seconds_total", "Time spent.", "worker",
+             []() {
+               return std::vector<Sample>{{"0", 1.25}, {"1", 0}};
+             });
+
+  EXPECT_EQ(R"(# HELP rows_total Number of rows.
+# TYPE rows_total counter
+rows_total 0
+# HELP ratio Compression ratio.
+# TYPE ratio gauge
+ratio 2.5
+# HELP busy_seconds_total Time spent.
+# TYPE busy_seconds_total counter
+busy_seconds_total{worker="0"} 1.25
+busy_seconds_total{worker="1"} 0
+)",
+            writer.format());
+
+  // values are read each time
+  rows = 1234567890123;
+
+  EXPECT_NE(std::string::npos,
+            writer.format().find("\nrows_total 1234567890123\n"));
+}
+
+TEST(Metrics_writer_test, format_special_values) {
+  Metrics_writer writer{"unused"};
+  writer.add(Type::GAUGE, "nan", "NaN.",
+             []() { return std::numeric_limits<double>::quiet_NaN(); });
+  writer.add(Type::GAUGE, "inf", "Infinity.",
+             []() { return std::numeric_limits<double>::infinity(); });
+  writer.add(Type::GAUGE, "escaped", "Help \\ with\nnew \"line\".", "label",
+             []() {
+               return std::vector<Sample>{{"\"quoted\\value\"\n", 1}};
+             });
+
+  EXPECT_EQ(R"(# HELP nan NaN.
+# TYPE nan gauge
+nan NaN
+# HELP inf Infinity.
+# TYPE inf gauge
+inf +Inf
+# HELP escaped Help \\ with\nnew "line".
+# TYPE escaped gauge
+escaped{label="\"quoted\\value\"\n"} 1
+)",
+            writer.format());
+}
+
+TEST(Metrics_writer_test, write) {
+  const auto path =
+      shcore::path::join_path(shcore::path::tmpdir(), "metrics_writer_t.prom");
+  uint64_t rows = 0;
+
+  {
+    Metrics_writer writer{path, std::chrono::hours{1}};
+    writer.add(Type::COUNTER, "rows_total", "Number of rows.",
+               [&rows]() { return static_cast<double>(rows); });
+
+    writer.start();
+
+    rows = 10;
+
+    // stop() writes the final values
+    writer.stop();
+  }
+
+  std::string contents;
+  ASSERT_TRUE(shcore::load_text_file(path, contents));
+  EXPECT_EQ(R"(# HELP rows_total Number of rows.
+# TYPE rows_total counter
+rows_total 10
+)",
+            contents);
+  EXPECT_FALSE(shcore::is_file(path + ".tmp"));
+
+  shcore::delete_file(path);
+}
+
+}  // namespace common
+}  // namespace dump
+}  // namespace mysqlsh
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "unittest/gprod_clean.h"
+
+#include "modules/util/common/dump/stage_timer.h"
+
+#include <chrono>
+#include <thread>
+
+#include "unittest/gtest_clean.h"
+
+namespace mysqlsh {
+namespace dump {
+namespace common {
+
+namespace {
+
+void sleep_ms(int ms) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+double seconds_since(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                       start)
+      .count();
+}
+
+}  // namespace
+
+TEST(Stage_timer_test, inactive) {
+  Stage_timer timer;
+
+  {
+    Stage_timer::Scope scope{Stage::SERVER};
+    sleep_ms(1);
+  }
+
+  EXPECT_EQ(0, timer.nanoseconds(Stage::SERVER));
+}
+
+TEST(Stage_timer_test, nested) {
+  Stage_timer timer;
+  const auto start = std::chrono::steady_clock::now();
+
+  {
+    Stage_timer::Activate active{&timer};
+    Stage_timer::Scope encoding{Stage::ENCODING};
+
+    sleep_ms(10);
+
+    {
+      Stage_timer::Scope compression{Stage::COMPRESSION};
+
+      sleep_ms(10);
+
+      {
+        Stage_timer::Scope storage{Stage::STORAGE};
+        sleep_ms(100);
+      }
+
+      {
+        Stage_timer::Scope disabled{Stage::SERVER, false};
+        sleep_ms(1);
+      }
+    }
+  }
+
+  const auto total = seconds_since(start);
+
+  // scopes opened after the timer is no longer active are ignored
+  {
+    Stage_timer::Scope storage{Stage::STORAGE};
+    sleep_ms(100);
+  }
+
+  EXPECT_EQ(0, timer.nanoseconds(Stage::SERVER));
+  EXPECT_EQ(0, timer.nanoseconds(Stage::INDEXES));
+
+  EXPECT_LE(0.01, timer.seconds(Stage::ENCODING));
+  EXPECT_LE(0.01, timer.seconds(Stage::COMPRESSION));
+  EXPECT_LE(0.1, timer.seconds(Stage::STORAGE));
+
+  // time spent in nested stages is not counted towards the enclosing ones
+  EXPECT_GE(total, timer.seconds(Stage::ENCODING) +
+                       timer.seconds(Stage::COMPRESSION) +
+                       timer.seconds(Stage::STORAGE));
+}
+
+TEST(Stage_timer_test, sampler) {
+  Stage_timer::Sampler sampler{4};
+
+  // first execution is always measured, then one in four, with its weight
+  for (const auto weight : {1, 0, 0, 0, 4, 0, 0, 0, 4, 0}) {
+    EXPECT_EQ(weight, sampler.next());
+  }
+
+  Stage_timer::Sampler every{0};
+
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(1, every.next());
+  }
+}
+
+TEST(Stage_timer_test, sampled_scope) {
+  Stage_timer timer;
+  Stage_timer::Sampler sampler{4};
+
+  {
+    Stage_timer::Activate active{&timer};
+    Stage_timer::Scope encoding{Stage::ENCODING};
+
+    for (int i = 0; i < 8; ++i) {
+      Stage_timer::Scope server{Stage::SERVER, &sampler};
+
+      {
+        // nested scopes are always measured, they are not extrapolated
+        Stage_timer::Scope storage{Stage::STORAGE};
+        sleep_ms(1);
+      }
+
+      sleep_ms(10);
+    }
+
+    // scope without a sampler is not measured
+    Stage_timer::Scope compression{Stage::COMPRESSION, nullptr};
+    sleep_ms(1);
+  }
+
+  // 8 executions, two measured: the first one and one with a weight of 4
+  EXPECT_LE(0.05, timer.seconds(Stage::SERVER));
+  EXPECT_LE(0.008, timer.seconds(Stage::STORAGE));
+  EXPECT_EQ(0, timer.nanoseconds(Stage::COMPRESSION));
+}
+
+TEST(Stage_timer_test, threads) {
+  Stage_timer first;
+  Stage_timer second;
+
+  {
+    Stage_timer::Activate active{&first};
+
+    std::thread t{[&second]() {
+      Stage_timer::Activate active{&second};
+      Stage_timer::Scope server{Stage::SERVER};
+      sleep_ms(20);
+    }};
+
+    Stage_timer::Scope storage{Stage::STORAGE};
+    t.join();
+  }
+
+  EXPECT_EQ(0, first.nanoseconds(Stage::SERVER));
+  EXPECT_LT(0, first.nanoseconds(Stage::STORAGE));
+  EXPECT_LT(0, second.nanoseconds(Stage::SERVER));
+  EXPECT_EQ(0, second.nanoseconds(Stage::STORAGE));
+}
+
+TEST(Stage_timer_test, shared_by_threads) {
+  Stage_timer timer;
+  double background_total = 0.0;
+  const auto start = std::chrono::steady_clock::now();
+
+  {
+    Stage_timer::Activate active{&timer};
+    Stage_timer::Scope server{Stage::SERVER};
+
+    // background thread uses the same timer, its scopes are not nested in the
+    // ones opened by this thread
+    std::thread t{[&timer, &background_total]() {
+      const auto background_start = std::chrono::steady_clock::now();
+
+      {
+        Stage_timer::Activate background{&timer};
+        Stage_timer::Scope compression{Stage::COMPRESSION};
+        Stage_timer::Scope storage{Stage::STORAGE};
+        sleep_ms(20);
+      }
+
+      background_total = seconds_since(background_start);
+    }};
+
+    {
+      Stage_timer::Scope waiting{Stage::WAITING};
+      t.join();
+    }
+  }
+
+  const auto total = seconds_since(start);
+
+  EXPECT_LE(0.02, timer.seconds(Stage::STORAGE));
+  EXPECT_LT(0, timer.nanoseconds(Stage::WAITING));
+  // scopes of each thread are nested only in the scopes of the same thread
+  EXPECT_GE(background_total, timer.seconds(Stage::COMPRESSION) +
+                                  timer.seconds(Stage::STORAGE));
+  EXPECT_GE(total,
+            timer.seconds(Stage::SERVER) + timer.seconds(Stage::WAITING));
+}
+
+}  // namespace common
+}  // namespace dump
+}  // namespace mysqlsh
@@ -0,0 +1,291 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef UNITTEST_MODULES_UTIL_DUMP_SYNTHETIC_TABLES_H_
+#define UNITTEST_MODULES_UTIL_DUMP_SYNTHETIC_TABLES_H_
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "modules/util/dump/dump_writer.h"
+#include "mysqlshdk/libs/db/column.h"
+#include "mysqlshdk/libs/db/row_copy.h"
+#include "mysqlshdk/libs/utils/utils_encoding.h"
+
+namespace tests {
+
+/**
+ * In-memory table used as an input of the dump/load benchmarks. Rows are
+ * generated using a fixed seed, results are reproducible.
+ */
+struct Synthetic_table {
+  std::string name;
+  std::vector<mysqlshdk::db::Column> columns;
+  std::vector<mysqlsh::dump::Dump_writer::Encoding_type> pre_encoded_columns;
+  std::vector<std::unique_ptr<mysqlshdk::db::Mutable_row>> rows;
+
+  std::vector<mysqlshdk::db::Type> types() const {
+    std::vector<mysqlshdk::db::Type> result;
+
+    for (const auto &c : columns) {
+      result.emplace_back(c.get_type());
+    }
+
+    return result;
+  }
+};
+
+namespace synthetic {
+
+using mysqlshdk::db::Type;
+using Encoding_type = mysqlsh::dump::Dump_writer::Encoding_type;
+
+inline void add_column(Synthetic_table *table, const std::string &name,
+                       Type type, uint32_t length,
+                       Encoding_type encoding = Encoding_type::NONE) {
+  const auto binary = Type::Bytes == type;
+  table->columns.emplace_back("def", "bench", table->name, table->name, name,
+                              name, length, 0, type, binary ? 63 : 255, false,
+                              false, binary);
+  table->pre_encoded_columns.emplace_back(encoding);
+}
+
+inline std::string random_text(std::mt19937_64 *rng, std::size_t length) {
+  // includes characters which need to be escaped
+  static constexpr char k_alphabet[] =
+      "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789 ,.'\"\t\\";
+  std::uniform_int_distribution<std::size_t> dist(0, sizeof(k_alphabet) - 2);
+  std::string result(length, ' ');
+
+  for (auto &c : result) {
+    c = k_alphabet[dist(*rng)];
+  }
+
+  return result;
+}
+
+inline std::string random_base64(std::mt19937_64 *rng, std::size_t length) {
+  std::uniform_int_distribution<int> dist(0, 255);
+  std::string bytes(length, '\0');
+
+  for (auto &c : bytes) {
+    c = static_cast<char>(dist(*rng));
+  }
+
+  std::string result;
+  shcore::encode_base64(reinterpret_cast<const unsigned char *>(bytes.data()),
+                        static_cast<int>(bytes.length()), &result);
+  return result;
+}
+
+/**
+ * Few short columns: INT PK, INT, VARCHAR(16).
+ */
+inline Synthetic_table narrow_rows(std::size_t count) {
+  Synthetic_table table;
+  table.name = "narrow";
+  add_column(&table, "id", Type::Integer, 11);
+  add_column(&table, "value", Type::Integer, 11);
+  add_column(&table, "label", Type::String, 64);
+
+  std::mt19937_64 rng{42};
+  std::uniform_int_distribution<int64_t> dist(-1000000, 1000000);
+
+  for (std::size_t i = 0; i < count; ++i) {
+    auto row = std::make_unique<mysqlshdk::db::Mutable_row>(table.types());
+    row->set_field(0, static_cast<int64_t>(i));
+    row->set_field(1, dist(rng));
+    row->set_field(2, random_text(&rng, 16));
+    table.rows.emplace_back(std::move(row));
+  }
+
+  return table;
+}
+
+/**
+ * Many columns of mixed types, including NULLs.
+ */
+inline Synthetic_table wide_rows(std::size_t count, int columns = 40) {
+  Synthetic_table table;
+  table.name = "wide";
+  add_column(&table, "id", Type::Integer, 20);
+
+  for (int c = 1; c < columns; ++c) {
+    const auto name = "c" + std::to_string(c);
+
+    switch (c % 4) {
+      case 0:
+        add_column(&table, name, Type::Integer, 20);
+        break;
+
+      case 1:
+        add_column(&table, name, Type::Double, 22);
+        break;
+
+      case 2:
+        add_column(&table, name, Type::String, 128);
+        break;
+
+      case 3:
+        add_column(&table, name, Type::DateTime, 19);
+        break;
+    }
+  }
+
+  std::mt19937_64 rng{42};
+  std::uniform_int_distribution<int64_t> ints;
+  std::uniform_real_distribution<double> doubles(-1e6, 1e6);
+
+  for (std::size_t i = 0; i < count; ++i) {
+    auto row = std::make_unique<mysqlshdk::db::Mutable_row>(table.types());
+    row->set_field(0, static_cast<int64_t>(i));
+
+    for (int c = 1; c < columns; ++c) {
+      if (0 == (i + c) % 17) {
+        row->set_field(c, nullptr);
+        continue;
+      }
+
+      switch (c % 4) {
+        case 0:
+          row->set_field(c, ints(rng));
+          break;
+
+        case 1:
+          row->set_field(c, doubles(rng));
+          break;
+
+        case 2:
+          row->set_field(c, random_text(&rng, 8 + ints(rng) % 40));
+          break;
+
+        case 3:
+          row->set_field(c, std::string{"2023-01-01 12:34:56"});
+          break;
+      }
+    }
+
+    table.rows.emplace_back(std::move(row));
+  }
+
+  return table;
+}
+
+/**
+ * INT PK and a large BLOB, pre-encoded using base64 (as done by the dumper for
+ * columns which are not safe to be written in a text form).
+ */
+inline Synthetic_table blob_rows(std::size_t count,
+                                 std::size_t blob_size = 16384) {
+  Synthetic_table table;
+  table.name = "blob";
+  add_column(&table, "id", Type::Integer, 11);
+  add_column(&table, "data", Type::Bytes, 65535, Encoding_type::BASE64);
+
+  std::mt19937_64 rng{42};
+
+  for (std::size_t i = 0; i < count; ++i) {
+    auto row = std::make_unique<mysqlshdk::db::Mutable_row>(table.types());
+    row->set_field(0, static_cast<int64_t>(i));
+    row->set_field(1, random_base64(&rng, blob_size));
+    table.rows.emplace_back(std::move(row));
+  }
+
+  return table;
+}
+
+/**
+ * BIGINT key with a skewed (geometric) distribution, lots of small values and
+ * few very large ones.
+ */
+inline Synthetic_table skewed_keys(std::size_t count) {
+  Synthetic_table table;
+  table.name = "skewed";
+  add_column(&table, "id", Type::UInteger, 20);
+  add_column(&table, "value", Type::Integer, 11);
+
+  std::mt19937_64 rng{42};
+  std::geometric_distribution<uint64_t> dist(0.001);
+  uint64_t key = 0;
+
+  for (std::size_t i = 0; i < count; ++i) {
+    auto row = std::make_unique<mysqlshdk::db::Mutable_row>(table.types());
+    key += 1 + dist(rng) * dist(rng);
+    row->set_field(0, uint64_t{key});
+    row->set_field(1, static_cast<int64_t>(i % 100));
+    table.rows.emplace_back(std::move(row));
+  }
+
+  return table;
+}
+
+/**
+ * Composite PK of three strings with a common prefix.
+ */
+inline Synthetic_table composite_string_pk(std::size_t count) {
+  Synthetic_table table;
+  table.name = "composite";
+  add_column(&table, "tenant", Type::String, 64);
+  add_column(&table, "region", Type::String, 64);
+  add_column(&table, "item", Type::String, 255);
+  add_column(&table, "value", Type::Integer, 11);
+
+  std::mt19937_64 rng{42};
+
+  for (std::size_t i = 0; i < count; ++i) {
+    auto row = std::make_unique<mysqlshdk::db::Mutable_row>(table.types());
+    row->set_field(0, "tenant-" + std::to_string(i / 10000));
+    row->set_field(1, "region-" + std::to_string(i / 100 % 100));
+    row->set_field(2, "item-" + random_text(&rng, 32));
+    row->set_field(3, static_cast<int64_t>(i));
+    table.rows.emplace_back(std::move(row));
+  }
+
+  return table;
+}
+
+/**
+ * Lots of tables, each one with just a few rows.
+ */
+inline std::vector<Synthetic_table> many_tiny_tables(std::size_t tables,
+                                                     std::size_t rows = 3) {
+  std::vector<Synthetic_table> result;
+  result.reserve(tables);
+
+  for (std::size_t i = 0; i < tables; ++i) {
+    auto table = narrow_rows(rows);
+    table.name = "tiny_" + std::to_string(i);
+    result.emplace_back(std::move(table));
+  }
+
+  return result;
+}
+
+}  // namespace synthetic
+}  // namespace tests
+
+#endif  // UNITTEST_MODULES_UTIL_DUMP_SYNTHETIC_TABLES_H_
@@ -30,6 +30,7 @@
 #include <set>
 #include <string>
 
+#include "mysqlshdk/libs/utils/ssl_keygen.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 
 namespace mysqlshdk {
@@ -37,7 +38,7 @@ namespace aws {
 
 class Aws_signer_test : public testing::Test {
  protected:
-  static Aws_signer create_signer() {
+  static Aws_signer create_signer(bool sign_payload = true) {
     Aws_signer signer;
 
     signer.m_host = k_host;
@@ -45,6 +46,7 @@ class Aws_signer_test : public testing::Test {
         k_access_key_id, "wJalrXUtnFEMI/K7MDENG/bPxRfiCYEXAMPLEKEY"));
     signer.m_region = k_region;
     signer.m_sign_all_headers = true;
+    signer.m_sign_payload = sign_payload;
 
     return signer;
   }
@@ -90,7 +92,7 @@ class Aws_signer_test : public testing::Test {
     EXPECT_EQ(authorization, headers.at("Authorization"));
   }
 
- private:
+ protected:
   // Friday, 24 May 2013 00:00:00
   static constexpr time_t k_now = 1369353600;
 
@@ -128,6 +130,42 @@ TEST_F(Aws_signer_test, put_object) {
       "44ce7dd67c959e0d3524ffac1771dfbba87d2b6b4b4e99e42034a8b803f8b072");
 }
 
+TEST_F(Aws_signer_test, put_object_hashed_body) {
+  rest::Signed_request request{"/test%24file.text",
+                               {{"Date", "Fri, 24 May 2013 00:00:00 GMT"},
+                                {"x-amz-storage-class", "REDUCED_REDUNDANCY"}}};
+  request.type = rest::Type::PUT;
+
+  const std::string data = "Welcome to Amazon S3.";
+  request.body = data.c_str();
+  request.size = data.length();
+
+  // hash computed while data was written is used instead of hashing the body
+  shcore::ssl::Sha256 hash;
+  hash.update(data.c_str(), 10);
+  hash.update(data.c_str() + 10, data.length() - 10);
+  request.set_body_sha256(hash.finish());
+
+  test_sign_request(
+      &request,
+      "98ad721746da40c64f1a55b78f14c238d841ea1380cd77a1b5971af0ece108bd",
+      "44ce7dd67c959e0d3524ffac1771dfbba87d2b6b4b4e99e42034a8b803f8b072");
+}
+
+TEST_F(Aws_signer_test, put_object_unsigned_payload) {
+  rest::Signed_request request{"/test%24file.text"};
+  request.type = rest::Type::PUT;
+
+  const std::string data = "Welcome to Amazon S3.";
+  request.body = data.c_str();
+  request.size = data.length();
+
+  const auto headers = create_signer(false).sign_request(&request, k_now);
+
+  ASSERT_NE(headers.end(), headers.find("x-amz-content-sha256"));
+  EXPECT_EQ("UNSIGNED-PAYLOAD", headers.at("x-amz-content-sha256"));
+}
+
 TEST_F(Aws_signer_test, get_bucket_lifecycle) {
   rest::Signed_request request{"/?lifecycle"};
   request.type = rest::Type::GET;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022, Oracle and/or its affiliates.
+ * Copyright (c) 2022, 2023, Oracle and/or its affiliates.
  *
  * This program is free software; you can redistribute it and/or modify
  * it under the terms of the GNU General Public License, version 2.0,
@@ -25,6 +25,7 @@
 
 #include <set>
 #include <string>
+#include <vector>
 
 #include "mysqlshdk/libs/utils/ssl_keygen.h"
 
@@ -145,6 +146,17 @@ TEST_P(Bucket_test, list_objects) {
   EXPECT_TRUE(prefixes.empty());
   prefixes.clear();
 
+  // FOR EACH: Streams the files with the given prefix, in order
+  std::vector<std::string> names;
+  bucket.for_each_object("sakila/a", true,
+                         [&names](Object_details &&object) {
+                           names.emplace_back(std::move(object.name));
+                         });
+  EXPECT_EQ((std::vector<std::string>{
+                "sakila/actor.csv", "sakila/actor_metadata.txt",
+                "sakila/address.csv", "sakila/address_metadata.txt"}),
+            names);
+
   clean_bucket(bucket);
 }
 
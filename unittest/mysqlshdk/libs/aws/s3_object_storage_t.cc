@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022, Oracle and/or its affiliates.
+ * Copyright (c) 2022, 2023, Oracle and/or its affiliates.
  *
  * This program is free software; you can redistribute it and/or modify
  * it under the terms of the GNU General Public License, version 2.0,
@@ -21,11 +21,15 @@
  * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
  */
 
+#include <string>
+#include <vector>
+
 #include "mysqlshdk/libs/storage/backend/object_storage.h"
 
 #include "unittest/mysqlshdk/libs/aws/aws_tests.h"
 
 using mysqlshdk::rest::Response_error;
+using mysqlshdk::storage::IDirectory;
 using mysqlshdk::storage::Mode;
 using mysqlshdk::storage::backend::object_storage::Directory;
 
@@ -124,6 +128,34 @@ TEST_P(Object_storage_test, directory_list_files) {
                       {"category.csv"}, {"category_metadata.txt"}};
     EXPECT_EQ(expected_files, filtered);
   }
+  {
+    // files are streamed in lexicographical order
+    std::vector<std::string> names;
+    const auto collect = [&names](IDirectory::File_info &&file) {
+      names.emplace_back(file.name());
+    };
+
+    root_directory.for_each_file("sakila*", collect);
+    EXPECT_EQ((std::vector<std::string>{"sakila.sql", "sakila_metadata.txt",
+                                        "sakila_tables.txt"}),
+              names);
+
+    names.clear();
+    sakila.for_each_file("a*", collect);
+    EXPECT_EQ((std::vector<std::string>{"actor.csv", "actor_metadata.txt",
+                                        "address.csv", "address_metadata.txt"}),
+              names);
+
+    names.clear();
+    sakila.for_each_file("*.csv", collect);
+    EXPECT_EQ((std::vector<std::string>{"actor.csv", "address.csv",
+                                        "category.csv"}),
+              names);
+
+    names.clear();
+    sakila.for_each_file("unexisting*", collect);
+    EXPECT_TRUE(names.empty());
+  }
 
   Directory unexisting(config, "unexisting");
   EXPECT_FALSE(unexisting.exists());
@@ -1,4 +1,4 @@
-/* Copyright (c) 2020, 2022, Oracle and/or its affiliates.
+/* Copyright (c) 2020, 2023, Oracle and/or its affiliates.
 
  This program is free software; you can redistribute it and/or modify
  it under the terms of the GNU General Public License, version 2.0,
@@ -20,6 +20,8 @@
  51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA */
 
 #include <optional>
+#include <string>
+#include <vector>
 
 #include "mysqlshdk/libs/rest/response.h"
 #include "mysqlshdk/libs/storage/backend/object_storage_bucket.h"
@@ -134,6 +136,17 @@ TEST_F(Azure_container_tests, container_list_objects) {
   EXPECT_STREQ("sakila/actor_metadata.txt", objects[1].name.c_str());
   EXPECT_TRUE(prefixes.empty());
   prefixes.clear();
+
+  // FOR EACH: Streams the files with the given prefix, in order
+  std::vector<std::string> names;
+  container.for_each_object("sakila/a", true,
+                            [&names](Object_details &&object) {
+                              names.emplace_back(std::move(object.name));
+                            });
+  EXPECT_EQ((std::vector<std::string>{
+                "sakila/actor.csv", "sakila/actor_metadata.txt",
+                "sakila/address.csv", "sakila/address_metadata.txt"}),
+            names);
 }
 
 TEST_F(Azure_container_tests, multipart_uploads) {
@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "modules/mod_utils.h"
+#include "mysqlshdk/include/scripting/types.h"
+#include "mysqlshdk/libs/db/replay/replayer.h"
+#include "mysqlshdk/libs/db/replay/trace.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+#include "unittest/gtest_clean.h"
+#include "unittest/test_utils/benchmark.h"
+
+namespace tests {
+
+/**
+ * Benchmarks the shell-side overhead of a session (result decoding, building
+ * of shcore::Values, JSON serialization), without a server.
+ *
+ * By default a synthetic trace resembling the chunked SELECTs of a dump is
+ * used. Traces of real commands can be captured using a debug build:
+ *
+ *   MYSQLSH_RECORDER_MODE=record MYSQLSH_RECORDER_PREFIX=/tmp/traces/ \
+ *       mysqlsh ...
+ *
+ * and then replayed at full speed with:
+ *
+ *   MYSQLSH_BENCHMARK_TRACES=/tmp/traces run_unit_tests ...
+ *
+ * If MYSQLSH_BENCHMARK_MAX_MS is set, benchmark fails if replaying all of the
+ * traces takes longer than the given number of milliseconds.
+ */
+
+namespace {
+
+using mysqlshdk::db::replay::Trace;
+
+std::string synthetic_entry(const std::string &type,
+                            const std::string &subtype, int index) {
+  auto entry = shcore::make_dict();
+  entry->emplace("type", type);
+  entry->emplace("subtype", subtype);
+  entry->emplace("index", index);
+  return shcore::Value(std::move(entry)).json();
+}
+
+std::string synthetic_column(const std::string &name, const std::string &type,
+                             int length) {
+  auto column = shcore::make_dict();
+  column->emplace("schema", "sakila");
+  column->emplace("table_name", "rental");
+  column->emplace("table_label", "rental");
+  column->emplace("column_name", name);
+  column->emplace("column_label", name);
+  column->emplace("length", length);
+  column->emplace("fractional", 0);
+  column->emplace("type", type);
+  column->emplace("collation", "utf8mb4_0900_ai_ci");
+  column->emplace("charset", "utf8mb4");
+  column->emplace("collation_id", 255);
+  column->emplace("unsigned", false);
+  column->emplace("zerofill", false);
+  column->emplace("binary", false);
+  return shcore::Value(std::move(column)).json();
+}
+
+/**
+ * Writes a trace of a classic session which executes the given number of
+ * queries, each one returning the given number of rows.
+ */
+void write_synthetic_trace(const std::string &path, int queries, int rows) {
+  int index = 0;
+  std::string trace = "[\n";
+
+  trace += R"({"type":"request","subtype":"CONNECT","index":)" +
+           std::to_string(++index) +
+           R"(,"uri":"root@localhost:3306","protocol":"classic"},)"
+           "\n";
+  trace += R"({"type":"response","subtype":"CONNECT_OK","index":)" +
+           std::to_string(++index) +
+           R"(,"server_version":"8.0.35","connection_id":"10"},)"
+           "\n";
+
+  const auto columns = "[" +
+                       shcore::str_join(
+                           std::vector<std::string>{
+                               synthetic_column("rental_id", "Integer", 11),
+                               synthetic_column("rental_date", "DateTime", 19),
+                               synthetic_column("customer", "String", 180),
+                               synthetic_column("amount", "Decimal", 7),
+                               synthetic_column("rate", "Double", 22)},
+                           ",") +
+                       "]";
+
+  for (int q = 0; q < queries; ++q) {
+    trace += R"({"type":"request","subtype":"QUERY","index":)" +
+             std::to_string(++index) +
+             R"(,"sql":"SELECT SQL_NO_CACHE * FROM `sakila`.`rental` WHERE )"
+             R"(`rental_id` BETWEEN )" +
+             std::to_string(q * rows) + " AND " +
+             std::to_string((q + 1) * rows - 1) + "\"},\n";
+
+    std::string result_rows;
+
+    for (int r = 0; r < rows; ++r) {
+      const auto id = q * rows + r;
+
+      if (r) result_rows += ',';
+
+      result_rows += "[" + std::to_string(id) + R"(,"2005-05-24 22:53:30",)" +
+                     "\"customer-" + std::to_string(id % 599) +
+                     R"(@sakilacustomer.org",")" + std::to_string(id % 10) +
+                     ".99\"," + std::to_string(id * 0.25) + "]";
+    }
+
+    trace += R"({"type":"response","subtype":"RESULT","index":)" +
+             std::to_string(++index) +
+             R"(,"auto_increment_value":0,"affected_rows":0,)"
+             R"("warning_count":0,"info":"","columns":)" +
+             columns + R"(,"rows":[)" + result_rows + "]},\n";
+  }
+
+  trace += synthetic_entry("request", "CLOSE", ++index) + ",\n";
+  trace += synthetic_entry("response", "OK", ++index) + ",\n";
+  trace += "null]\n";
+
+  ASSERT_TRUE(shcore::create_file(path, trace));
+}
+
+/**
+ * Replays the whole trace, converts each row into shcore::Values and
+ * serializes them to JSON, returns number of replayed rows.
+ */
+uint64_t replay(Trace *trace) {
+  const auto x_protocol = shcore::str_endswith(trace->trace_path(), "x_trace");
+  uint64_t rows = 0;
+
+  trace->rewind();
+
+  while (const auto subtype = trace->peek_subtype()) {
+    if (0 == strcmp(subtype, "CONNECT")) {
+      trace->expected_connect();
+
+      std::map<std::string, std::string> info;
+      trace->expected_connect_status(&info);
+    } else if (0 == strcmp(subtype, "QUERY")) {
+      trace->expected_query("");
+
+      std::shared_ptr<mysqlshdk::db::IResult> result;
+
+      try {
+        if (x_protocol) {
+          result = trace->expected_result_x(nullptr);
+        } else {
+          result = trace->expected_result(nullptr);
+        }
+      } catch (const mysqlshdk::db::Error &) {
+        // errors returned by the server are a part of the trace
+        continue;
+      }
+
+      while (const auto row = result->fetch_one()) {
+        auto values = shcore::make_array(mysqlsh::get_row_values(*row));
+        EXPECT_FALSE(shcore::Value(std::move(values)).json().empty());
+        ++rows;
+      }
+    } else if (0 == strcmp(subtype, "CLOSE")) {
+      trace->expected_close();
+      trace->expected_status();
+    } else {
+      ADD_FAILURE() << "Unexpected entry in trace " << trace->trace_path()
+                    << ": " << subtype;
+      break;
+    }
+  }
+
+  return rows;
+}
+
+std::vector<std::string> benchmark_traces(std::string *tmp_file) {
+  std::vector<std::string> traces;
+
+  if (const auto dir = getenv("MYSQLSH_BENCHMARK_TRACES")) {
+    if (shcore::is_folder(dir)) {
+      for (const auto &file : shcore::listdir(dir)) {
+        if (shcore::str_endswith(file, "_trace")) {
+          traces.emplace_back(shcore::path::join_path(dir, file));
+        }
+      }
+    } else {
+      traces.emplace_back(dir);
+    }
+  } else {
+    *tmp_file = shcore::path::join_path(shcore::path::tmpdir(),
+                                        "replay_benchmark.1.mysql_trace");
+    write_synthetic_trace(*tmp_file, 100, 1000);
+    traces.emplace_back(*tmp_file);
+  }
+
+  std::sort(traces.begin(), traces.end());
+
+  return traces;
+}
+
+}  // namespace
+
+TEST(Replay_benchmark, DISABLED_benchmark_trace_parse) {
+  std::string tmp_file;
+  const auto traces = benchmark_traces(&tmp_file);
+
+  for (const auto &path : traces) {
+    benchmark("parse " + shcore::path::basename(path), 10,
+              [&path]() { Trace trace{path}; });
+  }
+
+  if (!tmp_file.empty()) shcore::delete_file(tmp_file);
+}
+
+TEST(Replay_benchmark, DISABLED_benchmark_replay) {
+  std::string tmp_file;
+  const auto traces = benchmark_traces(&tmp_file);
+  uint64_t total_ns = 0;
+
+  for (const auto &path : traces) {
+    // parsing is benchmarked separately, replay the same trace in a loop
+    Trace trace{path};
+    uint64_t rows = 0;
+
+    total_ns += benchmark("replay " + shcore::path::basename(path), 10,
+                          [&trace, &rows]() { rows = replay(&trace); });
+
+    std::cout << "[ BENCHMARK] " << rows << " rows replayed" << std::endl;
+  }
+
+  if (const auto max_ms = getenv("MYSQLSH_BENCHMARK_MAX_MS")) {
+    EXPECT_GE(std::strtoull(max_ms, nullptr, 10), total_ns / 1000000);
+  }
+
+  if (!tmp_file.empty()) shcore::delete_file(tmp_file);
+}
+
+}  // namespace tests
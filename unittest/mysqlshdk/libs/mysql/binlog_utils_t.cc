@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/mysql/binlog_utils.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "mysqlshdk/libs/db/session.h"
+#include "mysqlshdk/libs/mysql/instance.h"
+#include "unittest/test_utils/mocks/mysqlshdk/libs/db/mock_mysql_session.h"
+#include "unittest/test_utils/mocks/mysqlshdk/libs/db/mock_session.h"
+#include "unittest/test_utils/shell_base_test.h"
+
+namespace mysqlshdk {
+namespace mysql {
+
+using testing::_;
+using testing::Invoke;
+
+namespace {
+
+constexpr auto k_uuid = "8b8dc2ba-8803-11eb-af3d-a1178d81dccc";
+
+std::string gtid(uint64_t gno) { return k_uuid + (':' + std::to_string(gno)); }
+
+std::string subtract_query(const std::string &gtid_set) {
+  return "SELECT gtid_subtract('" + gtid_set + "', @@global.gtid_executed)";
+}
+
+std::string transaction(uint64_t gno) {
+  return "SET gtid_next = '" + gtid(gno) + "';START TRANSACTION;COMMIT";
+}
+
+std::vector<std::string> statements(uint64_t gno) {
+  return {"SET gtid_next = '" + gtid(gno) + "'", "START TRANSACTION",
+          "COMMIT"};
+}
+
+}  // namespace
+
+class Binlog_utils_test : public tests::Shell_base_test {
+ protected:
+  using Progress = std::vector<std::pair<uint64_t, uint64_t>>;
+
+  template <typename T>
+  void record_executed(T *session) {
+    EXPECT_CALL(*session, executes(_, _))
+        .WillRepeatedly(Invoke([this](const char *sql, size_t len) {
+          m_executed.emplace_back(sql, len);
+        }));
+  }
+
+  Gtid_injection_progress progress() {
+    return [this](uint64_t injected, uint64_t total) {
+      m_progress.emplace_back(injected, total);
+    };
+  }
+
+  std::vector<std::string> m_executed;
+  Progress m_progress;
+};
+
+TEST_F(Binlog_utils_test, inject_gtid_set_nothing_to_inject) {
+  auto session = std::make_shared<testing::Mock_mysql_session>();
+  Instance server(session);
+
+  EXPECT_CALL(*session, set_multi_statements(_)).Times(0);
+  record_executed(session.get());
+
+  // empty set, server is not queried
+  EXPECT_EQ(0u, inject_gtid_set(server, Gtid_set{}, progress()));
+
+  // all transactions were already executed
+  const auto set = gtid(1) + "-5";
+  session->expect_query(subtract_query(set)).then({""}).add_row({""});
+
+  EXPECT_EQ(0u, inject_gtid_set(server, Gtid_set::from_string(set), progress(),
+                               2));
+
+  EXPECT_TRUE(m_executed.empty());
+  EXPECT_TRUE(m_progress.empty());
+}
+
+TEST_F(Binlog_utils_test, inject_gtid_set_batches) {
+  auto session = std::make_shared<testing::Mock_mysql_session>();
+  Instance server(session);
+
+  record_executed(session.get());
+
+  {
+    SCOPED_TRACE("last batch is partial");
+
+    {
+      testing::InSequence seq;
+      EXPECT_CALL(*session, set_multi_statements(true)).Times(1);
+      EXPECT_CALL(*session, set_multi_statements(false)).Times(1);
+    }
+
+    const auto set = gtid(1) + "-5";
+    session->expect_query(subtract_query(set)).then({""}).add_row({set});
+    session->expect_query(transaction(1) + ";" + transaction(2)).then({""});
+    session->expect_query(transaction(3) + ";" + transaction(4)).then({""});
+    session->expect_query(transaction(5)).then({""});
+
+    EXPECT_EQ(5u, inject_gtid_set(server, Gtid_set::from_string(set),
+                                 progress(), 2));
+
+    EXPECT_EQ((Progress{{2, 5}, {4, 5}, {5, 5}}), m_progress);
+    EXPECT_EQ(std::vector<std::string>{"SET gtid_next = AUTOMATIC"},
+              m_executed);
+
+    testing::Mock::VerifyAndClearExpectations(session.get());
+    record_executed(session.get());
+    m_executed.clear();
+    m_progress.clear();
+  }
+
+  {
+    SCOPED_TRACE("last batch is full");
+
+    {
+      testing::InSequence seq;
+      EXPECT_CALL(*session, set_multi_statements(true)).Times(1);
+      EXPECT_CALL(*session, set_multi_statements(false)).Times(1);
+    }
+
+    const auto set = gtid(1) + "-6";
+    session->expect_query(subtract_query(set)).then({""}).add_row({set});
+    session
+        ->expect_query(transaction(1) + ";" + transaction(2) + ";" +
+                       transaction(3))
+        .then({""});
+    session
+        ->expect_query(transaction(4) + ";" + transaction(5) + ";" +
+                       transaction(6))
+        .then({""});
+
+    EXPECT_EQ(6u, inject_gtid_set(server, Gtid_set::from_string(set),
+                                 progress(), 3));
+
+    EXPECT_EQ((Progress{{3, 6}, {6, 6}}), m_progress);
+    EXPECT_EQ(std::vector<std::string>{"SET gtid_next = AUTOMATIC"},
+              m_executed);
+  }
+}
+
+TEST_F(Binlog_utils_test, inject_gtid_set_subtract) {
+  auto session = std::make_shared<testing::Mock_mysql_session>();
+  Instance server(session);
+
+  record_executed(session.get());
+  EXPECT_CALL(*session, set_multi_statements(_)).Times(2);
+
+  // transactions 1-2, 5-6 and 8-10 were injected by an interrupted call, only
+  // the remaining ones are sent to the server
+  const auto set = gtid(1) + "-10";
+  session->expect_query(subtract_query(set))
+      .then({""})
+      .add_row({gtid(3) + "-4:7"});
+  session
+      ->expect_query(transaction(3) + ";" + transaction(4) + ";" +
+                     transaction(7))
+      .then({""});
+
+  EXPECT_EQ(3u, inject_gtid_set(server, Gtid_set::from_string(set),
+                               progress()));
+
+  EXPECT_EQ((Progress{{3, 3}}), m_progress);
+  EXPECT_EQ(std::vector<std::string>{"SET gtid_next = AUTOMATIC"}, m_executed);
+}
+
+TEST_F(Binlog_utils_test, inject_gtid_set_error) {
+  auto session = std::make_shared<testing::Mock_mysql_session>();
+  Instance server(session);
+
+  record_executed(session.get());
+
+  {
+    testing::InSequence seq;
+    EXPECT_CALL(*session, set_multi_statements(true)).Times(1);
+    EXPECT_CALL(*session, set_multi_statements(false)).Times(1);
+  }
+
+  const auto set = gtid(1) + "-5";
+  session->expect_query(subtract_query(set)).then({""}).add_row({set});
+  session->expect_query(transaction(1) + ";" + transaction(2)).then({""});
+  session->expect_query(transaction(3) + ";" + transaction(4))
+      .then_throw("Lost connection to MySQL server during query", 2013);
+
+  EXPECT_THROW(
+      inject_gtid_set(server, Gtid_set::from_string(set), progress(), 2),
+      mysqlshdk::db::Error);
+
+  // only the first batch is reported, session is restored
+  EXPECT_EQ((Progress{{2, 5}}), m_progress);
+  EXPECT_EQ(std::vector<std::string>{"SET gtid_next = AUTOMATIC"}, m_executed);
+}
+
+TEST_F(Binlog_utils_test, inject_gtid_set_single_statements) {
+  const auto set = gtid(1) + "-3";
+  std::vector<std::string> expected;
+
+  for (uint64_t gno = 1; gno <= 3; ++gno) {
+    const auto s = statements(gno);
+    expected.insert(expected.end(), s.begin(), s.end());
+  }
+
+  expected.emplace_back("SET gtid_next = AUTOMATIC");
+
+  {
+    SCOPED_TRACE("non-classic session");
+
+    auto session = std::make_shared<testing::Mock_session>();
+    Instance server(session);
+
+    record_executed(session.get());
+    session->expect_query(subtract_query(set))
+        .then_return({{"", {""}, {db::Type::String}, {{set}}}});
+
+    EXPECT_EQ(3u, inject_gtid_set(server, Gtid_set::from_string(set),
+                                 progress(), 2));
+
+    EXPECT_EQ((Progress{{1, 3}, {2, 3}, {3, 3}}), m_progress);
+    EXPECT_EQ(expected, m_executed);
+
+    m_executed.clear();
+    m_progress.clear();
+  }
+
+  {
+    SCOPED_TRACE("batch size is 0");
+
+    auto session = std::make_shared<testing::Mock_mysql_session>();
+    Instance server(session);
+
+    record_executed(session.get());
+    EXPECT_CALL(*session, set_multi_statements(_)).Times(0);
+    session->expect_query(subtract_query(set)).then({""}).add_row({set});
+
+    EXPECT_EQ(3u, inject_gtid_set(server, Gtid_set::from_string(set),
+                                 progress(), 0));
+
+    EXPECT_EQ((Progress{{1, 3}, {2, 3}, {3, 3}}), m_progress);
+    EXPECT_EQ(expected, m_executed);
+  }
+}
+
+}  // namespace mysql
+}  // namespace mysqlshdk
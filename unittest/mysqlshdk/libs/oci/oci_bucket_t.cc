@@ -1,4 +1,4 @@
-/* Copyright (c) 2020, 2022, Oracle and/or its affiliates.
+/* Copyright (c) 2020, 2023, Oracle and/or its affiliates.
 
  This program is free software; you can redistribute it and/or modify
  it under the terms of the GNU General Public License, version 2.0,
@@ -20,6 +20,8 @@
  51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA */
 
 #include <optional>
+#include <string>
+#include <vector>
 
 #include "mysqlshdk/libs/utils/utils_time.h"
 #include "unittest/mysqlshdk/libs/oci/oci_tests.h"
@@ -118,6 +120,17 @@ TEST_F(Oci_os_tests, bucket_list_objects) {
   EXPECT_TRUE(prefixes.empty());
   prefixes.clear();
 
+  // FOR EACH: Streams the files with the given prefix, in order
+  std::vector<std::string> names;
+  bucket.for_each_object("sakila/a", true,
+                         [&names](Object_details &&object) {
+                           names.emplace_back(std::move(object.name));
+                         });
+  EXPECT_EQ((std::vector<std::string>{
+                "sakila/actor.csv", "sakila/actor_metadata.txt",
+                "sakila/address.csv", "sakila/address_metadata.txt"}),
+            names);
+
   clean_bucket(bucket);
 }
 
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <string>
+
+#include "unittest/gtest_clean.h"
+#include "unittest/test_utils/benchmark.h"
+
+#include "mysqlshdk/libs/parser/code-completion/mysql_code_completion_context.h"
+
+namespace mysqlshdk {
+namespace {
+
+using Candidate = Sql_completion_result::Candidate;
+
+/**
+ * Creates a stored procedure with the given number of lines, the body is left
+ * open, so that statements can be appended.
+ */
+std::string long_procedure(int lines) {
+  std::string sql =
+      "CREATE PROCEDURE p(IN a INT, OUT b INT)\n"
+      "BEGIN\n"
+      "  DECLARE c INT DEFAULT 0;\n";
+
+  for (int i = 3; i < lines; ++i) {
+    switch (i % 4) {
+      case 0:
+        sql += "  SET c = c + " + std::to_string(i) + ";\n";
+        break;
+
+      case 1:
+        sql += "  SELECT id, name INTO b, @n FROM t" + std::to_string(i) +
+               " WHERE id = a AND name LIKE 'x%';\n";
+        break;
+
+      case 2:
+        sql += "  IF c > " + std::to_string(i) +
+               " THEN UPDATE t SET v = v + 1 WHERE id = c; END IF;\n";
+        break;
+
+      case 3:
+        sql += "  INSERT INTO log (id, msg) VALUES (c, CONCAT('line ', " +
+               std::to_string(i) + "));\n";
+        break;
+    }
+  }
+
+  return sql;
+}
+
+void setup(Sql_completion_context *completion) {
+  completion->set_sql_mode("");
+  completion->set_active_schema("unused");
+}
+
+}  // namespace
+
+TEST(Sql_completion_context, repeated_completion) {
+  Sql_completion_context completion(utils::Version(8, 0, 0));
+  setup(&completion);
+
+  const auto first = completion.complete("SEL", 3);
+  EXPECT_EQ(1u, first.keywords.count("SELECT"));
+
+  const auto second = completion.complete("SEL", 3);
+  EXPECT_EQ(first.keywords, second.keywords);
+  EXPECT_EQ(first.context.prefix.full, second.context.prefix.full);
+
+  // changes in settings are taken into account
+  completion.set_uppercase_keywords(false);
+
+  const auto lowercase = completion.complete("SEL", 3);
+  EXPECT_EQ(0u, lowercase.keywords.count("SELECT"));
+  EXPECT_EQ(1u, lowercase.keywords.count("select"));
+}
+
+TEST(Sql_completion_context, long_statement) {
+  Sql_completion_context completion(utils::Version(8, 0, 0));
+  setup(&completion);
+  const auto sql = long_procedure(200) + "  SELECT * FROM t1 WHERE ";
+
+  const auto result = completion.complete(sql, sql.length());
+
+  EXPECT_EQ(1u, result.candidates.count(Candidate::COLUMN));
+  ASSERT_EQ(1u, result.context.references.size());
+  EXPECT_EQ("t1", result.context.references[0].table);
+}
+
+TEST(Sql_completion_context, DISABLED_benchmark_long_statement) {
+  Sql_completion_context completion(utils::Version(8, 0, 0));
+  setup(&completion);
+
+  for (const auto lines : {10, 50, 200}) {
+    const auto procedure = long_procedure(lines);
+    // alternate between the inputs, so that each call is computed again
+    const std::string sql[] = {procedure + "  SELECT * FROM t1 WHERE ",
+                               procedure + "  SELECT * FROM t1 WHERE i"};
+    int i = 0;
+
+    tests::benchmark(
+        "complete at the end of " + std::to_string(lines) + "-line procedure",
+        100, [&]() {
+          const auto &s = sql[i++ % 2];
+          EXPECT_FALSE(completion.complete(s, s.length()).candidates.empty());
+        });
+
+    const auto middle = procedure.length() / 2;
+
+    tests::benchmark(
+        "complete in the middle of " + std::to_string(lines) +
+            "-line procedure",
+        100, [&]() {
+          const auto &s = sql[i++ % 2];
+          completion.complete(s, middle);
+        });
+
+    tests::benchmark(
+        "complete " + std::to_string(lines) + "-line procedure again", 100,
+        [&]() { completion.complete(sql[0], sql[0].length()); });
+  }
+}
+
+}  // namespace mysqlshdk
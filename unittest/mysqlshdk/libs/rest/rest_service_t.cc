@@ -35,6 +35,7 @@ extern char **environ;
 #include "unittest/gtest_clean.h"
 #include "unittest/test_utils/mocks/gmock_clean.h"
 
+#include "mysqlshdk/libs/rest/connection_pool.h"
 #include "mysqlshdk/libs/rest/rest_service.h"
 #include "mysqlshdk/libs/rest/retry_strategy.h"
 #include "mysqlshdk/libs/utils/process_launcher.h"
@@ -973,6 +974,50 @@ TEST_F(Rest_service_test, bug34765385) {
   EXPECT_EQ(2, retry_strategy.get_retry_count());
 }
 
+TEST_F(Rest_service_test, connection_pool) {
+  FAIL_IF_NO_SERVER
+
+  const auto pool = Connection_pool::get();
+  const auto get = []() {
+    Rest_service service{s_test_server->get_address(), false};
+    Request request{"/get"};
+    EXPECT_EQ(Response::Status_code::OK, service.get(&request).status);
+  };
+
+  pool->clear();
+  const auto before = pool->stats();
+
+  // first service creates a new handle and a new connection
+  get();
+
+  auto after = pool->stats();
+  EXPECT_EQ(1u, after.handles_created - before.handles_created);
+  EXPECT_EQ(0u, after.handles_reused - before.handles_reused);
+  EXPECT_EQ(1u, after.requests - before.requests);
+  EXPECT_EQ(1u, after.connections_created - before.connections_created);
+  EXPECT_EQ(1u, after.tls_handshakes - before.tls_handshakes);
+
+  // second service reuses the handle and its connection
+  get();
+
+  after = pool->stats();
+  EXPECT_EQ(1u, after.handles_created - before.handles_created);
+  EXPECT_EQ(1u, after.handles_reused - before.handles_reused);
+  EXPECT_EQ(2u, after.requests - before.requests);
+  EXPECT_EQ(1u, after.connections_created - before.connections_created);
+  EXPECT_EQ(1u, after.connections_reused - before.connections_reused);
+  EXPECT_EQ(1u, after.tls_handshakes - before.tls_handshakes);
+
+  // idle handles are closed, new connection is needed
+  pool->clear();
+  get();
+
+  after = pool->stats();
+  EXPECT_EQ(2u, after.handles_created - before.handles_created);
+  EXPECT_EQ(2u, after.connections_created - before.connections_created);
+  EXPECT_EQ(2u, after.tls_handshakes - before.tls_handshakes);
+}
+
 }  // namespace test
 }  // namespace rest
 }  // namespace mysqlshdk
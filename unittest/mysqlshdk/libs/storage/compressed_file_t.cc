@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, 2021, Oracle and/or its affiliates.
+ * Copyright (c) 2020, 2023, Oracle and/or its affiliates.
  *
  * This program is free software; you can redistribute it and/or modify
  * it under the terms of the GNU General Public License, version 2.0,
@@ -375,6 +375,88 @@ TEST_P(Compression, compress_decompress_bigdata) {
   }
 }
 
+namespace {
+
+std::string gz_compress(const std::string &data, std::size_t threads,
+                        std::size_t write_size = BUFSIZE) {
+  auto output = std::make_unique<backend::Memory_file>("");
+  const auto output_ptr = output.get();
+  mysqlshdk::storage::Compression_options options;
+  options.threads = threads;
+  auto file = mysqlshdk::storage::make_file(
+      std::move(output), mysqlshdk::storage::Compression::GZIP, options);
+
+  file->open(Mode::WRITE);
+
+  for (std::size_t offset = 0; offset < data.size(); offset += write_size) {
+    const auto length = std::min(write_size, data.size() - offset);
+    EXPECT_EQ(static_cast<ssize_t>(length),
+              file->write(data.data() + offset, length));
+  }
+
+  file->close();
+
+  return output_ptr->content();
+}
+
+std::string gz_decompress(const std::string &data) {
+  auto input = std::make_unique<backend::Memory_file>("");
+  input->set_content(data);
+  auto file = mysqlshdk::storage::make_file(
+      std::move(input), mysqlshdk::storage::Compression::GZIP);
+  std::string result;
+  byte buffer[BUFSIZE];
+
+  file->open(Mode::READ);
+
+  for (auto bytes = file->read(buffer, BUFSIZE); bytes > 0;
+       bytes = file->read(buffer, BUFSIZE)) {
+    result.append(buffer, bytes);
+  }
+
+  file->close();
+
+  return result;
+}
+
+}  // namespace
+
+TEST(Gz_file, multiple_members) {
+  Generate_text g;
+  const auto first = g.bytes(100000);
+  const auto second = g.bytes(200000);
+
+  // concatenated gzip files are a valid gzip file
+  EXPECT_EQ(first + second,
+            gz_decompress(gz_compress(first, 1) + gz_compress(second, 1)));
+  EXPECT_EQ(first, gz_decompress(gz_compress(first, 1) + gz_compress("", 1)));
+}
+
+TEST(Gz_file, parallel_compression) {
+  Generate_text g;
+
+  for (const std::size_t length :
+       {0, 1, 1000, 1024 * 1024, 5 * 1024 * 1024 + 7}) {
+    for (const std::size_t threads : {2, 4}) {
+      for (const std::size_t write_size : {std::size_t{1000}, BUFSIZE}) {
+        SCOPED_TRACE("length: " + std::to_string(length) +
+                     ", threads: " + std::to_string(threads) +
+                     ", write size: " + std::to_string(write_size));
+
+        const auto data = g.bytes(length).substr(0, length);
+        const auto compressed = gz_compress(data, threads, write_size);
+
+        // is gzip?
+        ASSERT_LE(2, compressed.size());
+        EXPECT_EQ(static_cast<std::string::value_type>(0x1f), compressed[0]);
+        EXPECT_EQ(static_cast<std::string::value_type>(0x8b), compressed[1]);
+
+        EXPECT_EQ(data, gz_decompress(compressed));
+      }
+    }
+  }
+}
+
 inline std::string fmt_compr(
     const testing::TestParamInfo<
         std::tuple<mysqlshdk::storage::Compression, std::string>> &info) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, 2021, Oracle and/or its affiliates.
+ * Copyright (c) 2020, 2023, Oracle and/or its affiliates.
  *
  * This program is free software; you can redistribute it and/or modify
  * it under the terms of the GNU General Public License, version 2.0,
@@ -23,6 +23,8 @@
 
 #include <memory>
 #include <random>
+#include <set>
+#include <string>
 #include <utility>
 #ifndef _WIN32
 #include <unistd.h>
@@ -31,6 +33,7 @@
 #include "unittest/gtest_clean.h"
 
 #include "mysqlshdk/libs/storage/backend/file.h"
+#include "mysqlshdk/libs/storage/idirectory.h"
 #include "mysqlshdk/libs/storage/ifile.h"
 #include "mysqlshdk/libs/utils/utils_file.h"
 #include "mysqlshdk/libs/utils/utils_path.h"
@@ -77,6 +80,36 @@ TEST(Storage, fprintf_off_by_1) {
   }
 }
 
+TEST(Storage, directory_for_each_file) {
+  const auto path = shcore::path::join_path(getenv("TMPDIR"), "for_each_file");
+  shcore::create_directory(path);
+
+  for (const auto name : {"actor.csv", "actor.json", "address.csv",
+                          "category.csv", "@.json"}) {
+    shcore::create_file(shcore::path::join_path(path, name), name);
+  }
+
+  const auto dir = make_directory(path);
+  std::set<std::string> names;
+  const auto collect = [&names](IDirectory::File_info &&file) {
+    EXPECT_EQ(file.name().length(), file.size());
+    EXPECT_TRUE(names.emplace(file.name()).second);
+  };
+
+  dir->for_each_file("a*.csv", collect);
+  EXPECT_EQ((std::set<std::string>{"actor.csv", "address.csv"}), names);
+
+  names.clear();
+  dir->for_each_file("*.json", collect);
+  EXPECT_EQ((std::set<std::string>{"@.json", "actor.json"}), names);
+
+  names.clear();
+  dir->for_each_file("unexisting*", collect);
+  EXPECT_TRUE(names.empty());
+
+  shcore::remove_directory(path);
+}
+
 #ifndef _WIN32
 TEST(Storage, file_mmap_option) {
   // mmap disabled by default even if requested
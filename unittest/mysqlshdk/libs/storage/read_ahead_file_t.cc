@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "unittest/gtest_clean.h"
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "mysqlshdk/libs/storage/backend/memory_file.h"
+#include "mysqlshdk/libs/storage/compressed_file.h"
+#include "mysqlshdk/libs/storage/read_ahead_file.h"
+
+namespace mysqlshdk {
+namespace storage {
+namespace tests {
+
+namespace {
+
+std::string test_data(std::size_t size) {
+  std::string data;
+  data.reserve(size);
+
+  for (std::size_t i = 0; data.size() < size; ++i) {
+    data += "row " + std::to_string(i) + "\tsome data\n";
+  }
+
+  data.resize(size);
+
+  return data;
+}
+
+std::unique_ptr<backend::Memory_file> memory_file(const std::string &content) {
+  auto file = std::make_unique<backend::Memory_file>("");
+  file->set_content(content);
+  return file;
+}
+
+std::string compress(const std::string &data, Compression c) {
+  auto output = std::make_unique<backend::Memory_file>("");
+  const auto output_ptr = output.get();
+  auto file = make_file(std::move(output), c);
+
+  file->open(Mode::WRITE);
+  file->write(data.data(), data.size());
+  file->close();
+
+  return output_ptr->content();
+}
+
+std::string read_all(IFile *file, std::size_t length,
+                     std::size_t *io_size = nullptr) {
+  std::string result;
+  std::string buffer;
+  buffer.resize(length);
+
+  const auto read_ahead = dynamic_cast<Read_ahead_file *>(file);
+
+  if (io_size) {
+    *io_size = 0;
+  }
+
+  while (true) {
+    const auto bytes = file->read(buffer.data(), length);
+
+    EXPECT_LE(0, bytes);
+
+    if (io_size && read_ahead) {
+      *io_size += read_ahead->latest_io_size();
+    }
+
+    if (bytes <= 0) {
+      break;
+    }
+
+    result.append(buffer.data(), bytes);
+  }
+
+  return result;
+}
+
+}  // namespace
+
+TEST(Read_ahead_file, invalid_arguments) {
+  EXPECT_THROW(Read_ahead_file(memory_file(""), 0), std::invalid_argument);
+  EXPECT_THROW(Read_ahead_file(memory_file(""), 1, 0), std::invalid_argument);
+
+  Read_ahead_file file{memory_file("")};
+
+  EXPECT_THROW(file.open(Mode::WRITE), std::invalid_argument);
+  EXPECT_THROW(file.open(Mode::APPEND), std::invalid_argument);
+  EXPECT_THROW(file.seek(0), std::logic_error);
+  EXPECT_THROW(file.write("a", 1), std::logic_error);
+}
+
+TEST(Read_ahead_file, empty_file) {
+  Read_ahead_file file{memory_file("")};
+  char buffer[16];
+
+  file.open(Mode::READ);
+  EXPECT_TRUE(file.is_open());
+  EXPECT_EQ(0, file.read(buffer, sizeof(buffer)));
+  EXPECT_EQ(0, file.read(buffer, sizeof(buffer)));
+  EXPECT_EQ(0, file.latest_io_size());
+  file.close();
+  EXPECT_FALSE(file.is_open());
+}
+
+TEST(Read_ahead_file, plain) {
+  const auto data = test_data(10000);
+
+  for (const auto block_size : {1, 7, 4096, 1024 * 1024}) {
+    for (const auto max_blocks : {1, 3}) {
+      SCOPED_TRACE("block size: " + std::to_string(block_size) +
+                   ", max blocks: " + std::to_string(max_blocks));
+
+      Read_ahead_file file{memory_file(data), static_cast<size_t>(block_size),
+                           static_cast<size_t>(max_blocks)};
+
+      for (const auto length : {1, 13, 65536}) {
+        std::size_t io_size = 0;
+
+        file.open(Mode::READ);
+        EXPECT_EQ(data, read_all(&file, length, &io_size));
+        EXPECT_EQ(data.size(), io_size);
+        file.close();
+      }
+    }
+  }
+}
+
+TEST(Read_ahead_file, close_before_eof) {
+  const auto data = test_data(100000);
+  Read_ahead_file file{memory_file(data), 100, 2};
+  char buffer[10];
+
+  // worker is blocked on a full queue, close() has to stop it
+  file.open(Mode::READ);
+  EXPECT_EQ(10, file.read(buffer, sizeof(buffer)));
+  EXPECT_EQ(data.substr(0, 10), std::string(buffer, sizeof(buffer)));
+  file.close();
+
+  // file can be read again from the beginning
+  file.open(Mode::READ);
+  EXPECT_EQ(data, read_all(&file, 1000));
+  file.close();
+}
+
+TEST(Read_ahead_file, compressed) {
+  const auto data = test_data(1000000);
+
+  for (const auto c : {Compression::GZIP, Compression::ZSTD}) {
+    SCOPED_TRACE(to_string(c));
+
+    const auto compressed = compress(data, c);
+
+    // reader stage, decompressor stage
+    Read_ahead_file file{
+        make_file(std::make_unique<Read_ahead_file>(memory_file(compressed),
+                                                    1000, 2),
+                  c),
+        4096, 2};
+    std::size_t io_size = 0;
+
+    EXPECT_TRUE(file.is_compressed());
+
+    file.open(Mode::READ);
+    EXPECT_EQ(data, read_all(&file, 5000, &io_size));
+    EXPECT_EQ(compressed.size(), io_size);
+    file.close();
+  }
+}
+
+TEST(Read_ahead_file, threads) {
+  const auto data = test_data(100000);
+  std::atomic<std::size_t> blocks{0};
+  Read_ahead_threads threads{[&blocks](const std::function<void()> &read) {
+    ++blocks;
+    read();
+  }};
+
+  EXPECT_EQ(0, threads.threads());
+
+  {
+    // thread is reused by the files which are read one after another
+    Read_ahead_file first{memory_file(data), threads, 1000, 2};
+    Read_ahead_file second{memory_file(data), threads, 1000, 2};
+
+    first.open(Mode::READ);
+    EXPECT_EQ(data, read_all(&first, 4096));
+    first.close();
+
+    second.open(Mode::READ);
+    EXPECT_EQ(data, read_all(&second, 4096));
+    second.close();
+
+    EXPECT_EQ(1, threads.threads());
+    // 100 blocks of data and the end of each file
+    EXPECT_EQ(2 * 101, blocks.load());
+  }
+
+  {
+    // files which are read at the same time use separate threads, file which
+    // is closed before its end is reached releases its thread
+    Read_ahead_file first{memory_file(data), threads, 100, 2};
+    Read_ahead_file second{memory_file(data), threads, 100, 2};
+    char buffer[10];
+
+    first.open(Mode::READ);
+    EXPECT_EQ(10, first.read(buffer, sizeof(buffer)));
+
+    second.open(Mode::READ);
+    EXPECT_EQ(data, read_all(&second, 4096));
+    second.close();
+
+    first.close();
+
+    EXPECT_EQ(2, threads.threads());
+
+    first.open(Mode::READ);
+    EXPECT_EQ(data, read_all(&first, 4096));
+    first.close();
+
+    EXPECT_EQ(2, threads.threads());
+  }
+
+  {
+    // decompression stage reads from the reader stage, both use the threads
+    const auto compressed = compress(data, Compression::ZSTD);
+    Read_ahead_file file{
+        make_file(std::make_unique<Read_ahead_file>(memory_file(compressed),
+                                                    threads, 1000, 2),
+                  Compression::ZSTD),
+        threads, 4096, 2};
+    std::size_t io_size = 0;
+
+    file.open(Mode::READ);
+    EXPECT_EQ(data, read_all(&file, 5000, &io_size));
+    EXPECT_EQ(compressed.size(), io_size);
+    file.close();
+
+    EXPECT_EQ(2, threads.threads());
+  }
+}
+
+}  // namespace tests
+}  // namespace storage
+}  // namespace mysqlshdk
@@ -20,10 +20,13 @@
    51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA */
 
 #include <algorithm>
+#include <atomic>
 #include <deque>
 #include <fstream>
 #include <memory>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "unittest/gtest_clean.h"
 #include "unittest/test_utils/mocks/gmock_clean.h"
@@ -252,6 +255,201 @@ TEST_F(Logger_test, log_format) {
   EXPECT_TRUE(tests.empty());
 }
 
+TEST_F(Logger_test, async_log) {
+  const auto name = get_log_file("mylog.txt");
+  shcore::on_leave_scope scope_leave([&name]() {
+    if (!shcore::is_folder(name)) {
+      shcore::delete_file(name);
+    }
+  });
+
+  mysqlsh::Scoped_logger logger(
+      Logger::create_instance(name.c_str(), false, Logger::LOG_INFO));
+
+  const auto l = current_logger();
+
+  // small buffer, writers are going to block
+  l->start_async(Logger::Overflow_policy::BLOCK, 16);
+  EXPECT_TRUE(l->is_async());
+
+  l->attach_log_hook(log_hook);
+
+  static constexpr int k_threads = 8;
+  static constexpr int k_entries = 1000;
+  std::vector<std::thread> threads;
+
+  for (int t = 0; t < k_threads; ++t) {
+    threads.emplace_back(mysqlsh::spawn_scoped_thread([t]() {
+      for (int e = 0; e < k_entries; ++e) {
+        log_info("thread %d entry %d", t, e);
+      }
+    }));
+  }
+
+  for (auto &t : threads) {
+    t.join();
+  }
+
+  l->detach_log_hook(log_hook);
+
+  // hooks are called synchronously
+  EXPECT_EQ(k_threads * k_entries, hook_executed());
+
+  l->flush();
+  EXPECT_EQ(0u, l->dropped_entries());
+
+  {
+    std::string contents;
+    EXPECT_TRUE(get_log_file_contents("mylog.txt", &contents));
+
+    EXPECT_EQ(k_threads * k_entries,
+              std::count(contents.begin(), contents.end(), '\n'));
+
+    for (int t = 0; t < k_threads; ++t) {
+      EXPECT_THAT(contents, ::testing::HasSubstr(shcore::str_format(
+                                "thread %d entry %d\n", t, k_entries - 1)));
+    }
+  }
+
+  l->stop_async();
+  EXPECT_FALSE(l->is_async());
+
+  l->log(Logger::LOG_WARNING, "synchronous entry");
+
+  {
+    std::string contents;
+    EXPECT_TRUE(get_log_file_contents("mylog.txt", &contents));
+    EXPECT_THAT(contents, ::testing::HasSubstr("synchronous entry\n"));
+  }
+}
+
+TEST_F(Logger_test, async_log_drop) {
+  const auto name = get_log_file("mylog.txt");
+  shcore::on_leave_scope scope_leave([&name]() {
+    if (!shcore::is_folder(name)) {
+      shcore::delete_file(name);
+    }
+  });
+
+  mysqlsh::Scoped_logger logger(
+      Logger::create_instance(name.c_str(), false, Logger::LOG_INFO));
+
+  const auto l = current_logger();
+
+  l->start_async(Logger::Overflow_policy::DROP, 2);
+
+  static constexpr int k_entries = 10000;
+
+  for (int e = 0; e < k_entries; ++e) {
+    l->log(Logger::LOG_INFO, "entry %d", e);
+  }
+
+  l->flush();
+
+  const auto dropped = l->dropped_entries();
+
+  // stopping writes out the information about the dropped entries
+  l->stop_async();
+
+  std::string contents;
+  EXPECT_TRUE(get_log_file_contents("mylog.txt", &contents));
+
+  uint64_t written = 0;
+
+  for (const auto &line : shcore::str_split(contents, "\n")) {
+    if (line.find(": Info: entry ") != std::string::npos) {
+      ++written;
+    }
+  }
+
+  EXPECT_EQ(static_cast<uint64_t>(k_entries), written + dropped);
+
+  if (dropped > 0) {
+    EXPECT_THAT(contents, ::testing::HasSubstr("log entries were dropped"));
+  }
+}
+
+TEST_F(Logger_test, async_log_stop) {
+  const auto name = get_log_file("mylog.txt");
+  shcore::on_leave_scope scope_leave([&name]() {
+    if (!shcore::is_folder(name)) {
+      shcore::delete_file(name);
+    }
+  });
+
+  mysqlsh::Scoped_logger logger(
+      Logger::create_instance(name.c_str(), false, Logger::LOG_INFO));
+
+  const auto l = current_logger();
+  const auto count_lines = [](const std::string &text) {
+    std::string contents;
+    EXPECT_TRUE(get_log_file_contents("mylog.txt", &contents));
+
+    int count = 0;
+
+    for (const auto &line : shcore::str_split(contents, "\n")) {
+      if (line.find(text) != std::string::npos) {
+        ++count;
+      }
+    }
+
+    return count;
+  };
+
+  static constexpr int k_entries = 1000;
+
+  {
+    // stop writes out all pending entries before it returns
+    l->start_async(Logger::Overflow_policy::BLOCK, 16);
+
+    for (int e = 0; e < k_entries; ++e) {
+      l->log(Logger::LOG_INFO, "before stop %d", e);
+    }
+
+    l->stop_async();
+
+    EXPECT_EQ(k_entries, count_lines("before stop"));
+  }
+
+  {
+    // entries logged while the asynchronous mode is stopped are not lost
+    l->start_async(Logger::Overflow_policy::BLOCK, 16);
+
+    static constexpr int k_threads = 8;
+    std::atomic<int> logged{0};
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < k_threads; ++t) {
+      threads.emplace_back(mysqlsh::spawn_scoped_thread([t, &logged]() {
+        for (int e = 0; e < k_entries; ++e) {
+          log_info("during stop %d %d", t, e);
+          ++logged;
+        }
+      }));
+    }
+
+    while (logged < k_entries) {
+      std::this_thread::yield();
+    }
+
+    l->stop_async();
+
+    for (auto &t : threads) {
+      t.join();
+    }
+
+    EXPECT_EQ(k_threads * k_entries, count_lines("during stop"));
+  }
+}
+
+TEST_F(Logger_test, parse_overflow_policy) {
+  EXPECT_EQ(Logger::Overflow_policy::BLOCK,
+            Logger::parse_overflow_policy("block"));
+  EXPECT_EQ(Logger::Overflow_policy::DROP,
+            Logger::parse_overflow_policy("DROP"));
+  EXPECT_THROW(Logger::parse_overflow_policy("wait"), std::invalid_argument);
+}
+
 #ifndef _WIN32
 // on Windows Logger is using OutputDebugString() instead of stderr
 
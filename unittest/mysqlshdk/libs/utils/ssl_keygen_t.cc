@@ -38,5 +38,26 @@ TEST(ssl, md5) {
   EXPECT_EQ(expected, restricted::md5(data.c_str(), data.length()));
 }
 
+TEST(ssl, sha256) {
+  const std::string data = "Welcome to Amazon S3.";
+  const auto expected = sha256(data.c_str(), data.length());
+  Sha256 hash;
+
+  for (const auto &c : data) {
+    hash.update(&c, 1);
+  }
+
+  EXPECT_EQ(expected, hash.finish());
+
+  // computation is restarted after it's finished
+  hash.update(data.c_str(), data.length());
+  EXPECT_EQ(expected, hash.finish());
+
+  hash.update("garbage", 7);
+  hash.reset();
+  hash.update(data.c_str(), data.length());
+  EXPECT_EQ(expected, hash.finish());
+}
+
 }  // namespace ssl
 }  // namespace shcore
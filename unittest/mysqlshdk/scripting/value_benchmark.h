@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef UNITTEST_MYSQLSHDK_SCRIPTING_VALUE_BENCHMARK_H_
+#define UNITTEST_MYSQLSHDK_SCRIPTING_VALUE_BENCHMARK_H_
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "mysqlshdk/include/scripting/types.h"
+#include "unittest/test_utils/benchmark.h"
+
+namespace tests {
+
+/**
+ * Creates a document resembling the dump metadata files and AdminAPI status
+ * trees: maps with short keys, short strings and numbers.
+ */
+inline shcore::Value benchmark_document(int tables = 100) {
+  auto schema = shcore::make_dict();
+  schema->emplace("schema", "sakila");
+  schema->emplace("includesDdl", true);
+  schema->emplace("includesData", true);
+  schema->emplace("defaultCharacterSet", "utf8mb4");
+
+  auto list = shcore::make_array();
+
+  for (int i = 0; i < tables; ++i) {
+    auto table = shcore::make_dict();
+    table->emplace("table", "table_" + std::to_string(i));
+    table->emplace("engine", "InnoDB");
+    table->emplace("rows", static_cast<int64_t>(i) * 1000);
+    table->emplace("chunked", 0 == i % 2);
+    table->emplace("compression", "zstd");
+
+    auto columns = shcore::make_array();
+
+    for (const auto column : {"id", "name", "created", "updated", "data"}) {
+      columns->emplace_back(column);
+    }
+
+    table->emplace("columns", std::move(columns));
+    list->emplace_back(std::move(table));
+  }
+
+  schema->emplace("tables", std::move(list));
+
+  return shcore::Value(std::move(schema));
+}
+
+}  // namespace tests
+
+#endif  // UNITTEST_MYSQLSHDK_SCRIPTING_VALUE_BENCHMARK_H_
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <gtest_clean.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "mysqlshdk/include/scripting/types.h"
+#include "mysqlshdk/include/scripting/types_cpp.h"
+#include "unittest/mysqlshdk/scripting/test_option_packs.h"
+#include "unittest/mysqlshdk/scripting/value_benchmark.h"
+
+namespace tests {
+
+TEST(Value_benchmark, DISABLED_benchmark_json_parse) {
+  const auto json = benchmark_document().json();
+
+  benchmark("JSON parse", 1000,
+            [&json]() { EXPECT_TRUE(shcore::Value::parse(json)); });
+}
+
+TEST(Value_benchmark, DISABLED_benchmark_json_serialize) {
+  const auto document = benchmark_document();
+
+  benchmark("JSON serialize", 1000,
+            [&document]() { EXPECT_FALSE(document.json().empty()); });
+}
+
+TEST(Value_benchmark, DISABLED_benchmark_repr) {
+  const auto document = benchmark_document();
+
+  benchmark("repr round trip", 1000, [&document]() {
+    EXPECT_TRUE(shcore::Value::parse(document.repr()));
+  });
+}
+
+TEST(Value_benchmark, DISABLED_benchmark_map_lookup) {
+  const auto tables = benchmark_document().as_map()->get_array("tables");
+
+  benchmark("map lookup", 10000, [&tables]() {
+    int64_t rows = 0;
+
+    for (const auto &table : *tables) {
+      const auto map = table.as_map();
+
+      if (map->get_bool("chunked")) {
+        rows += map->get_int("rows");
+      }
+    }
+
+    EXPECT_LT(0, rows);
+  });
+}
+
+TEST(Value_benchmark, DISABLED_benchmark_map_insert) {
+  std::vector<std::string> keys;
+
+  for (int i = 0; i < 10000; ++i) {
+    keys.emplace_back("key_" + std::to_string(i));
+  }
+
+  std::shuffle(keys.begin(), keys.end(), std::mt19937{});
+
+  benchmark("map insert, unordered keys", 100, [&keys]() {
+    shcore::Value::Map_type map;
+
+    for (const auto &key : keys) {
+      map[key] = shcore::Value(1);
+    }
+
+    EXPECT_EQ(keys.size(), map.size());
+  });
+
+  benchmark("map builder, unordered keys", 100, [&keys]() {
+    shcore::Value::Map_type::Builder builder(keys.size());
+
+    for (const auto &key : keys) {
+      builder.emplace(key, shcore::Value(1));
+    }
+
+    EXPECT_EQ(keys.size(), builder.build()->size());
+  });
+}
+
+TEST(Value_benchmark, DISABLED_benchmark_option_unpacking) {
+  benchmark("option unpacking", 100000, []() {
+    auto dict = shcore::make_dict();
+    dict->set("myString", shcore::Value("Some Value"));
+    dict->set("myPString", shcore::Value("Parent Value"));
+    dict->set("myAString", shcore::Value("Some Aggregated Value"));
+    dict->set("myIndirect", shcore::Value("Indirect Value"));
+    dict->set("myPIndirect", shcore::Value("Indirect Value"));
+
+    Sample_options options;
+    Sample_options::options().unpack(dict, &options);
+
+    EXPECT_TRUE(options.done_called);
+  });
+}
+
+}  // namespace tests
@@ -0,0 +1,145 @@
+//@<> Setup
+// inserts which do not fit into a single X protocol message are split into
+// multiple batches, each one smaller than mysqlx_max_allowed_packet
+const schema_name = "batched_insert";
+const max_allowed_packet = 2048;
+const total_rows = 200;
+const payload = "x".repeat(100);
+
+shell.connect(__mysqluripwd);
+const original_max_allowed_packet = session.runSql("SELECT @@GLOBAL.mysqlx_max_allowed_packet").fetchOne()[0];
+session.runSql("SET GLOBAL mysqlx_max_allowed_packet = ?", [max_allowed_packet]);
+
+// limit is read by the new session
+var xsession = mysqlx.getSession(__uripwd);
+EXPECT_EQ(max_allowed_packet, xsession.runSql("SELECT @@mysqlx_max_allowed_packet").fetchOne()[0]);
+
+xsession.dropSchema(schema_name);
+var schema = xsession.createSchema(schema_name);
+
+function id(i) {
+  return "doc-" + String(i).padStart(4, "0");
+}
+
+function documents(with_ids) {
+  const docs = [];
+
+  for (let i = 0; i < total_rows; ++i) {
+    const doc = { index: i, payload: payload };
+
+    if (with_ids) {
+      doc._id = id(i);
+    }
+
+    docs.push(doc);
+  }
+
+  // all rows would not fit into a single message
+  EXPECT_TRUE(JSON.stringify(docs).length > 10 * max_allowed_packet);
+
+  return docs;
+}
+
+//@<> CollectionAdd - generated IDs {VER(>=8.0.11)}
+var collection = schema.createCollection("generated");
+var result = collection.add(documents(false)).execute();
+
+EXPECT_EQ(total_rows, result.affectedItemsCount);
+EXPECT_EQ(total_rows, result.getAffectedItemsCount());
+EXPECT_EQ(total_rows, collection.count());
+
+var ids = result.getGeneratedIds();
+EXPECT_EQ(total_rows, ids.length);
+EXPECT_EQ(total_rows, new Set(ids).size);
+
+// IDs are reported in the order of the documents
+for (const i of [0, 1, total_rows / 2, total_rows - 1]) {
+  EXPECT_EQ(i, collection.find("_id = :id").bind("id", ids[i]).execute().fetchOne().index, `document #${i}`);
+}
+
+//@<> CollectionAdd - explicit IDs
+var collection = schema.createCollection("explicit");
+var result = collection.add(documents(true)).execute();
+
+EXPECT_EQ(total_rows, result.getAffectedItemsCount());
+EXPECT_EQ(0, result.getGeneratedIds().length);
+EXPECT_EQ(total_rows, collection.count());
+EXPECT_EQ(total_rows - 1, collection.getOne(id(total_rows - 1)).index);
+
+//@<> CollectionAdd - error in one of the batches
+var collection = schema.createCollection("error");
+collection.add({ _id: id(total_rows / 2), index: -1 }).execute();
+
+EXPECT_THROWS(function() {
+  collection.add(documents(true)).execute();
+}, "Document contains a field value that is not unique but required to be");
+
+// batches sent before the failing one were executed, the following ones were
+// not, failing batch was rolled back
+EXPECT_NE(null, collection.getOne(id(0)));
+EXPECT_EQ(null, collection.getOne(id(total_rows - 1)));
+EXPECT_EQ(-1, collection.getOne(id(total_rows / 2)).index);
+
+var inserted = collection.count() - 1;
+EXPECT_TRUE(inserted > 0 && inserted < total_rows / 2, `inserted: ${inserted}`);
+
+// session is still usable
+EXPECT_EQ(1, xsession.runSql("SELECT 1").fetchOne()[0]);
+
+//@<> CollectionAdd - error in one of the batches, transaction
+var collection = schema.createCollection("error_trx");
+collection.add({ _id: id(total_rows / 2), index: -1 }).execute();
+
+xsession.startTransaction();
+
+EXPECT_THROWS(function() {
+  collection.add(documents(true)).execute();
+}, "Document contains a field value that is not unique but required to be");
+
+xsession.rollback();
+
+EXPECT_EQ(1, collection.count());
+
+//@<> TableInsert
+xsession.sql(`CREATE TABLE \`${schema_name}\`.data (id INT AUTO_INCREMENT PRIMARY KEY, payload VARCHAR(200))`).execute();
+var table = schema.getTable("data");
+
+var insert = table.insert(["payload"]);
+
+for (let i = 0; i < total_rows; ++i) {
+  insert = insert.values(payload + i);
+}
+
+var result = insert.execute();
+
+EXPECT_EQ(total_rows, result.affectedItemsCount);
+EXPECT_EQ(total_rows, result.getAffectedItemsCount());
+// value generated for the first row
+EXPECT_EQ(1, result.autoIncrementValue);
+EXPECT_EQ(total_rows, table.count());
+EXPECT_EQ(payload + (total_rows - 1), table.select(["payload"]).where("id = :id").bind("id", total_rows).execute().fetchOne()[0]);
+
+//@<> TableInsert - warnings from all batches are reported
+xsession.sql(`CREATE TABLE \`${schema_name}\`.warnings (id INT AUTO_INCREMENT PRIMARY KEY, payload VARCHAR(200), value TINYINT)`).execute();
+xsession.runSql("SET @@SESSION.sql_mode = ''");
+var table = schema.getTable("warnings");
+
+var insert = table.insert(["payload", "value"]);
+
+for (let i = 0; i < total_rows; ++i) {
+  insert = insert.values(payload, 1000);
+}
+
+var result = insert.execute();
+
+EXPECT_EQ(total_rows, result.getAffectedItemsCount());
+EXPECT_EQ(total_rows, result.getWarningsCount());
+EXPECT_EQ(total_rows, result.getWarnings().length);
+EXPECT_EQ(1264, result.getWarnings()[total_rows - 1].code);
+
+//@<> Cleanup
+xsession.dropSchema(schema_name);
+xsession.close();
+
+session.runSql("SET GLOBAL mysqlx_max_allowed_packet = ?", [original_max_allowed_packet]);
+session.close();
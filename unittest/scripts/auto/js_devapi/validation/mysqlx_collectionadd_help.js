@@ -81,6 +81,11 @@ SYNTAX
 RETURNS
       A Result object.
 
+DESCRIPTION
+      If the operation is too big to be sent to the server in a single message,
+      it is split into multiple statements, which are not executed atomically
+      unless the operation is executed in a transaction.
+
 //@<OUT> Help on help
 NAME
       help - Provides help about this class and it's members
@@ -42,6 +42,9 @@ FUNCTIONS
             Returns a list of DbDoc objects which contains an element for every
             unread document.
 
+      fetchAllColumns()
+            Returns all records left on the result, in a columnar format.
+
       fetchOne()
             Retrieves the next Row on the RowResult.
 
@@ -33,6 +33,11 @@ RETURNS
       A Result object that can be used to retrieve the results of the
       operation.
 
+DESCRIPTION
+      If the operation is too big to be sent to the server in a single message,
+      it is split into multiple statements, which are not executed atomically
+      unless the operation is executed in a transaction.
+
 //@<OUT> Help on help
 NAME
       help - Provides help about this class and it's members
@@ -0,0 +1,211 @@
+//@<> Setup
+const schema_name = "fetch_all_columns";
+const table_name = "data";
+const columns = [
+  { name: "i", type: "Integer", format: "l" },
+  { name: "u", type: "UInteger", format: "L" },
+  { name: "f", type: "Float", format: "f" },
+  { name: "d", type: "Double", format: "g" },
+  { name: "s", type: "String", format: "U" },
+  { name: "b", type: "Bytes", format: "Z" },
+  { name: "n", type: "Decimal", format: "U" },
+  { name: "bt", type: "Bit", format: "L" },
+];
+
+// 9 rows, validity bitmap spans two bytes, rows #2 and #9 are NULL
+const rows = [
+  [-1, 1, 0.5, 0.25, "a", [0x00], "1.50", 1],
+  [null, null, null, null, null, null, null, null],
+  [-3, 3, 1.5, 2.25, "", [], "-3.00", 3],
+  [-4, 4294967295, -2.5, 1e100, "abcd", [0xFF, 0x00, 0x01], "999.99", 255],
+];
+
+for (let k = 5; k <= 8; ++k) {
+  rows.push([-k, k, k + 0.5, k + 0.25, "x".repeat(k), [k], `${k}.00`, k]);
+}
+
+rows.push([null, null, null, null, null, null, null, null]);
+
+function literal(value, index) {
+  if (null === value) {
+    return "NULL";
+  }
+
+  switch (columns[index].format) {
+    case "U":
+      return `'${value}'`;
+
+    case "Z":
+      return "x'" + value.map(b => b.toString(16).padStart(2, "0")).join("") + "'";
+
+    default:
+      return `${value}`;
+  }
+}
+
+function is_valid(column, index) {
+  return 1 === ((new Uint8Array(column.validity)[index >> 3] >> (index & 7)) & 1);
+}
+
+function decode(column) {
+  let values;
+
+  switch (column.format) {
+    case "l":
+      values = Array.from(new BigInt64Array(column.data), Number);
+      break;
+
+    case "L":
+      values = Array.from(new BigUint64Array(column.data), Number);
+      break;
+
+    case "f":
+      values = Array.from(new Float32Array(column.data));
+      break;
+
+    case "g":
+      values = Array.from(new Float64Array(column.data));
+      break;
+
+    case "U":
+    case "Z": {
+      const offsets = Array.from(new BigInt64Array(column.offsets), Number);
+      EXPECT_EQ(column.length + 1, offsets.length, `${column.name}: offsets`);
+      EXPECT_EQ(0, offsets[0], `${column.name}: first offset`);
+      EXPECT_EQ(column.data.byteLength, offsets[offsets.length - 1], `${column.name}: last offset`);
+
+      values = [];
+
+      for (let i = 0; i < column.length; ++i) {
+        const bytes = Array.from(new Uint8Array(column.data, offsets[i], offsets[i + 1] - offsets[i]));
+        values.push("U" === column.format ? String.fromCharCode(...bytes) : bytes);
+      }
+      break;
+    }
+  }
+
+  EXPECT_EQ(column.length, values.length, `${column.name}: number of values`);
+
+  return values.map((v, i) => is_valid(column, i) ? v : null);
+}
+
+function expected_values(index, first_row) {
+  return rows.slice(first_row).map(r => r[index]);
+}
+
+function check_columns(result, first_row) {
+  const length = rows.length - first_row;
+
+  EXPECT_EQ(length, result.length);
+  EXPECT_EQ(columns.length, result.columns.length);
+
+  for (let i = 0; i < columns.length; ++i) {
+    const expected = columns[i];
+    const actual = result.columns[i];
+    const values = expected_values(i, first_row);
+
+    EXPECT_EQ(expected.name, actual.name);
+    EXPECT_EQ(expected.type, actual.type, expected.name);
+    EXPECT_EQ(expected.format, actual.format, expected.name);
+    EXPECT_EQ(length, actual.length, expected.name);
+    EXPECT_EQ(values.filter(v => null === v).length, actual.nullCount, expected.name);
+    EXPECT_EQ("ArrayBuffer", String(type(actual.validity)), expected.name);
+    EXPECT_EQ(Math.ceil(length / 8), actual.validity.byteLength, expected.name);
+    EXPECT_EQ("ArrayBuffer", String(type(actual.data)), expected.name);
+
+    if ("U" === expected.format || "Z" === expected.format) {
+      EXPECT_EQ("ArrayBuffer", String(type(actual.offsets)), expected.name);
+    } else {
+      EXPECT_FALSE("offsets" in actual, expected.name);
+      // NULL values also occupy a slot in the data buffer
+      EXPECT_EQ(length * ("f" === expected.format ? 4 : 8), actual.data.byteLength, expected.name);
+    }
+
+    EXPECT_EQ(values, decode(actual), expected.name);
+  }
+}
+
+shell.connect(__mysqluripwd);
+const qualified_table_name = `\`${schema_name}\`.\`${table_name}\``;
+
+session.runSql(`DROP SCHEMA IF EXISTS \`${schema_name}\``);
+session.runSql(`CREATE SCHEMA \`${schema_name}\``);
+session.runSql(`CREATE TABLE ${qualified_table_name} (id INT PRIMARY KEY, i INT, u INT UNSIGNED, f FLOAT, d DOUBLE, s VARCHAR(10), b VARBINARY(10), n DECIMAL(5,2), bt BIT(8))`);
+
+for (let r = 0; r < rows.length; ++r) {
+  session.runSql(`INSERT INTO ${qualified_table_name} VALUES (${r + 1}, ${rows[r].map(literal).join(", ")})`);
+}
+
+const query = `SELECT ${columns.map(c => c.name).join(", ")} FROM ${qualified_table_name} ORDER BY id`;
+
+//@<> validity bitmap
+var result = session.runSql(query).fetchAllColumns();
+
+for (const column of result.columns) {
+  EXPECT_EQ([0xFD, 0x00], Array.from(new Uint8Array(column.validity)), column.name);
+}
+
+//@<> ClassicResult
+check_columns(session.runSql(query).fetchAllColumns(), 0);
+
+//@<> ClassicResult - remaining rows
+var res = session.runSql(query);
+res.fetchOne();
+res.fetchOne();
+check_columns(res.fetchAllColumns(), 2);
+
+//@<> ClassicResult - all rows were already fetched
+var res = session.runSql(query);
+res.fetchAll();
+var result = res.fetchAllColumns();
+EXPECT_EQ(0, result.length);
+EXPECT_EQ(columns.length, result.columns.length);
+
+//@<> ClassicResult - empty result
+var result = session.runSql(query.replace("ORDER BY", "WHERE id < 0 ORDER BY")).fetchAllColumns();
+EXPECT_EQ(0, result.length);
+EXPECT_EQ(columns.length, result.columns.length);
+
+for (const column of result.columns) {
+  EXPECT_EQ(0, column.length, column.name);
+  EXPECT_EQ(0, column.nullCount, column.name);
+  EXPECT_EQ(0, column.validity.byteLength, column.name);
+  EXPECT_EQ(0, column.data.byteLength, column.name);
+
+  if ("offsets" in column) {
+    EXPECT_EQ([0], Array.from(new BigInt64Array(column.offsets), Number), column.name);
+  }
+}
+
+//@<> ClassicResult - no result set
+var result = session.runSql("SET @a = 1").fetchAllColumns();
+EXPECT_EQ(0, result.length);
+EXPECT_EQ([], result.columns);
+
+//@<> SqlResult
+shell.connect(__uripwd);
+check_columns(session.runSql(query).fetchAllColumns(), 0);
+
+//@<> SqlResult - remaining rows
+var res = session.runSql(query);
+res.fetchOne();
+res.fetchOne();
+check_columns(res.fetchAllColumns(), 2);
+
+//@<> SqlResult - empty result
+var result = session.runSql(query.replace("ORDER BY", "WHERE id < 0 ORDER BY")).fetchAllColumns();
+EXPECT_EQ(0, result.length);
+EXPECT_EQ(columns.length, result.columns.length);
+
+//@<> RowResult
+var table = session.getSchema(schema_name).getTable(table_name);
+check_columns(table.select(columns.map(c => c.name)).orderBy("id").execute().fetchAllColumns(), 0);
+
+//@<> RowResult - empty result
+var result = table.select(columns.map(c => c.name)).where("id < 0").execute().fetchAllColumns();
+EXPECT_EQ(0, result.length);
+EXPECT_EQ(columns.length, result.columns.length);
+
+//@<> Cleanup
+session.runSql(`DROP SCHEMA IF EXISTS \`${schema_name}\``);
+session.close();
@@ -59,6 +59,9 @@ FUNCTIONS
             Returns a list of Row objects which contains an element for every
             record left on the result.
 
+      fetchAllColumns()
+            Returns all records left on the result, in a columnar format.
+
       fetchOne()
             Retrieves the next Row on the ClassicResult.
 
@@ -156,6 +156,13 @@ Usage: mysqlsh [OPTIONS] [URI]
                                    interactive mode processing. Each line on
                                    the batch is processed as if it were in
                                    interactive mode.
+  --log-async[=block|drop]         Write the Shell log file using a background
+                                   thread, so that threads which log do not
+                                   wait for the disk I/O. When the log buffer
+                                   is full, block (default) - waits for the
+                                   space in the buffer; drop - discards the
+                                   entry and reports number of dropped entries
+                                   in the log file.
   --force                          In SQL batch mode, forces processing to
                                    continue if an error is found.
   --log-file=<path>                Override location of the Shell log file.
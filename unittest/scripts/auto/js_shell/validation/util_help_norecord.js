@@ -276,6 +276,9 @@ DESCRIPTION
         no limit.
       - showProgress: bool (default: true if stdout is a TTY device, false
         otherwise) - Enable or disable copy progress information.
+      - metricsFile: string (default: not set) - Path to a local file which is
+        periodically replaced with the current metrics of the copy, in the
+        Prometheus text format.
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
         for the copy.
       - analyzeTables: "off", "on", "histogram" (default: off) - If 'on',
@@ -399,6 +402,9 @@ DESCRIPTION
         no limit.
       - showProgress: bool (default: true if stdout is a TTY device, false
         otherwise) - Enable or disable copy progress information.
+      - metricsFile: string (default: not set) - Path to a local file which is
+        periodically replaced with the current metrics of the copy, in the
+        Prometheus text format.
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
         for the copy.
       - analyzeTables: "off", "on", "histogram" (default: off) - If 'on',
@@ -511,6 +517,9 @@ DESCRIPTION
         no limit.
       - showProgress: bool (default: true if stdout is a TTY device, false
         otherwise) - Enable or disable copy progress information.
+      - metricsFile: string (default: not set) - Path to a local file which is
+        periodically replaced with the current metrics of the copy, in the
+        Prometheus text format.
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
         for the copy.
       - analyzeTables: "off", "on", "histogram" (default: off) - If 'on',
@@ -679,6 +688,9 @@ DESCRIPTION
         no limit.
       - showProgress: bool (default: true if stdout is a TTY device, false
         otherwise) - Enable or disable dump progress information.
+      - metricsFile: string (default: not set) - Path to a local file which is
+        periodically replaced with the current metrics of the dump, in the
+        Prometheus text format.
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
         for the dump.
       - compression: string (default: "zstd") - Compression used when writing
@@ -1316,6 +1328,9 @@ DESCRIPTION
         no limit.
       - showProgress: bool (default: true if stdout is a TTY device, false
         otherwise) - Enable or disable dump progress information.
+      - metricsFile: string (default: not set) - Path to a local file which is
+        periodically replaced with the current metrics of the dump, in the
+        Prometheus text format.
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
         for the dump.
       - compression: string (default: "zstd") - Compression used when writing
@@ -1930,6 +1945,9 @@ DESCRIPTION
         no limit.
       - showProgress: bool (default: true if stdout is a TTY device, false
         otherwise) - Enable or disable dump progress information.
+      - metricsFile: string (default: not set) - Path to a local file which is
+        periodically replaced with the current metrics of the dump, in the
+        Prometheus text format.
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
         for the dump.
       - compression: string (default: "zstd") - Compression used when writing
@@ -2477,6 +2495,13 @@ DESCRIPTION
       - partitions: list of strings (default: not set) - A list of valid
         partition names used to limit the data export to just the specified
         partitions.
+      - threads: int (default: 1) - Use N threads to export data chunks from the
+        server. If greater than 1, enables chunking.
+      - bytesPerChunk: string (default: "64M") - Sets average estimated number
+        of bytes to be written to each data chunk, used if chunking is enabled.
+      - splitOutput: bool (default: false) - If enabled, enables chunking and
+        writes each data chunk to a separate, numbered file instead of merging
+        them into the output file.
       - fieldsTerminatedBy: string (default: "\t") - This option has the same
         meaning as the corresponding clause for SELECT ... INTO OUTFILE.
       - fieldsEnclosedBy: char (default: '') - This option has the same meaning
@@ -2500,6 +2525,9 @@ DESCRIPTION
         no limit.
       - showProgress: bool (default: true if stdout is a TTY device, false
         otherwise) - Enable or disable dump progress information.
+      - metricsFile: string (default: not set) - Path to a local file which is
+        periodically replaced with the current metrics of the dump, in the
+        Prometheus text format.
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
         for the dump.
       - compression: string (default: "none") - Compression used when writing
@@ -2573,6 +2601,16 @@ DESCRIPTION
 
       i.e. maxRate="2k" - limit throughput to 2000 bytes per second.
 
+      If chunking is enabled, table data is divided into chunks using the same
+      logic as the dump utilities, and each chunk is written to a separate file
+      in the directory containing the output file. Unless splitOutput is
+      enabled, once all chunks are written, they are merged into the output file
+      and removed. If splitOutput is enabled, files are named after the output
+      file, i.e. if outputUrl is "out.csv", files "out@0.csv", "out@1.csv", ...
+      are written.
+
+      The value of the bytesPerChunk option cannot be smaller than "128k".
+
       Dumping to a Bucket in the OCI Object Storage
 
       There are 2 ways to create a dump in OCI Object Storage:
@@ -3430,6 +3468,9 @@ DESCRIPTION
         stored in the dump files, i.e. binary log file name and position.
       - showProgress: bool (default: true if stdout is a tty, false otherwise)
         - Enable or disable import progress information.
+      - metricsFile: string (default: not set) - Path to a local file which is
+        periodically replaced with the current metrics of the load, in the
+        Prometheus text format.
       - skipBinlog: bool (default: false) - Disables the binary log for the
         MySQL sessions used by the loader (set sql_log_bin=0).
       - threads: int (default: 4) - Number of threads to use to import table
@@ -849,6 +849,9 @@ FUNCTIONS
             Returns a list of DbDoc objects which contains an element for every
             unread document.
 
+      fetch_all_columns()
+            Returns all records left on the result, in a columnar format.
+
       fetch_one()
             Retrieves the next Row on the RowResult.
 
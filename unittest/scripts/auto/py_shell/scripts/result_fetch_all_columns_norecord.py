@@ -0,0 +1,166 @@
+#@<> Setup
+import struct
+
+schema_name = "fetch_all_columns"
+table_name = "data"
+qualified_table_name = f"`{schema_name}`.`{table_name}`"
+columns = [
+    {"name": "i", "type": "Integer", "format": "l"},
+    {"name": "u", "type": "UInteger", "format": "L"},
+    {"name": "f", "type": "Float", "format": "f"},
+    {"name": "d", "type": "Double", "format": "g"},
+    {"name": "s", "type": "String", "format": "U"},
+    {"name": "b", "type": "Bytes", "format": "Z"},
+    {"name": "n", "type": "Decimal", "format": "U"},
+    {"name": "bt", "type": "Bit", "format": "L"},
+]
+
+# native byte order, standard sizes
+struct_formats = {"l": "q", "L": "Q", "f": "f", "g": "d"}
+
+# 9 rows, validity bitmap spans two bytes, rows #2 and #9 are NULL
+rows = [
+    [-1, 1, 0.5, 0.25, "a", b"\x00", "1.50", 1],
+    [None] * len(columns),
+    [-3, 3, 1.5, 2.25, "", b"", "-3.00", 3],
+    [-4, 18446744073709551615, -2.5, 1e100, "żółw", b"\xff\x00\x01", "999.99", 255],
+]
+
+for k in range(5, 9):
+    rows.append([-k, k, k + 0.5, k + 0.25, "x" * k, bytes([k]), f"{k}.00", k])
+
+rows.append([None] * len(columns))
+
+def literal(value, index):
+    if value is None:
+        return "NULL"
+    fmt = columns[index]["format"]
+    if fmt == "U":
+        return f"'{value}'"
+    if fmt == "Z":
+        return f"x'{value.hex()}'"
+    return str(value)
+
+def is_valid(column, index):
+    return 1 == ((column["validity"][index >> 3] >> (index & 7)) & 1)
+
+def decode(column):
+    name = column["name"]
+    fmt = column["format"]
+    length = column["length"]
+    data = column["data"]
+    if fmt in struct_formats:
+        values = list(struct.unpack(f"={length}{struct_formats[fmt]}", data))
+    else:
+        offsets = struct.unpack(f"={length + 1}q", column["offsets"])
+        EXPECT_EQ(0, offsets[0], f"{name}: first offset")
+        EXPECT_EQ(len(data), offsets[-1], f"{name}: last offset")
+        values = [data[offsets[i]:offsets[i + 1]] for i in range(length)]
+        if fmt == "U":
+            values = [v.decode("utf-8") for v in values]
+    EXPECT_EQ(length, len(values), f"{name}: number of values")
+    return [v if is_valid(column, i) else None for i, v in enumerate(values)]
+
+def check_columns(result, first_row):
+    length = len(rows) - first_row
+    EXPECT_EQ(length, result["length"])
+    EXPECT_EQ(len(columns), len(result["columns"]))
+    for i, expected in enumerate(columns):
+        name = expected["name"]
+        actual = result["columns"][i]
+        values = [r[i] for r in rows[first_row:]]
+        EXPECT_EQ(name, actual["name"])
+        EXPECT_EQ(expected["type"], actual["type"], name)
+        EXPECT_EQ(expected["format"], actual["format"], name)
+        EXPECT_EQ(length, actual["length"], name)
+        EXPECT_EQ(values.count(None), actual["nullCount"], name)
+        EXPECT_TRUE(isinstance(actual["validity"], bytes), name)
+        EXPECT_EQ((length + 7) // 8, len(actual["validity"]), name)
+        EXPECT_TRUE(isinstance(actual["data"], bytes), name)
+        if expected["format"] in struct_formats:
+            EXPECT_FALSE("offsets" in actual, name)
+            # NULL values also occupy a slot in the data buffer
+            EXPECT_EQ(length * struct.calcsize("=" + struct_formats[expected["format"]]), len(actual["data"]), name)
+        else:
+            EXPECT_TRUE(isinstance(actual["offsets"], bytes), name)
+            EXPECT_EQ((length + 1) * 8, len(actual["offsets"]), name)
+        EXPECT_EQ(values, decode(actual), name)
+
+shell.connect(__mysqluripwd)
+session.run_sql(f"DROP SCHEMA IF EXISTS `{schema_name}`")
+session.run_sql(f"CREATE SCHEMA `{schema_name}`")
+session.run_sql(f"CREATE TABLE {qualified_table_name} (id INT PRIMARY KEY, i BIGINT, u BIGINT UNSIGNED, f FLOAT, d DOUBLE, s VARCHAR(10), b VARBINARY(10), n DECIMAL(5,2), bt BIT(8)) CHARSET utf8mb4")
+
+for r, row in enumerate(rows):
+    session.run_sql(f"INSERT INTO {qualified_table_name} VALUES ({r + 1}, {', '.join(literal(v, i) for i, v in enumerate(row))})")
+
+query = f"SELECT {', '.join(c['name'] for c in columns)} FROM {qualified_table_name} ORDER BY id"
+empty_query = query.replace("ORDER BY", "WHERE id < 0 ORDER BY")
+
+#@<> validity bitmap
+result = session.run_sql(query).fetch_all_columns()
+
+for column in result["columns"]:
+    EXPECT_EQ(b"\xfd\x00", column["validity"], column["name"])
+
+#@<> ClassicResult
+check_columns(session.run_sql(query).fetch_all_columns(), 0)
+
+#@<> ClassicResult - remaining rows
+res = session.run_sql(query)
+res.fetch_one()
+res.fetch_one()
+check_columns(res.fetch_all_columns(), 2)
+
+#@<> ClassicResult - all rows were already fetched
+res = session.run_sql(query)
+res.fetch_all()
+result = res.fetch_all_columns()
+EXPECT_EQ(0, result["length"])
+EXPECT_EQ(len(columns), len(result["columns"]))
+
+#@<> ClassicResult - empty result
+result = session.run_sql(empty_query).fetch_all_columns()
+EXPECT_EQ(0, result["length"])
+EXPECT_EQ(len(columns), len(result["columns"]))
+
+for column in result["columns"]:
+    EXPECT_EQ(0, column["length"], column["name"])
+    EXPECT_EQ(0, column["nullCount"], column["name"])
+    EXPECT_EQ(b"", column["validity"], column["name"])
+    EXPECT_EQ(b"", column["data"], column["name"])
+    if "offsets" in column:
+        EXPECT_EQ(struct.pack("=q", 0), column["offsets"], column["name"])
+
+#@<> ClassicResult - no result set
+result = session.run_sql("SET @a = 1").fetch_all_columns()
+EXPECT_EQ(0, result["length"])
+EXPECT_EQ(0, len(result["columns"]))
+
+#@<> SqlResult
+shell.connect(__uripwd)
+check_columns(session.run_sql(query).fetch_all_columns(), 0)
+
+#@<> SqlResult - remaining rows
+res = session.run_sql(query)
+res.fetch_one()
+res.fetch_one()
+check_columns(res.fetch_all_columns(), 2)
+
+#@<> SqlResult - empty result
+result = session.run_sql(empty_query).fetch_all_columns()
+EXPECT_EQ(0, result["length"])
+EXPECT_EQ(len(columns), len(result["columns"]))
+
+#@<> RowResult
+table = session.get_schema(schema_name).get_table(table_name)
+check_columns(table.select([c["name"] for c in columns]).order_by("id").execute().fetch_all_columns(), 0)
+
+#@<> RowResult - empty result
+result = table.select([c["name"] for c in columns]).where("id < 0").execute().fetch_all_columns()
+EXPECT_EQ(0, result["length"])
+EXPECT_EQ(len(columns), len(result["columns"]))
+
+#@<> Cleanup
+session.run_sql(f"DROP SCHEMA IF EXISTS `{schema_name}`")
+session.close()
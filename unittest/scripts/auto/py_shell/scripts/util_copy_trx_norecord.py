@@ -128,6 +128,21 @@ EXPECT_SHELL_LOG_CONTAINS("testdb@data1.tsv: Records: 1  Deleted: 0  Skipped: 0
 EXPECT_SHELL_LOG_CONTAINS("testdb@data2.tsv: Records: 382  Deleted: 0  Skipped: 0  Warnings: 0 - loading finished in 14 sub-chunks")
 EXPECT_SHELL_LOG_CONTAINS("testdb@data3.tsv: Records: 5  Deleted: 0  Skipped: 0  Warnings: 0")
 
+#@<> rows bigger than the transaction buffer are loaded
+wipeout_server(src_session)
+src_session.run_sql("create schema testdb")
+src_session.run_sql("create table testdb.data0 (txt longtext charset ascii)")
+src_session.run_sql("insert into testdb.data0 values (?)", ["1"+rand_text(100)])
+# rows which do not fit into an empty transaction buffer, loaded on their own
+src_session.run_sql("insert into testdb.data0 values (?)", ["2"+rand_text(max_bytes_per_trx*4)])
+src_session.run_sql("insert into testdb.data0 values (?)", ["3"+rand_text(max_bytes_per_trx*2)])
+src_session.run_sql("insert into testdb.data0 values (?)", ["4"+rand_text(100)])
+
+set_test_table_count(1)
+
+TEST_LOAD(trx_size_limit, trx_size_limit*10)
+EXPECT_SHELL_LOG_NOT_CONTAINS("Fast sub-chunking is only possible")
+
 #@<> impossible load: row too big
 
 # this table will generate a chunk with a row that's too big to be loaded
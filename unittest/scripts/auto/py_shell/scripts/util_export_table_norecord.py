@@ -11,6 +11,7 @@ import re
 import shutil
 import stat
 import urllib.parse
+import zlib
 
 # constants
 world_x_schema = "world_x_cities"
@@ -255,6 +256,19 @@ def get_magic_number(path, count):
 GZIP_MAGIC_NUMBER = "1F8B"
 ZSTD_MAGIC_NUMBER = "28B52FFD"
 
+def count_gzip_members(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    members = 0
+    while data:
+        d = zlib.decompressobj(wbits=31)
+        d.decompress(data)
+        if not d.eof:
+            raise Exception(f"Truncated gzip member in: {path}")
+        members += 1
+        data = d.unused_data
+    return members
+
 #@<> WL13804-FR2.1 - If there is no open global Shell session, an exception must be thrown. (no global session)
 # WL13804-TSFR_2_1_2
 EXPECT_FAIL("RuntimeError", "An open session is required to perform this operation.", quote('mysql', 'user'), test_output_relative)
@@ -1317,6 +1331,67 @@ session.run_sql("CREATE VIEW !.! AS SELECT * FROM !.!", [ schema_name, test_view
 TEST_LOAD(schema_name, test_view, source_table = no_partitions_table_name)
 TEST_LOAD(schema_name, test_view, { "where": "id > 12345" }, source_table = no_partitions_table_name)
 
+#@<> parallel export - options
+TEST_UINT_OPTION("threads")
+TEST_STRING_OPTION("bytesPerChunk")
+TEST_BOOL_OPTION("splitOutput")
+
+EXPECT_FAIL("ValueError", "Argument #3: The value of 'threads' option must be greater than 0.", quote(schema_name, no_partitions_table_name), test_output_absolute, { "threads": 0 })
+EXPECT_FAIL("ValueError", "Argument #3: The option 'bytesPerChunk' cannot be set to an empty string.", quote(schema_name, no_partitions_table_name), test_output_absolute, { "bytesPerChunk": "" })
+EXPECT_FAIL("ValueError", "Argument #3: The value of 'bytesPerChunk' option must be greater than or equal to 128k.", quote(schema_name, no_partitions_table_name), test_output_absolute, { "bytesPerChunk": "127k" })
+
+#@<> parallel export - chunks are merged into the output file
+for table in all_tables:
+    TEST_LOAD(schema_name, table, { "threads": 4, "bytesPerChunk": "128k" })
+    EXPECT_EQ(count_rows(schema_name, table), count_rows(verification_schema, verification_table))
+    EXPECT_EQ(1, len(os.listdir(test_output_absolute_parent)))
+
+TEST_LOAD(schema_name, partitions_table_name, { "threads": 4, "bytesPerChunk": "128k", "partitions": [ "x1", "x2" ] })
+EXPECT_EQ(1, len(os.listdir(test_output_absolute_parent)))
+
+TEST_LOAD(schema_name, no_partitions_table_name, { "threads": 4, "bytesPerChunk": "128k", "compression": "gzip" })
+EXPECT_EQ(GZIP_MAGIC_NUMBER, get_magic_number(test_output_absolute, 2))
+
+TEST_LOAD(schema_name, no_partitions_table_name, { "threads": 4, "bytesPerChunk": "128k", "compression": "zstd" })
+EXPECT_EQ(ZSTD_MAGIC_NUMBER, get_magic_number(test_output_absolute, 4))
+
+#@<> parallel export - gzip output of a single writer is compressed in parallel {os.cpu_count() > 1}
+# data is compressed by multiple threads, each one writing separate members
+TEST_LOAD(schema_name, no_partitions_table_name, { "compression": "gzip" })
+EXPECT_EQ(GZIP_MAGIC_NUMBER, get_magic_number(test_output_absolute, 2))
+EXPECT_LT(1, count_gzip_members(test_output_absolute))
+
+#@<> parallel export - splitOutput
+shutil.rmtree(test_output_absolute_parent, True)
+os.mkdir(test_output_absolute_parent)
+WIPE_STDOUT()
+util.export_table(quote(schema_name, no_partitions_table_name), test_output_absolute, { "threads": 4, "bytesPerChunk": "128k", "splitOutput": True, "showProgress": False })
+EXPECT_FALSE(os.path.isfile(test_output_absolute))
+EXPECT_LT(1, count_files_with_basename(test_output_absolute_parent, "data@"))
+EXPECT_STDOUT_CONTAINS("data@*.txt")
+
+recreate_verification_schema()
+session.run_sql("CREATE TABLE !.! LIKE !.!;", [verification_schema, verification_table, schema_name, no_partitions_table_name])
+util.import_table(os.path.join(test_output_absolute_parent, "data@*.txt"), { "schema": verification_schema, "table": verification_table, "characterSet": "utf8mb4", "columns": [ "id", "data" ], "decodeColumns": { "data": "FROM_BASE64" }, "showProgress": False })
+EXPECT_EQ(md5_table(session, schema_name, no_partitions_table_name), md5_table(session, verification_schema, verification_table))
+
+#@<> parallel export - each partition is chunked
+shutil.rmtree(test_output_absolute_parent, True)
+os.mkdir(test_output_absolute_parent)
+util.export_table(quote(schema_name, partitions_table_name), test_output_absolute, { "threads": 4, "bytesPerChunk": "128k", "splitOutput": True, "partitions": [ "x1", "x2" ], "showProgress": False })
+EXPECT_LT(1, count_files_with_basename(test_output_absolute_parent, "data@0@"))
+EXPECT_LT(1, count_files_with_basename(test_output_absolute_parent, "data@1@"))
+
+# merged output contains the partitions in order
+TEST_LOAD(schema_name, partitions_table_name, { "threads": 4, "bytesPerChunk": "128k", "partitions": [ "x1", "x2" ] })
+EXPECT_EQ(1, len(os.listdir(test_output_absolute_parent)))
+EXPECT_EQ(20000, count_rows(verification_schema, verification_table))
+
+#@<> parallel export - parts are removed if export fails
+for split_output in [ False, True ]:
+    EXPECT_FAIL("Error: Shell Error (52006)", re.compile(r"While '.*': Fatal error during dump"), quote(schema_name, no_partitions_table_name), test_output_absolute, { "threads": 4, "bytesPerChunk": "128k", "splitOutput": split_output, "where": "THIS_IS_NO_SQL", "showProgress": False })
+    EXPECT_EQ([], os.listdir(test_output_absolute_parent))
+
 #@<> WL15311 - cleanup
 session.run_sql("DROP SCHEMA !;", [schema_name])
 
@@ -181,6 +181,40 @@ EXPECT_THROWS(lambda: util.import_table([os.path.join(chunked_dir, "nonexisting_
     "Util.import_table: The 'bytesPerChunk' option cannot be used when loading from multiple files."
 )
 
+#@<> Large compressed file is split into chunks loaded by multiple threads
+import gzip
+import shutil
+
+split_dir = os.path.join(__tmp_dir, "wl13362_split")
+shutil.rmtree(split_dir, True)
+os.makedirs(split_dir)
+
+for f in [raw_files[0], raw_files[1]]:
+    shutil.copyfile(os.path.join(chunked_dir, f), os.path.join(split_dir, f))
+
+# uncompressed data (~67MB) is bigger than the default bytesPerChunk (50M)
+with gzip.open(os.path.join(split_dir, "lorem_large.tsv.gz"), "wt") as f:
+    for i in range(100000, 1100000):
+        f.write(f"{i}\tLorem ipsum dolor sit amet, consectetur adipiscing elit {i}\n")
+
+session.run_sql("CREATE TABLE `lorem_split` LIKE `lorem`")
+util.import_table(os.path.join(split_dir, "lorem_*"), {'schema': target_schema, 'table': 'lorem_split', 'threads': 4})
+EXPECT_STDOUT_CONTAINS("3 files (")
+EXPECT_STDOUT_CONTAINS("Total rows affected in " + target_schema + ".lorem_split: Records: 1000200  Deleted: 0  Skipped: 0  Warnings: 0")
+EXPECT_SHELL_LOG_CONTAINS("lorem_large.tsv.gz was split into 2 chunks")
+EXPECT_EQ(1000200, session.run_sql("SELECT COUNT(*) FROM `lorem_split`").fetch_one()[0])
+
+#@<> Chunks of a split file honor maxBytesPerTransaction
+session.run_sql("TRUNCATE TABLE `lorem_split`")
+WIPE_SHELL_LOG()
+util.import_table(os.path.join(split_dir, "lorem_*"), {'schema': target_schema, 'table': 'lorem_split', 'threads': 4, 'maxBytesPerTransaction': '5M'})
+EXPECT_STDOUT_CONTAINS("Total rows affected in " + target_schema + ".lorem_split: Records: 1000200  Deleted: 0  Skipped: 0  Warnings: 0")
+EXPECT_SHELL_LOG_CONTAINS("lorem_large.tsv.gz was split into 2 chunks")
+EXPECT_STDOUT_CONTAINS(" - flushed sub-chunk ")
+EXPECT_EQ(1000200, session.run_sql("SELECT COUNT(*) FROM `lorem_split`").fetch_one()[0])
+
+shutil.rmtree(split_dir, True)
+
 #@<> Missing target table + single path with wildcard
 EXPECT_THROWS(lambda: util.import_table(os.path.join(chunked_dir, "lorem*.tsv"), {'schema': target_schema}),
     "Util.import_table: Target table is not set. The target table for the import operation must be provided in the options."
@@ -62,6 +62,9 @@ FUNCTIONS
             Returns a list of Row objects which contains an element for every
             record left on the result.
 
+      fetch_all_columns()
+            Returns all records left on the result, in a columnar format.
+
       fetch_one()
             Retrieves the next Row on the ClassicResult.
 
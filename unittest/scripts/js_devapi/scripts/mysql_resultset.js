@@ -35,6 +35,7 @@ validateMembers(result, [
 'fetchOne',
 'fetchOneObject',
 'fetchAll',
+'fetchAllColumns',
 'hasData',
 'nextDataSet',
 'nextResult',
@@ -29,6 +29,7 @@ validateMembers(result, [
     'fetchOne',
     'fetchOneObject',
     'fetchAll',
+    'fetchAllColumns',
     'help',
     'hasData',
     'nextDataSet',
@@ -94,7 +95,8 @@ validateMembers(result, [
     'help',
     'fetchOne',
     'fetchOneObject',
-    'fetchAll'])
+    'fetchAll',
+    'fetchAllColumns'])
 
 //@<> DocResult member validation
 var result = collection.find().execute();
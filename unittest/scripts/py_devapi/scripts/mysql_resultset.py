@@ -36,6 +36,7 @@ validate_members(result, [
   'fetch_one',
   'fetch_one_object',
   'fetch_all',
+  'fetch_all_columns',
   'has_data',
   'next_data_set',
   'next_result',
@@ -29,6 +29,7 @@ validate_members(result, [
   'fetch_one',
   'fetch_one_object',
   'fetch_all',
+  'fetch_all_columns',
   'has_data',
   'help',
   'next_data_set',
@@ -116,7 +117,8 @@ validate_members(result, [
   'get_column_names',
   'get_columns',
   'fetch_one',
-  'fetch_all'])
+  'fetch_all',
+  'fetch_all_columns'])
 
 #@<> DocResult member validation
 result = collection.find().execute()
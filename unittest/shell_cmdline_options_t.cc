@@ -770,6 +770,7 @@ TEST_F(Shell_cmdline_options, default_values) {
 
   EXPECT_FALSE(options.interactive);
   EXPECT_EQ(options.log_level, shcore::Logger::LOG_INFO);
+  EXPECT_FALSE(options.log_async);
   EXPECT_EQ("table", options.result_format);
   EXPECT_EQ("off", options.wrap_json);
   EXPECT_FALSE(options.connection_options().get_mfa_passwords()[0].has_value());
@@ -1633,6 +1634,46 @@ TEST_F(Shell_cmdline_options, invalid_connect_timeout) {
   }
 }
 
+TEST_F(Shell_cmdline_options, log_async) {
+  {
+    char *argv[]{const_cast<char *>("ut"),
+                 const_cast<char *>("--log-async"), NULL};
+    Shell_options opts(2, argv);
+
+    EXPECT_EQ(0, opts.get().exit_code);
+    EXPECT_TRUE(opts.get().log_async);
+    EXPECT_EQ(shcore::Logger::Overflow_policy::BLOCK,
+              opts.get().log_async_overflow);
+  }
+
+  {
+    char *argv[]{const_cast<char *>("ut"),
+                 const_cast<char *>("--log-async=drop"), NULL};
+    Shell_options opts(2, argv);
+
+    EXPECT_EQ(0, opts.get().exit_code);
+    EXPECT_TRUE(opts.get().log_async);
+    EXPECT_EQ(shcore::Logger::Overflow_policy::DROP,
+              opts.get().log_async_overflow);
+  }
+
+  {
+    char *argv[]{const_cast<char *>("ut"),
+                 const_cast<char *>("--log-async=whatever"), NULL};
+
+    std::streambuf *backup = std::cerr.rdbuf();
+    std::ostringstream cerr;
+    std::cerr.rdbuf(cerr.rdbuf());
+
+    Shell_options opts(2, argv);
+
+    EXPECT_EQ(1, opts.get().exit_code);
+    EXPECT_THAT(cerr.str(), ::testing::HasSubstr("block, drop"));
+
+    std::cerr.rdbuf(backup);
+  }
+}
+
 TEST_F(Shell_cmdline_options, conflicts_execute_and_file) {
   static constexpr auto error =
       "Conflicting options: --execute and --file cannot be used at the same "
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "unittest/test_utils/benchmark.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Counting replaces the global operator new for the whole binary, it's enabled
+// only with the WITH_BENCHMARK_ALLOCATIONS CMake option. Sanitizers provide
+// their own operator new.
+#ifdef BENCHMARK_COUNT_ALLOCATIONS
+#if defined(__SANITIZE_ADDRESS__) || defined(__SANITIZE_THREAD__)
+#undef BENCHMARK_COUNT_ALLOCATIONS
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer) || __has_feature(memory_sanitizer) || \
+    __has_feature(thread_sanitizer)
+#undef BENCHMARK_COUNT_ALLOCATIONS
+#endif
+#endif
+#endif
+
+#ifdef BENCHMARK_COUNT_ALLOCATIONS
+
+namespace {
+
+std::atomic<uint64_t> g_allocation_count{0};
+std::atomic<uint64_t> g_allocated_bytes{0};
+
+}  // namespace
+
+// Replacements of the global allocation functions, counting the allocations.
+// The remaining variants (array, nothrow) call these by default.
+
+void *operator new(std::size_t size) {
+  g_allocation_count.fetch_add(1, std::memory_order_relaxed);
+  g_allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+
+  if (0 == size) {
+    size = 1;
+  }
+
+  while (true) {
+    if (const auto ptr = std::malloc(size)) {
+      return ptr;
+    }
+
+    if (const auto handler = std::get_new_handler()) {
+      handler();
+    } else {
+      throw std::bad_alloc();
+    }
+  }
+}
+
+// GCC reports false positives when these are inlined into the allocators
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+
+void operator delete(void *ptr, std::size_t) noexcept { std::free(ptr); }
+
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic pop
+#endif
+
+#endif  // BENCHMARK_COUNT_ALLOCATIONS
+
+namespace tests {
+
+bool allocations_counted() {
+#ifdef BENCHMARK_COUNT_ALLOCATIONS
+  return true;
+#else
+  return false;
+#endif
+}
+
+Allocations allocations() {
+  Allocations result;
+
+#ifdef BENCHMARK_COUNT_ALLOCATIONS
+  result.count = g_allocation_count.load(std::memory_order_relaxed);
+  result.bytes = g_allocated_bytes.load(std::memory_order_relaxed);
+#endif
+
+  return result;
+}
+
+void print_allocations(const Allocations &start, int iterations) {
+  if (!allocations_counted()) {
+    return;
+  }
+
+  const auto end = allocations();
+  const auto per_iteration = [iterations](uint64_t value) {
+    return static_cast<double>(value) / iterations;
+  };
+
+  const auto bytes =
+      static_cast<uint64_t>(per_iteration(end.bytes - start.bytes));
+
+  std::cout << ", " << per_iteration(end.count - start.count)
+            << " allocations/iteration ("
+            << mysqlshdk::utils::format_bytes(bytes) << ")";
+}
+
+}  // namespace tests
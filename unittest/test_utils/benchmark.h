@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef UNITTEST_TEST_UTILS_BENCHMARK_H_
+#define UNITTEST_TEST_UTILS_BENCHMARK_H_
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+#include "mysqlshdk/libs/utils/profiling.h"
+#include "mysqlshdk/libs/utils/strformat.h"
+
+namespace tests {
+
+/**
+ * Benchmarks are implemented as disabled tests, named DISABLED_benchmark_*,
+ * use:
+ *
+ *   run_unit_tests --gtest_also_run_disabled_tests
+ *       --gtest_filter=*DISABLED_benchmark*
+ *
+ * to run them. Configure the build with -DWITH_BENCHMARK_ALLOCATIONS=ON to
+ * also report the memory allocations.
+ */
+
+/**
+ * Memory allocations made using the global operator new.
+ */
+struct Allocations {
+  uint64_t count = 0;
+  uint64_t bytes = 0;
+};
+
+/**
+ * Checks if memory allocations are counted. This needs to be enabled with the
+ * WITH_BENCHMARK_ALLOCATIONS CMake option, builds which use sanitizers do not
+ * support it.
+ */
+bool allocations_counted();
+
+/**
+ * Memory allocations made so far, all zeros if these are not counted.
+ */
+Allocations allocations();
+
+/**
+ * Prints the average allocations made by a single iteration since the start,
+ * if these are counted.
+ */
+void print_allocations(const Allocations &start, int iterations);
+
+/**
+ * Runs the given callback in a loop, prints and returns the average time of a
+ * single iteration (in nanoseconds). Also prints the average memory
+ * allocations made by a single iteration, if these are counted.
+ */
+template <typename F>
+uint64_t benchmark(const std::string &name, int iterations, F &&f) {
+  // warm up
+  f();
+
+  const auto start = allocations();
+  mysqlshdk::utils::Duration duration;
+  duration.start();
+
+  for (int i = 0; i < iterations; ++i) {
+    f();
+  }
+
+  duration.finish();
+
+  const uint64_t average = duration.nanoseconds_elapsed() / iterations;
+
+  std::cout << "[ BENCHMARK] " << name << ": " << average << " ns/iteration";
+  print_allocations(start, iterations);
+  std::cout << std::endl;
+
+  return average;
+}
+
+/**
+ * Runs the given callback in a loop, the callback returns the number of bytes
+ * it has processed. Prints the throughput and the average memory allocations
+ * made by a single iteration, if these are counted.
+ */
+template <typename F>
+void benchmark_throughput(const std::string &name, int iterations, F &&f) {
+  // warm up
+  f();
+
+  uint64_t bytes = 0;
+  const auto start = allocations();
+  mysqlshdk::utils::Duration duration;
+  duration.start();
+
+  for (int i = 0; i < iterations; ++i) {
+    bytes += f();
+  }
+
+  duration.finish();
+
+  std::cout << "[ BENCHMARK] " << name << ": "
+            << mysqlshdk::utils::format_throughput_bytes(
+                   bytes, duration.seconds_elapsed())
+            << " (" << mysqlshdk::utils::format_bytes(bytes) << " in "
+            << duration.milliseconds_elapsed() << " ms)";
+  print_allocations(start, iterations);
+  std::cout << std::endl;
+}
+
+}  // namespace tests
+
+#endif  // UNITTEST_TEST_UTILS_BENCHMARK_H_
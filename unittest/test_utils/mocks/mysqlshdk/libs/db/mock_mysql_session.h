@@ -56,6 +56,7 @@ class Mock_mysql_session : public mysqlshdk::db::mysql::Session,
   MOCK_METHOD0(start_transaction, void());
   MOCK_METHOD0(commit, void());
   MOCK_METHOD0(rollback, void());
+  MOCK_METHOD1(set_multi_statements, void(bool));
   MOCK_CONST_METHOD0(get_connection_id, uint64_t());
   MOCK_CONST_METHOD0(get_ssl_cipher, const char *());
   MOCK_CONST_METHOD0(get_connection_options,
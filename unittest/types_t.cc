@@ -284,6 +284,156 @@ TEST(ValueTests, SimpleString) {
                shcore::Value::parse("\"\\u100b0\"").get_string().c_str());
 }
 
+TEST(ValueTests, StringAssignment) {
+  const std::string short_string = "short";
+  const std::string long_string(100, 'x');
+
+  Value v1(short_string);
+  Value v2(long_string, true);
+
+  {
+    Value copy(v1);
+    EXPECT_EQ(short_string, copy.get_string());
+    copy = v2;
+    EXPECT_EQ(shcore::Binary, copy.type);
+    EXPECT_EQ(long_string, copy.as_string());
+    copy = Value(1);
+    EXPECT_EQ(1, copy.as_int());
+    copy = v1;
+    EXPECT_EQ(short_string, copy.get_string());
+  }
+
+  {
+    Value moved(std::move(v1));
+    EXPECT_EQ(short_string, moved.get_string());
+    EXPECT_EQ(shcore::Undefined, v1.type);
+
+    moved = std::move(v2);
+    EXPECT_EQ(long_string, moved.as_string());
+    EXPECT_EQ(shcore::Undefined, v2.type);
+
+    moved = Value::new_map();
+    EXPECT_EQ(shcore::Map, moved.type);
+    moved = Value(short_string);
+    EXPECT_EQ(short_string, moved.get_string());
+  }
+}
+
+TEST(ValueTests, MapOperations) {
+  Value::Map_type map;
+
+  map["b"] = Value(2);
+  map.set("d", Value(4));
+  map.emplace("a", 1);
+  map.emplace("c", "three");
+  map.emplace("e", Value::new_array());
+
+  // items are sorted by key
+  std::string keys;
+
+  for (const auto &item : map) {
+    keys += item.first;
+  }
+
+  EXPECT_EQ("abcde", keys);
+  EXPECT_EQ(5, map.size());
+
+  // emplace does not overwrite the existing value
+  EXPECT_FALSE(map.emplace("a", 10).second);
+  EXPECT_EQ(1, map.get_int("a"));
+
+  EXPECT_TRUE(map.has_key("c"));
+  EXPECT_FALSE(map.has_key("f"));
+  EXPECT_EQ(1, map.count("d"));
+  EXPECT_EQ(0, map.count("f"));
+  EXPECT_EQ(map.end(), map.find("f"));
+  EXPECT_EQ("three", map.at("c").get_string());
+  EXPECT_THROW(map.at("f"), std::out_of_range);
+
+  // items are not moved when a new one is inserted
+  const auto &c = map.at("c");
+  map.set("f", c);
+  EXPECT_EQ(&c, &map.at("c"));
+  map.set("0", map.at("c"));
+  EXPECT_EQ("three", map.get_string("f"));
+  EXPECT_EQ("three", map.get_string("0"));
+
+  EXPECT_EQ(1, map.erase("0"));
+  EXPECT_EQ(0, map.erase("0"));
+  EXPECT_EQ("a", map.begin()->first);
+
+  auto copy = map;
+  EXPECT_TRUE(copy == map);
+
+  copy.set("f", Value("four"));
+  EXPECT_FALSE(copy == map);
+  EXPECT_TRUE(copy < map);
+
+  // copy does not share the items
+  copy = map;
+  copy.set("a", Value(10));
+  EXPECT_EQ(1, map.get_int("a"));
+
+  // keys cannot be modified
+  static_assert(
+      std::is_const_v<std::remove_reference_t<decltype(map.begin()->first)>>);
+  static_assert(std::is_const_v<
+                std::remove_reference_t<decltype((*map.begin()).first)>>);
+
+  map.clear();
+  EXPECT_TRUE(map.empty());
+}
+
+TEST(ValueTests, MapBuilder) {
+  {
+    Value::Map_type::Builder builder;
+    const auto map = builder.build();
+    ASSERT_NE(nullptr, map);
+    EXPECT_TRUE(map->empty());
+  }
+
+  {
+    Value::Map_type::Builder builder(5);
+
+    builder.emplace("c", Value(1));
+    builder.emplace("a", Value(2));
+    builder.emplace("b", Value(3));
+    builder.emplace("a", Value(4));
+    builder.emplace("c", Value(5));
+
+    const auto map = builder.build();
+    ASSERT_EQ(3, map->size());
+
+    // items are sorted, last value of a repeated key is used
+    std::string items;
+
+    for (const auto &item : *map) {
+      items += item.first + item.second.descr();
+    }
+
+    EXPECT_EQ("a4b3c5", items);
+
+    // map can be modified as usual
+    (*map)["0"] = Value(0);
+    (*map)["d"] = Value(6);
+    EXPECT_EQ("0", map->begin()->first);
+    EXPECT_EQ("d", map->rbegin()->first);
+    EXPECT_EQ(4, map->get_int("a"));
+
+    // builder is empty after the map is created
+    EXPECT_TRUE(builder.build()->empty());
+  }
+
+  {
+    // parsed maps are created using the builder
+    const auto map = Value::parse("{'b': 2, 'a': 1, 'a': 3}").as_map();
+    ASSERT_EQ(2, map->size());
+    EXPECT_EQ("a", map->begin()->first);
+    EXPECT_EQ(3, map->get_int("a"));
+    EXPECT_EQ(2, map->get_int("b"));
+  }
+}
+
 TEST(ValueTests, ArrayCompare) {
   Value arr1(Value::new_array());
   Value arr2(Value::new_array());
@@ -37,6 +37,7 @@
 #include "scripting/types.h"
 #include "scripting/types_cpp.h"
 #include "test_utils.h"
+#include "unittest/mysqlshdk/scripting/value_benchmark.h"
 #include "utils/utils_string.h"
 
 using namespace std::placeholders;
@@ -542,5 +543,22 @@ TEST_F(JavaScript, js_date_object) {
   ASSERT_TRUE(object.as_object()->class_name() == "Date");
   ASSERT_EQ("\"2014-01-01 00:00:00\"", object.repr());
 }
+TEST_F(JavaScript, DISABLED_benchmark_round_trip) {
+  env.js->set_global("doc_json",
+                     Value(::tests::benchmark_document().json()));
+  env.js->execute("var doc = JSON.parse(doc_json);");
+
+  ::tests::benchmark("JavaScript to Value", 1000, [this]() {
+    EXPECT_EQ(Value_type::Map, env.js->execute("doc").first.get_type());
+  });
+
+  const auto value = env.js->execute("doc").first;
+
+  ::tests::benchmark("JavaScript round trip", 1000, [this, &value]() {
+    EXPECT_EQ(Value_type::Map,
+              env.js->convert(env.js->convert(value)).get_type());
+  });
+}
+
 }  // namespace tests
 }  // namespace shcore
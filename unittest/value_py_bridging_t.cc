@@ -45,6 +45,7 @@
 
 #include "scripting/python_array_wrapper.h"
 #include "test_utils.h"
+#include "unittest/mysqlshdk/scripting/value_benchmark.h"
 #include "utils/utils_string.h"
 
 using namespace shcore;
@@ -553,5 +554,28 @@ TEST_F(Python, time_to_py) {
   ASSERT_EQ(v2, value);
 }
 
+TEST_F(Python, DISABLED_benchmark_round_trip) {
+  WillEnterPython lock;
+  Input_state cont = Input_state::Ok;
+
+  py->set_global("doc_json", Value(::tests::benchmark_document().json()));
+  py->execute_interactive("import json", cont);
+  py->execute_interactive("doc = json.loads(doc_json)", cont);
+
+  const auto doc = py->get_global_py("doc");
+  ASSERT_TRUE(doc);
+
+  ::tests::benchmark("Python to Value", 1000, [this, &doc]() {
+    EXPECT_EQ(Value_type::Map, py->convert(doc.get()).get_type());
+  });
+
+  const auto value = py->convert(doc.get());
+
+  ::tests::benchmark("Python round trip", 1000, [this, &value]() {
+    EXPECT_EQ(Value_type::Map,
+              py->convert(py->convert(value).get()).get_type());
+  });
+}
+
 }  // namespace tests
 }  // namespace shcore